@@ -293,8 +293,9 @@ static inline double pow(int x, double y) { return std::pow((double)x, y); }
 // these -- usually this means you should place them in ~/.crawl/
 // unless it's a DGL build.
 
-#if !defined(DB_NDBM) && !defined(DB_DBH) && !defined(USE_SQLITE_DBM)
-#define USE_SQLITE_DBM
+#if !defined(DB_NDBM) && !defined(DB_DBH) && !defined(USE_SQLITE_DBM) \
+    && !defined(USE_MMAP_DBM)
+#define USE_MMAP_DBM
 #endif
 
 // And now headers we want precompiled
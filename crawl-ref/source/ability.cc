@@ -86,6 +86,7 @@
 #include "spl-zap.h"
 #include "stairs.h"
 #include "state.h"
+#include "status.h"
 #include "stepdown.h"
 #include "stringutil.h"
 #include "tag-version.h"
@@ -4027,7 +4028,7 @@ static spret _do_ability(const ability_def& abil, bool fail, dist *target,
     case ABIL_WU_JIAN_SERPENTS_LASH:
         mprf(MSGCH_GOD, "Your muscles tense, ready for explosive movement...");
         you.attribute[ATTR_SERPENTS_LASH] = 2;
-        you.redraw_status_lights = true;
+        invalidate_status_cache();
         return spret::success;
 
     case ABIL_WU_JIAN_HEAVENLY_STORM:
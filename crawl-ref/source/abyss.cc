@@ -72,6 +72,14 @@ static ProceduralLayout *abyssLayout = nullptr, *levelLayout = nullptr;
 
 typedef priority_queue<ProceduralSample, vector<ProceduralSample>, ProceduralSamplePQCompare> sample_queue;
 
+// Incremental morphing: every sampled square carries a changepoint, the
+// depth at which its feature next changes, and sits in this queue ordered
+// by that horizon. A shift pops and re-evaluates only the squares whose
+// changepoint the advancing depth has crossed (see _abyss_apply_terrain),
+// so per-turn cost tracks how much of the level actually changes, not the
+// level size. Anything coarser-grained (e.g. memoizing fixed blocks of
+// samples) would re-evaluate a whole block when its earliest square
+// changes; keep that in mind before restructuring this.
 static sample_queue abyss_sample_queue;
 static vector<dungeon_feature_type> abyssal_features;
 static list<monster*> displaced_monsters;
@@ -398,6 +398,39 @@ static skill_type _acquirement_weapon_skill(int agent)
     return skill;
 }
 
+// The weapon subtypes using each weapon skill, with their base acquirement
+// weights. Both are fixed item data, so build the pools once and spare each
+// acquirement the scan over every weapon type in the game; the dynamic
+// adjustments (hands, mutations, what the player has seen) are applied to
+// the handful of candidates in the chosen skill's pool.
+struct weapon_acq_candidate
+{
+    int sub_type;
+    int base_weight;
+};
+
+static const vector<weapon_acq_candidate> &_weapon_acq_pool(skill_type skill)
+{
+    static vector<weapon_acq_candidate> pools[NUM_SKILLS];
+    static bool initialised = false;
+    if (!initialised)
+    {
+        item_def item;
+        item.base_type = OBJ_WEAPONS;
+        for (int i = 0; i < NUM_WEAPONS; ++i)
+        {
+            item.sub_type = i;
+            const skill_type wskill = item_attack_skill(OBJ_WEAPONS, i);
+            // Zero-weight entries stay in the pool: spears only matter for
+            // small species missing a hand, which is checked per candidate.
+            const int weight = property(item, PWPN_ACQ_WEIGHT) * 100;
+            pools[wskill].push_back(weapon_acq_candidate{i, weight});
+        }
+        initialised = true;
+    }
+    return pools[skill];
+}
+
 static int _acquirement_weapon_subtype(int & /*quantity*/, int agent)
 {
     const skill_type skill = _acquirement_weapon_skill(agent);
@@ -407,15 +440,12 @@ static int _acquirement_weapon_subtype(int & /*quantity*/, int agent)
     int count = 0;
     item_def item_considered;
     item_considered.base_type = OBJ_WEAPONS;
-    for (int i = 0; i < NUM_WEAPONS; ++i)
+    for (const weapon_acq_candidate &candidate : _weapon_acq_pool(skill))
     {
-        const int wskill = item_attack_skill(OBJ_WEAPONS, i);
-
-        if (wskill != skill)
-            continue;
+        const int i = candidate.sub_type;
         item_considered.sub_type = i;
 
-        int acqweight = property(item_considered, PWPN_ACQ_WEIGHT) * 100;
+        int acqweight = candidate.base_weight;
 
         // Smaller species missing a hand can acquire polearms with default weight
         // zero, namely spears, since they have no other polearm option.
@@ -537,14 +567,17 @@ static int _acquirement_staff_subtype(int & /*quantity*/,
     stave_type staff = *random_choose_weighted(weights);
 
     // chance to choose randomly, goes to 100% if all staves are id'd or 0
-    // skill. Just brute force it.
+    // skill.
     if (staff == NUM_STAVES)
     {
-        do
+        static vector<stave_type> valid_staves;
+        if (valid_staves.empty())
         {
-            staff = static_cast<stave_type>(random2(NUM_STAVES));
+            for (int i = 0; i < NUM_STAVES; i++)
+                if (!item_type_removed(OBJ_STAVES, static_cast<stave_type>(i)))
+                    valid_staves.push_back(static_cast<stave_type>(i));
         }
-        while (item_type_removed(OBJ_STAVES, staff));
+        staff = *random_iterator(valid_staves);
     }
 
     return staff;
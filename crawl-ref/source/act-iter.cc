@@ -2,18 +2,38 @@
 
 #include "act-iter.h"
 
+#include "coord.h"
+#include "coordit.h"
 #include "env.h"
 #include "losglobal.h"
+#include "mon-util.h"
+
+// For any real los_type, cell_see_cell() only ever admits cells within
+// LOS_RADIUS of the center, so the near iterators can walk that square
+// and look candidates up in env.mgrid instead of testing every live
+// monster on the level. LOS_NONE admits the whole level and keeps the
+// old slot walk; max is exclusive on both paths.
+static const vector<coord_def>* _near_offsets(los_type los)
+{
+    return los == LOS_NONE ? nullptr : &square_radius_offsets(LOS_RADIUS);
+}
+
+static int _near_max(const vector<coord_def>* offsets)
+{
+    return offsets ? (int)offsets->size() : env.max_mon_index + 1;
+}
 
 actor_near_iterator::actor_near_iterator(coord_def c, los_type los)
-    : center(c), _los(los), viewer(nullptr), i(-1), max(env.max_mon_index)
+    : center(c), _los(los), viewer(nullptr), i(-1),
+      max(_near_max(_near_offsets(los))), offsets(_near_offsets(los))
 {
     if (!valid(&you))
         advance();
 }
 
 actor_near_iterator::actor_near_iterator(const actor* a, los_type los)
-    : center(a->pos()), _los(los), viewer(a), i(-1), max(env.max_mon_index)
+    : center(a->pos()), _los(los), viewer(a), i(-1),
+      max(_near_max(_near_offsets(los))), offsets(_near_offsets(los))
 {
     if (!valid(&you))
         advance();
@@ -28,10 +48,12 @@ actor* actor_near_iterator::operator*() const
 {
     if (i == -1)
         return &you;
-    else if (i <= max)
-        return &env.mons[i];
-    else
+    if (i >= max)
         return nullptr;
+    if (!offsets)
+        return &env.mons[i];
+    const coord_def p = center + (*offsets)[i];
+    return in_bounds(p) ? monster_at(p) : nullptr;
 }
 
 actor* actor_near_iterator::operator->() const
@@ -58,13 +80,17 @@ bool actor_near_iterator::valid(const actor* a) const
         return false;
     if (viewer && !a->visible_to(viewer))
         return false;
+    // Offset-table cells are in bounds and within LOS_RADIUS of the
+    // center by construction; the player (i == -1) can be anywhere.
+    if (offsets && i >= 0 && in_bounds(center))
+        return cell_see_cell_near(center, a->pos(), _los);
     return cell_see_cell(center, a->pos(), _los);
 }
 
 void actor_near_iterator::advance()
 {
     do
-         if (++i > max)
+         if (++i >= max)
              return;
     while (!valid(**this));
 }
@@ -72,17 +98,25 @@ void actor_near_iterator::advance()
 //////////////////////////////////////////////////////////////////////////
 
 monster_near_iterator::monster_near_iterator(coord_def c, los_type los)
-    : center(c), _los(los), viewer(nullptr), i(0), max(env.max_mon_index)
+    : center(c), _los(los), viewer(nullptr), i(-1),
+      max(_near_max(_near_offsets(los))), offsets(_near_offsets(los))
 {
-    if (!valid(&env.mons[0]))
+    // With no live monsters at all there is nothing to walk the LOS
+    // offsets for; resting and travel probe this iterator every turn.
+    if (env.live_mon_slots.empty())
+        i = max;
+    else
         advance();
     begin_point = i;
 }
 
 monster_near_iterator::monster_near_iterator(const actor *a, los_type los)
-    : center(a->pos()), _los(los), viewer(a), i(0), max(env.max_mon_index)
+    : center(a->pos()), _los(los), viewer(a), i(-1),
+      max(_near_max(_near_offsets(los))), offsets(_near_offsets(los))
 {
-    if (!valid(&env.mons[0]))
+    if (env.live_mon_slots.empty())
+        i = max;
+    else
         advance();
     begin_point = i;
 }
@@ -94,10 +128,12 @@ monster_near_iterator::operator bool() const
 
 monster* monster_near_iterator::operator*() const
 {
-    if (i <= max)
-        return &env.mons[i];
-    else
+    if (i >= max)
         return nullptr;
+    if (!offsets)
+        return &env.mons[i];
+    const coord_def p = center + (*offsets)[i];
+    return in_bounds(p) ? monster_at(p) : nullptr;
 }
 
 monster* monster_near_iterator::operator->() const
@@ -138,7 +174,7 @@ monster_near_iterator monster_near_iterator::begin()
 monster_near_iterator monster_near_iterator::end()
 {
     monster_near_iterator copy = *this;
-    copy.i = max + 1;
+    copy.i = max;
     return copy;
 }
 
@@ -148,13 +184,15 @@ bool monster_near_iterator::valid(const monster* a) const
         return false;
     if (viewer && !a->visible_to(viewer))
         return false;
+    if (offsets && in_bounds(center))
+        return cell_see_cell_near(center, a->pos(), _los);
     return cell_see_cell(center, a->pos(), _los);
 }
 
 void monster_near_iterator::advance()
 {
     do
-         if (++i > max)
+         if (++i >= max)
              return;
     while (!valid(**this));
 }
@@ -162,15 +200,14 @@ void monster_near_iterator::advance()
 //////////////////////////////////////////////////////////////////////////
 
 monster_iterator::monster_iterator()
-    : i(0), max(env.max_mon_index)
+    : i(-1)
 {
-    while (i <= max && !env.mons[i].alive())
-        i++;
+    advance();
 }
 
 monster_iterator::operator bool() const
 {
-    return i <= max && (*this)->alive();
+    return i < MAX_MONSTERS && (*this)->alive();
 }
 
 monster* monster_iterator::operator*() const
@@ -199,12 +236,24 @@ monster_iterator monster_iterator::operator++(int)
     return copy;
 }
 
+// Walk only the slots in env.live_mon_slots. Searching the sorted index
+// by slot number rather than holding a position into it keeps iteration
+// valid when monsters are created or destroyed mid-loop, with the same
+// visiting order the full array scan had.
 void monster_iterator::advance()
 {
+    const vector<int> &live = env.live_mon_slots;
     do
-         if (++i > max)
-             return;
-    while (!(*this)->alive());
+    {
+        auto slot = upper_bound(live.begin(), live.end(), i);
+        if (slot == live.end())
+        {
+            i = MAX_MONSTERS;
+            return;
+        }
+        i = *slot;
+    }
+    while (!env.mons[i].alive());
 }
 
 bool far_to_near_sorter::operator()(const actor* a, const actor* b)
@@ -25,6 +25,7 @@ protected:
     const actor* viewer;
     int i;
     const int max;
+    const vector<coord_def>* offsets;
 
     bool valid(const actor* a) const;
     void advance();
@@ -52,6 +53,7 @@ protected:
     const actor* viewer;
     int i;
     const int max;
+    const vector<coord_def>* offsets;
     int begin_point;
 
     bool valid(const monster* a) const;
@@ -71,7 +73,6 @@ public:
 
 protected:
     int i;
-    const int max;
     void advance();
 };
 
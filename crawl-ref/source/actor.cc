@@ -140,10 +140,35 @@ int actor::check_willpower(const actor* source, int power) const
     return wlchance - wlch2;
 }
 
+static unsigned _actor_position_mark = 0;
+
+unsigned actor_position_mark()
+{
+    return _actor_position_mark;
+}
+
+void bump_actor_position_mark()
+{
+    ++_actor_position_mark;
+}
+
+static unsigned _actor_ench_mark = 0;
+
+unsigned actor_ench_mark()
+{
+    return _actor_ench_mark;
+}
+
+void bump_actor_ench_mark()
+{
+    ++_actor_ench_mark;
+}
+
 void actor::set_position(const coord_def &c)
 {
     const coord_def oldpos = position;
     position = c;
+    bump_actor_position_mark();
     los_actor_moved(this, oldpos);
     areas_actor_moved(this, oldpos);
 }
@@ -437,3 +437,15 @@ private:
 };
 
 bool actor_slime_wall_immune(const actor *actor);
+
+// A counter bumped whenever any actor changes position or is removed
+// from the level; position-sensitive caches can compare marks to tell
+// whether the arrangement of actors may have changed.
+unsigned actor_position_mark();
+void bump_actor_position_mark();
+
+// Companion counter for transient actor state: bumped when a monster
+// gains or loses an enchantment or a player duration changes, for
+// caches that depend on statuses rather than positions.
+unsigned actor_ench_mark();
+void bump_actor_ench_mark();
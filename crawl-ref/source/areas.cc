@@ -69,6 +69,38 @@ static bool _agrid_valid = false;
 /// \brief If true, the level has no area effect
 static bool no_areas = false;
 
+/// \brief Dirty region for partial cache updates
+/// \details When _agrid_partial is set (and _agrid_valid is not), only
+/// the cells inside this bounding box are stale: the next update clears
+/// and re-stamps just that region, and sources whose footprint cannot
+/// reach it skip their stamping loops entirely.
+static bool _agrid_partial = false;
+static coord_def _agrid_dirty_tl;
+static coord_def _agrid_dirty_br;
+
+/// Can a source at c with radius r have stamped cells in the dirty box?
+static bool _overlaps_dirty_region(const coord_def& c, int r)
+{
+    return c.x + r >= _agrid_dirty_tl.x && c.x - r <= _agrid_dirty_br.x
+           && c.y + r >= _agrid_dirty_tl.y && c.y - r <= _agrid_dirty_br.y;
+}
+
+static void _expand_dirty_region(const coord_def& c, int r)
+{
+    _agrid_dirty_tl.x = max(0, min(_agrid_dirty_tl.x, c.x - r));
+    _agrid_dirty_tl.y = max(0, min(_agrid_dirty_tl.y, c.y - r));
+    _agrid_dirty_br.x = min(GXM - 1, max(_agrid_dirty_br.x, c.x + r));
+    _agrid_dirty_br.y = min(GYM - 1, max(_agrid_dirty_br.y, c.y + r));
+}
+
+// Should the stamping loop for a source at c with radius r run? During
+// a partial update, sources that can't touch the dirty region already
+// have all their stamps in place.
+static bool _should_stamp(const coord_def& c, int r)
+{
+    return !_agrid_partial || _overlaps_dirty_region(c, r);
+}
+
 static void _set_agrid_flag(const coord_def& p, areaprop f)
 {
     _agrid(p) |= f;
@@ -87,22 +119,68 @@ static bool _check_agrid_flag(const coord_def& p, areaprop f)
 void invalidate_agrid(bool recheck_new)
 {
     _agrid_valid = false;
+    _agrid_partial = false;
     if (recheck_new)
         no_areas = false;
 }
 
+/// Largest radius of any area effect the actor is generating, or -1.
+static int _actor_max_area_radius(const actor* act)
+{
+    int r = max(max(act->halo_radius(), act->silence_radius()),
+                max(act->liquefying_radius(),
+                    max(act->umbra_radius(),
+                        act->demon_silence_radius())));
+    if (act->is_player())
+    {
+        if (player_has_orb() || you.unrand_equipped(UNRAND_CHARLATANS_ORB))
+            r = max(r, 2);
+        if (you.duration[DUR_QUAD_DAMAGE])
+            r = max(r, 2);
+        if (you.duration[DUR_DISJUNCTION])
+            r = max(r, 4);
+    }
+    return r;
+}
+
 void areas_actor_moved(const actor* act, const coord_def& oldpos)
 {
-    UNUSED(oldpos);
-    if (act->alive() &&
-        (you.entering_level
-         || act->halo_radius() > -1 || act->silence_radius() > -1
-         || act->liquefying_radius() > -1 || act->umbra_radius() > -1
-         || act->demon_silence_radius() > -1))
+    if (!act->alive())
+        return;
+
+    if (you.entering_level)
+    {
+        invalidate_agrid(true);
+        return;
+    }
+
+    const int r = _actor_max_area_radius(act);
+    if (r < 0)
+        return;
+
+    // Already fully invalid; nothing to refine.
+    if (!_agrid_valid && !_agrid_partial)
+        return;
+
+    if (no_areas)
     {
-        // Not necessarily new, but certainly potentially interesting.
+        // The cache thinks there are no areas at all, so it holds no
+        // stamps to patch; force a full recheck.
         invalidate_agrid(true);
+        return;
     }
+
+    // Only the union of the actor's old and new footprints can have
+    // changed; the rest of the cache stays valid.
+    if (!_agrid_partial)
+    {
+        _agrid_dirty_tl = coord_def(GXM, GYM);
+        _agrid_dirty_br = coord_def(-1, -1);
+    }
+    _expand_dirty_region(oldpos, r);
+    _expand_dirty_region(act->pos(), r);
+    _agrid_partial = true;
+    _agrid_valid = false;
 }
 
 /// \brief Add some of the actor's area effects to the grid and center caches
@@ -118,8 +196,9 @@ static void _actor_areas(actor *a)
     {
         _agrid_centres.emplace_back(area_centre_type::silence, a->pos(), r);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::silence);
+        if (_should_stamp(a->pos(), r))
+            for (radius_iterator ri(a->pos(), r, C_SQUARE); ri; ++ri)
+                _set_agrid_flag(*ri, areaprop::silence);
         no_areas = false;
     }
 
@@ -127,8 +206,14 @@ static void _actor_areas(actor *a)
     {
         _agrid_centres.emplace_back(area_centre_type::silence, a->pos(), r);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT, true); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::silence);
+        if (_should_stamp(a->pos(), r))
+        {
+            for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT, true);
+                 ri; ++ri)
+            {
+                _set_agrid_flag(*ri, areaprop::silence);
+            }
+        }
         no_areas = false;
     }
 
@@ -136,8 +221,9 @@ static void _actor_areas(actor *a)
     {
         _agrid_centres.emplace_back(area_centre_type::halo, a->pos(), r);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::halo);
+        if (_should_stamp(a->pos(), r))
+            for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
+                _set_agrid_flag(*ri, areaprop::halo);
         no_areas = false;
     }
 
@@ -145,12 +231,15 @@ static void _actor_areas(actor *a)
     {
         _agrid_centres.emplace_back(area_centre_type::liquid, a->pos(), r);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_SOLID); ri; ++ri)
+        if (_should_stamp(a->pos(), r))
         {
-            dungeon_feature_type f = env.grid(*ri);
+            for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_SOLID); ri; ++ri)
+            {
+                dungeon_feature_type f = env.grid(*ri);
 
-            if (feat_has_solid_floor(f) && !feat_is_water(f))
-                _set_agrid_flag(*ri, areaprop::liquified);
+                if (feat_has_solid_floor(f) && !feat_is_water(f))
+                    _set_agrid_flag(*ri, areaprop::liquified);
+            }
         }
         no_areas = false;
     }
@@ -159,8 +248,9 @@ static void _actor_areas(actor *a)
     {
         _agrid_centres.emplace_back(area_centre_type::umbra, a->pos(), r);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::umbra);
+        if (_should_stamp(a->pos(), r))
+            for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
+                _set_agrid_flag(*ri, areaprop::umbra);
         no_areas = false;
     }
 }
@@ -179,10 +269,21 @@ static void _update_agrid()
     if (no_areas)
     {
         _agrid_valid = true;
+        _agrid_partial = false;
         return;
     }
 
-    _agrid.init(areaprops());
+    if (_agrid_partial)
+    {
+        // Only the dirty region is stale; clear just those cells. The
+        // stamping loops below re-cover them, with sources that can't
+        // reach the region skipping their loops.
+        for (int x = _agrid_dirty_tl.x; x <= _agrid_dirty_br.x; ++x)
+            for (int y = _agrid_dirty_tl.y; y <= _agrid_dirty_br.y; ++y)
+                _agrid[x][y] = areaprops();
+    }
+    else
+        _agrid.init(areaprops());
     _agrid_centres.clear();
 
     no_areas = true;
@@ -196,8 +297,9 @@ static void _update_agrid()
     {
         const int r = 2;
         _agrid_centres.emplace_back(area_centre_type::orb, you.pos(), r);
-        for (radius_iterator ri(you.pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::orb);
+        if (_should_stamp(you.pos(), r))
+            for (radius_iterator ri(you.pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
+                _set_agrid_flag(*ri, areaprop::orb);
         no_areas = false;
     }
 
@@ -205,11 +307,14 @@ static void _update_agrid()
     {
         const int r = 2;
         _agrid_centres.emplace_back(area_centre_type::quad, you.pos(), r);
-        for (radius_iterator ri(you.pos(), r, C_SQUARE);
-             ri; ++ri)
+        if (_should_stamp(you.pos(), r))
         {
-            if (cell_see_cell(you.pos(), *ri, LOS_DEFAULT))
-                _set_agrid_flag(*ri, areaprop::quad);
+            for (radius_iterator ri(you.pos(), r, C_SQUARE);
+                 ri; ++ri)
+            {
+                if (cell_see_cell(you.pos(), *ri, LOS_DEFAULT))
+                    _set_agrid_flag(*ri, areaprop::quad);
+            }
         }
         no_areas = false;
     }
@@ -219,11 +324,14 @@ static void _update_agrid()
         const int r = 4;
         _agrid_centres.emplace_back(area_centre_type::disjunction,
                                     you.pos(), r);
-        for (radius_iterator ri(you.pos(), r, C_SQUARE);
-             ri; ++ri)
+        if (_should_stamp(you.pos(), r))
         {
-            if (cell_see_cell(you.pos(), *ri, LOS_DEFAULT))
-                _set_agrid_flag(*ri, areaprop::disjunction);
+            for (radius_iterator ri(you.pos(), r, C_SQUARE);
+                 ri; ++ri)
+            {
+                if (cell_see_cell(you.pos(), *ri, LOS_DEFAULT))
+                    _set_agrid_flag(*ri, areaprop::disjunction);
+            }
         }
         no_areas = false;
     }
@@ -231,6 +339,7 @@ static void _update_agrid()
     // TODO: update sanctuary here.
 
     _agrid_valid = true;
+    _agrid_partial = false;
 }
 
 static area_centre_type _get_first_area(const coord_def& f)
@@ -222,6 +222,10 @@ namespace arena
     static level_id place(BRANCH_DEPTHS, 1);
     static string arena_log;
 
+    // Per-trial statistics, written when the spec carries a "csv:" tag.
+    static FILE *stats_file = nullptr;
+    static string stats_path;
+
     static void adjust_spells(monster* mons, bool no_summons, bool no_animate)
     {
         monster_spells &spells(mons->spells);
@@ -424,12 +428,14 @@ namespace arena
         random_uniques = strip_tag(spec, "random_uniques");
 
         const int ntrials = strip_number_tag(spec, "t:");
-        if (ntrials != TAG_UNFOUND && ntrials >= 1 && ntrials <= 99
+        if (ntrials != TAG_UNFOUND && ntrials >= 1 && ntrials <= 9999
             && !total_trials)
         {
             total_trials = ntrials;
         }
 
+        stats_path = strip_tag_prefix(spec, "csv:");
+
         arena_type = strip_tag_prefix(spec, "arena:");
 
         if (arena_type.empty())
@@ -823,6 +829,37 @@ namespace arena
         is_respawning = false;
     }
 
+    // One CSV row per finished trial: who won, how long it took and what
+    // each side had left standing. Flushed per row so partial batches
+    // are still usable after a cancel.
+    static void write_trial_stats(bool was_tied)
+    {
+        if (stats_file == nullptr)
+            return;
+
+        int a_count = 0, a_hp = 0;
+        int b_count = 0, b_hp = 0;
+        for (monster_iterator mi; mi; ++mi)
+        {
+            if (mi->friendly())
+            {
+                a_count++;
+                a_hp += mi->hit_points;
+            }
+            else
+            {
+                b_count++;
+                b_hp += mi->hit_points;
+            }
+        }
+
+        fprintf(stats_file, "%d,%s,%d,%d,%d,%d,%d\n",
+                trials_done,
+                was_tied ? "tie" : faction_a.won ? "a" : "b",
+                turns, a_count, a_hp, b_count, b_hp);
+        fflush(stats_file);
+    }
+
     static void do_fight()
     {
         viewwindow();
@@ -924,6 +961,8 @@ namespace arena
         else if (faction_a.won)
             team_a_wins++;
 
+        write_trial_stats(was_tied);
+
         show_fight_banner(true);
 
         string msg;
@@ -974,6 +1013,18 @@ namespace arena
             if (mons_is_unique(i) && !arena_veto_random_monster(i))
                 uniques_list.push_back(i);
         }
+
+        if (!stats_path.empty())
+        {
+            stats_file = fopen_u(stats_path.c_str(), "w");
+            if (stats_file == nullptr)
+            {
+                throw arena_error_nonfatal_f("Can't write stats to \"%s\"",
+                                             stats_path.c_str());
+            }
+            fprintf(stats_file,
+                    "trial,winner,turns,a_survivors,a_hp,b_survivors,b_hp\n");
+        }
     }
 
     static void global_shutdown()
@@ -983,6 +1034,12 @@ namespace arena
 
         file = nullptr;
         arena_log = "";
+
+        if (stats_file != nullptr)
+            fclose(stats_file);
+
+        stats_file = nullptr;
+        stats_path = "";
     }
 
     static void write_results()
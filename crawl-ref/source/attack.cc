@@ -393,6 +393,9 @@ void attack::init_attack(int attack_number)
 
     attacker_visible   = attacker->observable();
     defender_visible   = defender && defender->observable();
+    // When neither combatant is observable the attack resolves quietly:
+    // every announce/describe path checks this flag before assembling
+    // any prose, so off-screen fights cost arithmetic only.
     needs_message      = (attacker_visible || defender_visible);
 
     if (attacker->is_monster())
@@ -498,16 +501,22 @@ bool attack::distortion_affects_defender()
     {
     case SMALL_DMG:
         special_damage += 1 + random2avg(7, 2);
-        special_damage_message = make_stringf("Space warps around %s%s",
+        if (needs_message)
+        {
+            special_damage_message = make_stringf("Space warps around %s%s",
                                               defender_name(false).c_str(),
                                               attack_strength_punctuation(special_damage).c_str());
+        }
         break;
     case BIG_DMG:
         special_damage += 3 + random2avg(24, 2);
-        special_damage_message =
-            make_stringf("Space warps horribly around %s%s",
-                         defender_name(false).c_str(),
-                         attack_strength_punctuation(special_damage).c_str());
+        if (needs_message)
+        {
+            special_damage_message =
+                make_stringf("Space warps horribly around %s%s",
+                             defender_name(false).c_str(),
+                             attack_strength_punctuation(special_damage).c_str());
+        }
         break;
     case BLINK:
         if (defender_visible)
@@ -1255,14 +1264,17 @@ bool attack::apply_damage_brand(const char *what)
         else if (one_chance_in(4))
         {
             special_damage = 8 + random2(13);
-            const string punctuation =
-                    attack_strength_punctuation(special_damage);
-            special_damage_message =
-                defender->is_player()
-                ? make_stringf("You are electrocuted%s", punctuation.c_str())
-                : make_stringf("Lightning courses through %s%s",
-                               defender->name(DESC_THE).c_str(),
-                               punctuation.c_str());
+            if (needs_message)
+            {
+                const string punctuation =
+                        attack_strength_punctuation(special_damage);
+                special_damage_message =
+                    defender->is_player()
+                    ? make_stringf("You are electrocuted%s", punctuation.c_str())
+                    : make_stringf("Lightning courses through %s%s",
+                                   defender->name(DESC_THE).c_str(),
+                                   punctuation.c_str());
+            }
             special_damage_flavour = BEAM_ELECTRICITY;
             defender->expose_to_element(BEAM_ELECTRICITY, 2);
         }
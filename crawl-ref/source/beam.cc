@@ -387,12 +387,12 @@ int zap_to_hit(zap_type z_type, int power, bool is_monster)
     const zap_info* zinfo = _seek_zap(z_type);
     if (!zinfo)
         return 0;
-    const tohit_deducer* hit_calc = is_monster ? zinfo->monster_tohit
-                                               : zinfo->player_tohit;
+    tohit_deducer* hit_calc = is_monster ? zinfo->monster_tohit
+                                         : zinfo->player_tohit;
     if (zinfo->is_enchantment)
         return 0;
     ASSERT(hit_calc);
-    const int hit = (*hit_calc)(power);
+    const int hit = (*hit_calc)(power, true);
     if (hit != AUTOMATIC_HIT && !is_monster && crawl_state.need_save)
         return max(0, hit - you.inaccuracy_penalty());
     return hit;
@@ -403,8 +403,8 @@ dice_def zap_damage(zap_type z_type, int power, bool is_monster, bool random)
     const zap_info* zinfo = _seek_zap(z_type);
     if (!zinfo)
         return dice_def(0,0);
-    const dam_deducer* dam_calc = is_monster ? zinfo->monster_damage
-                                             : zinfo->player_damage;
+    dam_deducer* dam_calc = is_monster ? zinfo->monster_damage
+                                       : zinfo->player_damage;
     return dam_calc ? (*dam_calc)(power, random) : dice_def(0,0);
 }
 
@@ -425,7 +425,7 @@ int zap_ench_power(zap_type z_type, int pow, bool is_monster)
     tohit_deducer* ench_calc = is_monster ? zinfo->monster_tohit
                                           : zinfo->player_tohit;
     if (zinfo->is_enchantment && ench_calc)
-        return (*ench_calc)(pow);
+        return (*ench_calc)(pow, true);
     else
         return pow;
 }
@@ -652,8 +652,10 @@ void bolt::initialise_fire()
 
     message_cache.clear();
 
+    // Tracers generate no messages, and any change to seen is undone when
+    // the tracer fire restores the bolt, so skip this bookkeeping for them.
     // seen might be set by caller to suppress this.
-    if (!seen && you.see_cell(source) && range > 0 && visible())
+    if (!is_tracer() && !seen && you.see_cell(source) && range > 0 && visible())
     {
         seen = true;
         const monster* mon = monster_at(source);
@@ -670,7 +672,7 @@ void bolt::initialise_fire()
 
     // Visible self-targeted beams are always seen, even though they don't
     // leave a path.
-    if (you.see_cell(source) && target == source && visible())
+    if (!is_tracer() && you.see_cell(source) && target == source && visible())
         seen = true;
 
     // The agent may die during the beam's firing, need to save these now.
@@ -733,14 +735,34 @@ void bolt::apply_beam_conducts()
 
 void bolt::choose_ray()
 {
-    if ((!chose_ray || reflections > 0)
-        && !find_ray(source, target, ray, opc_solid_see)
+    if (chose_ray && reflections <= 0)
+        return;
+
+    // The same endpoints get traced repeatedly in quick succession: a
+    // player shot fires an ally-warning tracer and then the real beam,
+    // and targeters re-trace as the aim moves around. find_ray() is
+    // deterministic, so reuse the last choice while the terrain stands.
+    if (reflections <= 0
+        && chosen_ray_source == source
+        && chosen_ray_target == target
+        && chosen_ray_terrain_mark == terrain_change_mark())
+    {
+        ray = chosen_ray;
+        return;
+    }
+
+    if (!find_ray(source, target, ray, opc_solid_see)
         // If fire is blocked, at least try a visible path so the
         // error message is better.
         && !find_ray(source, target, ray, opc_default))
     {
         fallback_ray(source, target, ray);
     }
+
+    chosen_ray = ray;
+    chosen_ray_source = source;
+    chosen_ray_target = target;
+    chosen_ray_terrain_mark = terrain_change_mark();
 }
 
 // Draw the bolt at p if needed.
@@ -1153,6 +1175,37 @@ void bolt::affect_cell()
         affect_ground();
 }
 
+// Pool of scratch bolts for tracer fires. A tracer fire needs a full
+// copy of the bolt to restore from afterwards; constructing that copy
+// fresh heap-allocates every vector and string member, and monster AI
+// fires a tracer per candidate spell per monster per turn. Leasing the
+// copies from a pool and filling them by assignment reuses the members'
+// capacity across fires. The pool is depth-indexed since tracer fires
+// can nest (secondary explosions, path re-tracing).
+static vector<bolt*> _tracer_copy_pool;
+static unsigned int _tracer_copy_depth = 0;
+
+class tracer_copy_lease
+{
+public:
+    tracer_copy_lease()
+    {
+        if (_tracer_copy_depth == _tracer_copy_pool.size())
+            _tracer_copy_pool.push_back(new bolt());
+        copy = _tracer_copy_pool[_tracer_copy_depth++];
+    }
+
+    ~tracer_copy_lease()
+    {
+        --_tracer_copy_depth;
+    }
+
+    bolt &operator*() const { return *copy; }
+
+private:
+    bolt *copy;
+};
+
 static void _undo_tracer(bolt &orig, bolt &copy)
 {
     // FIXME: we should have a better idea of what gets changed!
@@ -1176,18 +1229,20 @@ void bolt::fire()
 
     if (is_tracer())
     {
-        bolt boltcopy = *this;
+        tracer_copy_lease boltcopy;
+        *boltcopy = *this;
 
         if (special_explosion != nullptr)
         {
-            bolt special_explosion_copy = *special_explosion;
+            tracer_copy_lease special_explosion_copy;
+            *special_explosion_copy = *special_explosion;
             do_fire();
-            _undo_tracer(*special_explosion, special_explosion_copy);
+            _undo_tracer(*special_explosion, *special_explosion_copy);
         }
         else
             do_fire();
 
-        _undo_tracer(*this, boltcopy);
+        _undo_tracer(*this, *boltcopy);
     }
     else
         do_fire();
@@ -1229,7 +1284,12 @@ void bolt::do_fire()
     }
 
     apply_beam_conducts();
-    cursor_control coff(false);
+
+    // Hiding the cursor is terminal work; tracers draw nothing, so leave
+    // it alone for them.
+    unique_ptr<cursor_control> coff;
+    if (!is_tracer())
+        coff.reset(new cursor_control(false));
 
     msg_generated = false;
     if (!aimed_at_feet)
@@ -1401,14 +1461,17 @@ void bolt::do_fire()
                || mon_at // If there *was* a monster (they might have died by now)
                || affects_nothing); // returning weapons and BEAM_VISUAL
 
-        const bool was_seen = seen;
-        if (!was_seen && range > 0 && visible() && you.see_cell(pos()))
-            seen = true;
-
-        if (flavour != BEAM_VISUAL && !was_seen && seen && !is_tracer())
+        // As in initialise_fire(), tracers can skip the seen bookkeeping:
+        // the flag is restored when the tracer fire unwinds.
+        if (!is_tracer() && !seen && range > 0 && visible()
+            && you.see_cell(pos()))
         {
-            mprf("%s appears from out of your range of vision.",
-                 article_a(name, false).c_str());
+            seen = true;
+            if (flavour != BEAM_VISUAL)
+            {
+                mprf("%s appears from out of your range of vision.",
+                     article_a(name, false).c_str());
+            }
         }
 
         // Reset chaos beams so that it won't be considered an invisible
@@ -2201,25 +2264,17 @@ int silver_damages_victim(actor* victim, int damage, string &dmg_msg)
 //
 //  Note that beam properties must be set, as the tracer will take them
 //  into account, as well as the monster's intelligence.
-void fire_tracer(const monster* mons, targeting_tracer& tracer,
-                 bolt &pbolt, bool explode_only, bool explosion_hole)
+// The input-parameter fiddling fire_tracer() does before firing, split
+// out so that callers reusing a memoized tracer verdict leave the beam
+// in the same state as a freshly traced one.
+void setup_tracer_bolt(const monster* mons, bolt &pbolt)
 {
-    // If this ASSERT triggers, your spell's setup code probably is doing
-    // something bad when setup_mons_cast is called with check_validity=true.
-    ASSERTM(crawl_state.game_started || crawl_state.test || crawl_state.script
-        || crawl_state.game_is_arena(),
-        "invalid game state for tracer '%s'!", pbolt.name.c_str());
-
     // Don't fiddle with any input parameters other than tracer stuff!
     pbolt.source        = mons->pos();
     pbolt.source_id     = mons->mid;
     pbolt.attitude      = mons_attitude(*mons);
     pbolt.precalc_agent_properties();
 
-    // Init tracer variables.
-    tracer.foe_info.reset();
-    tracer.friend_info.reset();
-
     // Clear misc
     pbolt.reflections   = 0;
     pbolt.bounces       = 0;
@@ -2235,6 +2290,22 @@ void fire_tracer(const monster* mons, targeting_tracer& tracer,
     // player).
     if (pbolt.origin_spell == SPELL_FIRE_STORM)
         pbolt.ex_size = 3;
+}
+
+void fire_tracer(const monster* mons, targeting_tracer& tracer,
+                 bolt &pbolt, bool explode_only, bool explosion_hole)
+{
+    // If this ASSERT triggers, your spell's setup code probably is doing
+    // something bad when setup_mons_cast is called with check_validity=true.
+    ASSERTM(crawl_state.game_started || crawl_state.test || crawl_state.script
+        || crawl_state.game_is_arena(),
+        "invalid game state for tracer '%s'!", pbolt.name.c_str());
+
+    setup_tracer_bolt(mons, pbolt);
+
+    // Init tracer variables.
+    tracer.foe_info.reset();
+    tracer.friend_info.reset();
 
     // Fire!
     if (explode_only)
@@ -7232,6 +7303,15 @@ void bolt::determine_affected_cells(explosion_map& m, const coord_def& delta,
 
     m(delta + centre) = min(count, m(delta + centre));
 
+    // If we are at a wall, we may only spread to squares the caster can
+    // see; look the caster up once here rather than per neighbour.
+    coord_def caster_pos;
+    if (at_wall)
+    {
+        const actor* caster = actor_by_mid(source_id);
+        caster_pos = caster ? caster->pos() : you.pos();
+    }
+
     // Now recurse in every direction.
     for (int i = 0; i < 8; ++i)
     {
@@ -7240,11 +7320,6 @@ void bolt::determine_affected_cells(explosion_map& m, const coord_def& delta,
         if (new_delta.rdist() > centre.rdist())
             continue;
 
-        // If we were at a wall, only move to visible squares.
-        coord_def caster_pos = actor_by_mid(source_id) ?
-                                   actor_by_mid(source_id)->pos() :
-                                   you.pos();
-
         if (at_wall && !cell_see_cell(caster_pos, loc + Compass[i], LOS_NO_TRANS))
             continue;
 
@@ -7714,17 +7789,6 @@ ai_action::goodness targeting_tracer::good_to_fire(int foe_ratio) const
     return ai_action::bad();
 }
 
-void clear_zap_info_on_exit()
-{
-    for (const zap_info &zap : zap_data)
-    {
-        delete zap.player_damage;
-        delete zap.player_tohit;
-        delete zap.monster_damage;
-        delete zap.monster_tohit;
-    }
-}
-
 int ench_power_stepdown(int pow)
 {
     return stepdown(pow, 35);
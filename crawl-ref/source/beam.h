@@ -263,6 +263,14 @@ struct bolt
 
     ray_def     ray;             // shoot on this specific ray
 
+    // Memo of the last choose_ray() search, so that firing the same bolt
+    // again at the same endpoints (a warning tracer followed by the real
+    // shot) skips the ray search. See choose_ray().
+    ray_def   chosen_ray;
+    coord_def chosen_ray_source = {0,0};
+    coord_def chosen_ray_target = {0,0};
+    unsigned  chosen_ray_terrain_mark = 0;
+
     // only used if USE_TILE is defined
     tileidx_t tile_beam = 0;
     tileidx_t tile_explode = 0;
@@ -456,6 +464,7 @@ bool sticky_flame_monster(monster* mons, const actor* who, int dur,
 bool curare_actor(actor* source, actor* target, string name,
                   string source_name, int bonus_poison = 0);
 int silver_damages_victim(actor* victim, int damage, string &dmg_msg);
+void setup_tracer_bolt(const monster* mons, bolt &pbolt);
 void fire_tracer(const monster* mons, targeting_tracer& tracer,
                  bolt &pbolt, bool explode_only = false,
                  bool explosion_hole = false);
@@ -471,7 +480,6 @@ set<coord_def> create_feat_splash(coord_def center, int radius, int num, int dur
                                   dungeon_feature_type new_feat = DNGN_SHALLOW_WATER);
 
 void init_zap_index();
-void clear_zap_info_on_exit();
 
 bool zap_explodes(zap_type ztype);
 bool zap_is_enchantment(zap_type ztype);
@@ -42,6 +42,23 @@ bool bit_vector::get(unsigned long index) const
     return data[w] & (1UL << b);
 }
 
+int bit_vector::num_words() const
+{
+    return nwords;
+}
+
+unsigned long bit_vector::get_word(int w) const
+{
+    ASSERT(w >= 0 && w < nwords);
+    return data[w];
+}
+
+void bit_vector::set_word(int w, unsigned long word)
+{
+    ASSERT(w >= 0 && w < nwords);
+    data[w] = word;
+}
+
 void bit_vector::set(unsigned long index, bool value)
 {
     ASSERT(index < size);
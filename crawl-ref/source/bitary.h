@@ -29,6 +29,12 @@ public:
     bool get(unsigned long index) const;
     void set(unsigned long index, bool value = true);
 
+    // Raw word access, for callers that want to scan many bits at
+    // once instead of testing them one by one.
+    int num_words() const;
+    unsigned long get_word(int w) const;
+    void set_word(int w, unsigned long word);
+
     bit_vector& operator |= (const bit_vector& other);
     bit_vector& operator &= (const bit_vector& other);
     bit_vector  operator & (const bit_vector& other) const;
@@ -92,6 +98,32 @@ public:
         return data.any();
     }
 
+    // Iteration over set bits, as for FixedBitArray below; returns SIZE
+    // when no further bit is set.
+    inline int first_set() const
+    {
+#ifdef __GLIBCXX__
+        return data._Find_first();
+#else
+        for (unsigned int i = 0; i < SIZE; ++i)
+            if (data[i])
+                return i;
+        return SIZE;
+#endif
+    }
+
+    inline int next_set(unsigned int i) const
+    {
+#ifdef __GLIBCXX__
+        return data._Find_next(i);
+#else
+        for (++i; i < SIZE; ++i)
+            if (data[i])
+                return i;
+        return SIZE;
+#endif
+    }
+
     inline FixedBitVector<SIZE>& operator|=(const FixedBitVector<SIZE>&x)
     {
         data |= x.data;
@@ -192,6 +224,51 @@ public:
         return *this;
     }
 
+    // Clear every bit that is set in x.
+    inline FixedBitArray<SIZEX, SIZEY>& andnot(const FixedBitArray<SIZEX, SIZEY>&x)
+    {
+        data &= ~x.data;
+        return *this;
+    }
+
+    inline unsigned int count() const
+    {
+        return data.count();
+    }
+
+    inline bool any() const
+    {
+        return data.any();
+    }
+
+    // Iteration over set bits by linear index (y * SIZEX + x); returns
+    // SIZEX*SIZEY when no further bit is set. Callers can scan with
+    //   for (int i = grid.first_set(); i < end; i = grid.next_set(i))
+    // and skip empty regions without probing each cell.
+    inline int first_set() const
+    {
+#ifdef __GLIBCXX__
+        return data._Find_first();
+#else
+        for (unsigned int i = 0; i < SIZEX*SIZEY; ++i)
+            if (data[i])
+                return i;
+        return SIZEX*SIZEY;
+#endif
+    }
+
+    inline int next_set(unsigned int i) const
+    {
+#ifdef __GLIBCXX__
+        return data._Find_next(i);
+#else
+        for (++i; i < SIZEX*SIZEY; ++i)
+            if (data[i])
+                return i;
+        return SIZEX*SIZEY;
+#endif
+    }
+
     void invert() noexcept
     {
         data.flip();
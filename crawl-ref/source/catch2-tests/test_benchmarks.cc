@@ -0,0 +1,100 @@
+#include <random>
+
+#include "catch_amalgamated.hpp"
+
+#include "AppHdr.h"
+
+#include "coordit.h"
+#include "env.h"
+#include "items.h"
+#include "item-prop.h"
+#include "los.h"
+#include "losparam.h"
+#include "tag-version.h"
+#include "tags.h"
+
+#include "test_player_fixture.h"
+
+// Micro-benchmarks for hot kernels, tagged [!benchmark] so that the
+// normal `make catch2-tests` correctness run skips them. Run them with
+// `make bench`, which also writes machine-diffable XML output.
+//
+// These reuse the mock-player fixture, which cannot create real dungeon
+// or branch levels. Kernels that need one — fill_travel_point_distance,
+// noise propagation, monster turn batches — can't be benchmarked until
+// somebody untangles level generation from the rest of startup.
+
+// A deterministic scatter of walls, dense enough that most rays
+// terminate against terrain rather than the LOS boundary.
+static void _fill_los_arena()
+{
+    std::minstd_rand rng(2554);
+    for (rectangle_iterator ri(0); ri; ++ri)
+        env.grid(*ri) = rng() % 10 ? DNGN_FLOOR : DNGN_ROCK_WALL;
+}
+
+TEST_CASE_METHOD( MockPlayerYouTestsFixture,
+                  "FOV update benchmarks", "[!benchmark]" ) {
+
+    _fill_los_arena();
+
+    // opc_fullyopaque reads terrain only; the default opacity function
+    // also consults clouds and monsters, which the fixture doesn't set up.
+    los_grid sh;
+    const coord_def centre(GXM / 2, GYM / 2);
+
+    BENCHMARK("losight: full recompute, mid-map") {
+        losight(sh, centre, opc_fullyopaque);
+        return sh(coord_def(0, 0));
+    };
+
+    BENCHMARK("losight_cell_update: single changed cell") {
+        losight_cell_update(sh, centre, centre + coord_def(3, 1),
+                            opc_fullyopaque);
+        return sh(coord_def(0, 0));
+    };
+}
+
+TEST_CASE_METHOD( MockPlayerYouTestsFixture,
+                  "Item naming benchmarks", "[!benchmark]" ) {
+
+    item_def wpn;
+    REQUIRE(get_item_by_exact_name(wpn, "broad axe"));
+    wpn.quantity = 1;
+    wpn.plus = 7;
+    wpn.brand = SPWPN_FLAMING;
+
+    BENCHMARK("name an ego weapon") {
+        return wpn.name(DESC_A).size();
+    };
+
+    item_def pot;
+    REQUIRE(get_item_by_exact_name(pot, "potion of curing"));
+    pot.quantity = 3;
+
+    BENCHMARK("name a potion stack") {
+        return pot.name(DESC_PLAIN).size();
+    };
+}
+
+TEST_CASE_METHOD( MockPlayerYouTestsFixture,
+                  "Tag marshalling benchmarks", "[!benchmark]" ) {
+
+    item_def wpn;
+    REQUIRE(get_item_by_exact_name(wpn, "broad axe"));
+    wpn.quantity = 1;
+    wpn.plus = 7;
+    wpn.brand = SPWPN_FLAMING;
+
+    BENCHMARK("item marshall/unmarshall round-trip") {
+        vector<unsigned char> buf;
+        writer w(&buf);
+        marshallItem(w, wpn);
+
+        reader r(buf);
+        r.setMinorVersion(TAG_MINOR_VERSION);
+        item_def copy;
+        unmarshallItem(r, copy);
+        return buf.size();
+    };
+}
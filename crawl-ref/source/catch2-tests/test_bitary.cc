@@ -0,0 +1,55 @@
+#include "catch_amalgamated.hpp"
+
+#include "AppHdr.h"
+
+#include "bitary.h"
+
+TEST_CASE("FixedBitArray word-level operations", "[single-file]")
+{
+    FixedBitArray<80, 70> grid;
+    const int end = 80 * 70;
+
+    SECTION("count and any on an empty array")
+    {
+        REQUIRE(grid.count() == 0);
+        REQUIRE(!grid.any());
+        REQUIRE(grid.first_set() == end);
+    }
+
+    SECTION("first_set/next_set visit exactly the set bits")
+    {
+        const int xs[] = { 0, 1, 63, 64, 79 };
+        const int ys[] = { 0, 2, 35, 69 };
+        set<int> expected;
+        for (int y : ys)
+            for (int x : xs)
+            {
+                grid.set(x, y);
+                expected.insert(y * 80 + x);
+            }
+
+        REQUIRE(grid.count() == expected.size());
+        REQUIRE(grid.any());
+
+        set<int> seen;
+        for (int i = grid.first_set(); i < end; i = grid.next_set(i))
+            seen.insert(i);
+        REQUIRE(seen == expected);
+    }
+
+    SECTION("andnot clears exactly the masked bits")
+    {
+        FixedBitArray<80, 70> mask;
+        grid.set(3, 4);
+        grid.set(40, 40);
+        grid.set(79, 69);
+        mask.set(40, 40);
+        mask.set(5, 5); // not set in grid; no effect
+
+        grid.andnot(mask);
+        REQUIRE(grid.count() == 2);
+        REQUIRE(grid.get(3, 4));
+        REQUIRE(!grid.get(40, 40));
+        REQUIRE(grid.get(79, 69));
+    }
+}
@@ -53,6 +53,7 @@
 #include "state.h"
 #include "stringutil.h"
 #include "tag-version.h"
+#include "threads.h"
 #include "transform.h"
 #include "travel.h"
 #include "unicode.h"
@@ -96,7 +97,8 @@ static void _sdump_separator(dump_params &);
 static void _sdump_lua(dump_params &);
 static void _sdump_dlua_errors(dump_params &);
 static bool _write_dump(const string &fname, const dump_params &,
-                        bool print_dump_path = false);
+                        bool print_dump_path = false,
+                        bool background = false);
 
 struct dump_section_handler
 {
@@ -189,9 +191,9 @@ static dump_params _get_dump(bool full_id = false,
 }
 
 bool dump_char(const string &fname, bool quiet, bool full_id,
-               const scorefile_entry *se)
+               const scorefile_entry *se, bool background)
 {
-    return _write_dump(fname, _get_dump(full_id, se), quiet);
+    return _write_dump(fname, _get_dump(full_id, se), quiet, background);
 }
 
 string seed_description()
@@ -1828,10 +1830,10 @@ void dump_map(FILE *fp, bool debug, bool dist, bool log)
                 else if (testbits(env.pgrid[x][y], FPROP_HIGHLIGHT))
                     fputc('?', fp);
                 else if (dist && env.grid[x][y] == DNGN_FLOOR
-                         && travel_point_distance[x][y] > 0
-                         && travel_point_distance[x][y] < 10)
+                         && travel_point_distance_at(coord_def(x, y)) > 0
+                         && travel_point_distance_at(coord_def(x, y)) < 10)
                 {
-                    fputc('0' + travel_point_distance[x][y], fp);
+                    fputc('0' + travel_point_distance_at(coord_def(x, y)), fp);
                 }
                 else if (env.grid[x][y] >= NUM_FEATURES)
                     fputc('!', fp);
@@ -1899,7 +1901,42 @@ void dump_map(const char* fname, bool debug, bool dist, bool log)
     fclose(fp);
 }
 
-static bool _write_dump(const string &fname, const dump_params &par, bool quiet)
+// A completed morgue text waiting on the background writer thread. The
+// formatted text is an immutable snapshot, so the write can overlap with
+// whatever end-of-game processing follows it.
+struct dump_write_job
+{
+    string file_name;
+    string text;
+};
+
+static thread_t _dump_writer_thread;
+static bool _dump_writer_active = false;
+
+static void *_dump_writer(void *arg)
+{
+    dump_write_job *job = static_cast<dump_write_job*>(arg);
+    if (FILE *handle = fopen_replace(job->file_name.c_str()))
+    {
+        fputs(OUTS(job->text), handle);
+        fclose(handle);
+    }
+    delete job;
+    return nullptr;
+}
+
+// Wait for any pending background morgue write. Must be called before the
+// process exits; also keeps at most one write in flight.
+void join_dump_writer()
+{
+    if (!_dump_writer_active)
+        return;
+    thread_join(_dump_writer_thread);
+    _dump_writer_active = false;
+}
+
+static bool _write_dump(const string &fname, const dump_params &par, bool quiet,
+                        bool background)
 {
     bool succeeded = false;
 
@@ -1915,6 +1952,22 @@ static bool _write_dump(const string &fname, const dump_params &par, bool quiet)
     StashTrack.dump(stash_file_name.c_str(), par.full_id);
 
     file_name += ".txt";
+
+    if (background)
+    {
+        join_dump_writer();
+        dump_write_job *job = new dump_write_job();
+        job->file_name = file_name;
+        job->text = par.text;
+        if (!thread_create_joinable(&_dump_writer_thread, _dump_writer, job))
+        {
+            _dump_writer_active = true;
+            return true;
+        }
+        // Thread creation failed; fall through to the synchronous write.
+        delete job;
+    }
+
     FILE *handle = fopen_replace(file_name.c_str());
 
     dprf("File name: %s", file_name.c_str());
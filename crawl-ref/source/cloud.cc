@@ -637,15 +637,29 @@ static void _handle_spectral_cloud(const cloud_struct& cloud)
 
 void manage_clouds()
 {
-    // We can't iterate over env.cloud directly because _dissipate_cloud
-    // will remove this cloud and invalidate our iterator.
-    vector<cloud_struct *> cloud_ptrs;
-    for (auto& entry : env.cloud)
-        cloud_ptrs.push_back(&entry.second);
+    // Even with no live clouds, map knowledge may remember clouds that
+    // should be pruned (still winds, player clouds out of LOS).
+    if (env.cloud.empty())
+    {
+        update_cloud_knowledge();
+        return;
+    }
 
-    for (auto ptr : cloud_ptrs)
+    // We can't iterate over env.cloud directly because _dissipate_cloud
+    // will remove this cloud and invalidate our iterator. Snapshot
+    // positions rather than pointers — spreading and deletion can touch
+    // other entries too — reusing the buffer across turns.
+    static vector<coord_def> cloud_posns;
+    cloud_posns.clear();
+    for (const auto& entry : env.cloud)
+        cloud_posns.push_back(entry.first);
+
+    for (const coord_def &pos : cloud_posns)
     {
-        cloud_struct& cloud = *ptr;
+        cloud_struct* cl = map_find(env.cloud, pos);
+        if (!cl)
+            continue;
+        cloud_struct& cloud = *cl;
 
 #ifdef ASSERTS
         if (cell_is_solid(cloud.pos))
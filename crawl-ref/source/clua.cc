@@ -669,7 +669,17 @@ void CLua::pushglobal(const string &name)
     if (!state())
         return;
 
-    vector<string> pieces = split_string(".", name);
+    // Named call sites (the autofight and choice hooks especially) resolve
+    // the same dotted paths over and over, so cache the split; the names are
+    // call-site literals, so the cache stays small. The actual lookup still
+    // walks _G every time, so redefining a hook mid-session works as before.
+    auto cached = pushglobal_pieces.find(name);
+    if (cached == pushglobal_pieces.end())
+    {
+        cached = pushglobal_pieces.insert(
+                    make_pair(name, split_string(".", name))).first;
+    }
+    const vector<string> &pieces = cached->second;
     if (pieces.empty())
         lua_pushnil(_state);
 
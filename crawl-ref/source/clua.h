@@ -6,6 +6,8 @@ extern "C" {
 #include <lualib.h>
 }
 
+#include "luajit-compat.h"
+
 #include <cstdarg>
 #include <cstdio>
 #include <map>
@@ -173,6 +175,8 @@ private:
     lua_State *_state;
     typedef set<string> sfset;
     sfset sourced_files;
+    // Cache of dotted names split for pushglobal(); see there.
+    map<string, vector<string>> pushglobal_pieces;
     unsigned int uniqindex;
 
     vector<lua_shutdown_listener*> shutdown_listeners;
@@ -198,6 +198,20 @@ struct coord_def
     }
 };
 
+// The eight compass neighbours plus the origin, clockwise from north -
+// the same order as run_dir_type. The Compass global in directn.h refers
+// to this array; it lives here so adjacency iteration and other
+// coordinate math can use it without pulling in the targeting headers.
+constexpr coord_def COMPASS_DELTA[9] =
+{
+    // kuln
+    {0, -1}, {1, -1}, {1, 0}, {1, 1},
+    // jbhy
+    {0, 1}, {-1, 1}, {-1, 0}, {-1, -1},
+    // .
+    {0, 0}
+};
+
 typedef pair<coord_def, int> coord_weight;
 
 inline ostream& operator << (ostream& ostr, coord_def const& value)
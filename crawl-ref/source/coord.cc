@@ -8,21 +8,6 @@
 //////////////////////////////////////////////////////////////////////////
 // coord_def
 
-int grid_distance(const coord_def& p1, const coord_def& p2)
-{
-    return (p2 - p1).rdist();
-}
-
-int distance2(const coord_def& p1, const coord_def& p2)
-{
-    return (p2 - p1).abs();
-}
-
-bool adjacent(const coord_def& p1, const coord_def& p2)
-{
-    return grid_distance(p1, p2) <= 1;
-}
-
 bool map_bounds_with_margin(coord_def p, int margin)
 {
     return p.x >= X_BOUND_1 + margin && p.x <= X_BOUND_2 - margin
@@ -96,8 +81,6 @@ coord_def clamp_in_bounds(const coord_def &p)
         min(Y_BOUND_2 - 1, max(Y_BOUND_1 + 1, p.y)));
 }
 
-extern const struct coord_def Compass[9];
-
 // Returns an array of coordinates representing a given number of spaces rotated
 // around a given direction and center point, optionally with a selector function.
 vector<coord_def> get_ring_spots(const coord_def& center, const coord_def& aim, int num,
@@ -111,7 +94,7 @@ vector<coord_def> get_ring_spots(const coord_def& center, const coord_def& aim,
     int dir = 0;
     for (int i = 0; i < 8; ++i)
     {
-        if (Compass[i] == delta)
+        if (COMPASS_DELTA[i] == delta)
         {
             dir = i;
             break;
@@ -126,7 +109,7 @@ vector<coord_def> get_ring_spots(const coord_def& center, const coord_def& aim,
     for (int i = start; i < start + num; ++i)
     {
         const int index = i % 8;
-        const coord_def spot = center + Compass[index];
+        const coord_def spot = center + COMPASS_DELTA[index];
 
         // Ensure that this spot satisfies our given criteria
         if (in_bounds(spot) && is_okay(spot))
@@ -56,9 +56,22 @@ static inline bool show_bounds(const coord_def &p)
            && p.y >= 0 && p.y < ENV_SHOW_DIAMETER;
 }
 
-int grid_distance(const coord_def& p1, const coord_def& p2) PURE;
-int distance2(const coord_def& p1, const coord_def& p2) PURE;
-bool adjacent(const coord_def& p1, const coord_def& p2) PURE;
+// Chebyshev (movement-step) distance.
+constexpr int grid_distance(const coord_def& p1, const coord_def& p2)
+{
+    return (p2 - p1).rdist();
+}
+
+// Squared euclidean distance.
+constexpr int distance2(const coord_def& p1, const coord_def& p2)
+{
+    return (p2 - p1).abs();
+}
+
+constexpr bool adjacent(const coord_def& p1, const coord_def& p2)
+{
+    return grid_distance(p1, p2) <= 1;
+}
 
 // Conversion between different coordinate systems.
 // XXX: collect all of these here?
@@ -167,6 +167,44 @@ void random_rectangle_iterator::operator++(int)
 /*
  *  radius iterator
  */
+
+// Offset tables for square circles (rdist <= r) up to LOS_RADIUS,
+// listing offsets in exactly the order the coroutine in operator++
+// would visit them. Map-bounds clipping still happens per iteration,
+// since it depends on the center.
+static vector<coord_def> _square_offsets[LOS_RADIUS + 1];
+
+static const vector<coord_def>* _get_square_offsets(int r)
+{
+    if (r < 0 || r > LOS_RADIUS)
+        return nullptr;
+    vector<coord_def> &offs = _square_offsets[r];
+    if (offs.empty())
+    {
+        for (int y = 0; y <= r; ++y)
+            for (int x = 0; x <= r; ++x)
+            {
+                offs.emplace_back(x, y);
+                if (y)
+                    offs.emplace_back(x, -y);
+                if (x)
+                {
+                    offs.emplace_back(-x, y);
+                    if (y)
+                        offs.emplace_back(-x, -y);
+                }
+            }
+    }
+    return &offs;
+}
+
+const vector<coord_def> &square_radius_offsets(int r)
+{
+    const vector<coord_def>* offs = _get_square_offsets(r);
+    ASSERT(offs);
+    return *offs;
+}
+
 radius_iterator::radius_iterator(const coord_def _center, int r,
                                  circle_type ctype,
                                  bool _exclude_center)
@@ -183,6 +221,8 @@ radius_iterator::radius_iterator(const coord_def _center, int r,
     case C_SQUARE: credit = r; break;
     }
     is_square = (ctype == C_SQUARE);
+    offsets = is_square ? _get_square_offsets(credit) : nullptr;
+    offset_idx = -1;
     ++(*this);
     if (_exclude_center)
         ++(*this);
@@ -198,6 +238,8 @@ radius_iterator::radius_iterator(const coord_def _center,
     ASSERT(map_bounds(_center));
     credit = get_los_radius();
     is_square = true;
+    offsets = _get_square_offsets(credit);
+    offset_idx = -1;
     ++(*this);
     if (_exclude_center)
         ++(*this);
@@ -221,6 +263,8 @@ radius_iterator::radius_iterator(const coord_def _center,
     case C_SQUARE: credit = r; break;
     }
     is_square = (ctype == C_SQUARE);
+    offsets = is_square ? _get_square_offsets(credit) : nullptr;
+    offset_idx = -1;
     ++(*this);
     if (_exclude_center)
         ++(*this);
@@ -254,6 +298,24 @@ const coord_def* radius_iterator::operator->() const
 
 void radius_iterator::operator++()
 {
+    if (offsets)
+    {
+        while (++offset_idx < (int)offsets->size())
+        {
+            const coord_def &off = (*offsets)[offset_idx];
+            current = center + off;
+            if (current.x < 0 || current.x >= GXM
+                || current.y < 0 || current.y >= GYM)
+            {
+                continue;
+            }
+            if (!los || cell_see_cell(center, current, los))
+                return;
+        }
+        state = RI_DONE;
+        return;
+    }
+
     cobegin(RI_START);
 
     base_cost = is_square ? 1 : -1;
@@ -315,41 +377,6 @@ void vision_iterator::operator++(int)
     ++(*this);
 }
 
-/*
- *  adjacent iterator
- */
-extern const struct coord_def Compass[9];
-
-adjacent_iterator::operator bool() const
-{
-    return i >= 0;
-}
-
-coord_def adjacent_iterator::operator *() const
-{
-    return val;
-}
-
-const coord_def* adjacent_iterator::operator->() const
-{
-    return &val;
-}
-
-void adjacent_iterator::operator ++()
-{
-    while (--i >= 0)
-    {
-        val = center + Compass[i];
-        if (map_bounds(val))
-            return;
-    }
-}
-
-void adjacent_iterator::operator++(int)
-{
-    ++(*this);
-}
-
 /*
  *  spiral iterator
  */
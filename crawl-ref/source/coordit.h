@@ -1,6 +1,7 @@
 #pragma once
 
 #include "actor.h"
+#include "coord.h" // map_bounds
 #include "coord-circle.h"
 #include "los-type.h"
 
@@ -89,8 +90,17 @@ private:
     coord_def center;
     los_type los;
     coord_def current;    // storage for operator->
+
+    // Fast path for square circles of at most LOS_RADIUS: walk a
+    // precomputed offset table instead of running the coroutine.
+    const vector<coord_def>* offsets;
+    int offset_idx;
 };
 
+// The offsets a square radius_iterator of radius r (<= LOS_RADIUS) visits,
+// in visiting order. Map-bounds clipping is up to the caller.
+const vector<coord_def> &square_radius_offsets(int r);
+
 /**
  * @class vision_iterator
  * Iterator over coordinates in view of a certain actor.
@@ -116,12 +126,20 @@ public:
     adjacent_iterator(const coord_def pos, bool _exclude_center = true)
         : center(pos), i(_exclude_center ? 8 : 9) {++(*this);};
 
-    operator bool() const PURE;
-    coord_def operator *() const PURE;
-    const coord_def *operator->() const PURE;
-
-    void operator ++ ();
-    void operator ++ (int);
+    operator bool() const { return i >= 0; }
+    coord_def operator *() const { return val; }
+    const coord_def *operator->() const { return &val; }
+
+    void operator ++ ()
+    {
+        while (--i >= 0)
+        {
+            val = center + COMPASS_DELTA[i];
+            if (map_bounds(val))
+                return;
+        }
+    }
+    void operator ++ (int) { ++(*this); }
 private:
     coord_def center;
     coord_def val;
@@ -13,6 +13,9 @@ void write_stack_trace(FILE* file);
 void call_gdb(FILE *file);
 void disable_other_crashes();
 void do_crash_dump();
+
+void slow_turn_watchdog_start();
+void slow_turn_watchdog_end();
 void crash_signal_handler(int sig_num);
 
 void watchdog();
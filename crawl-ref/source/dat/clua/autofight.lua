@@ -317,20 +317,22 @@ local function is_excluded_pos(x, y)
 end
 
 local function get_target(no_move, check_paths)
-  local los_radius = you.los()
   local x, y, bestx, besty, best_info, new_info
   bestx = 0
   besty = 0
   best_info = nil
-  for x = -los_radius,los_radius do
-    for y = -los_radius,los_radius do
-      if not is_excluded_pos(x, y) and autofight.is_candidate_for_attack(x, y, no_move, check_paths) then
-        new_info = get_monster_info(x, y, no_move)
-        if (not best_info) or compare_monster_info(new_info, best_info) then
-          bestx = x
-          besty = y
-          best_info = new_info
-        end
+  -- The candidate check runs natively over the whole view in one call;
+  -- only actual candidates come back across the Lua boundary for scoring.
+  local candidates = autofight.attack_candidates(no_move, check_paths)
+  for i = 1, #candidates, 2 do
+    x = candidates[i]
+    y = candidates[i + 1]
+    if not is_excluded_pos(x, y) then
+      new_info = get_monster_info(x, y, no_move)
+      if (not best_info) or compare_monster_info(new_info, best_info) then
+        bestx = x
+        besty = y
+        best_info = new_info
       end
     end
   end
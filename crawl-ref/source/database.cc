@@ -65,9 +65,13 @@ public:
 static void _store_text_db(const string &in, DBM *db);
 
 static string _query_database(TextDB &db, string key, bool canonicalise_key,
-                              bool run_lua, bool untranslated = false);
+                              bool run_lua, bool untranslated = false,
+                              bool *ran_lua = nullptr);
 static void _add_entry(DBM *db, const string &k, string &v);
 
+// Session cache of expanded long descriptions; see getLongDescription().
+static map<string, string> _desc_cache;
+
 static TextDB AllDBs[] =
 {
     TextDB("descriptions", "descript/",
@@ -348,6 +352,7 @@ void databaseSystemInit()
 
 void databaseSystemShutdown()
 {
+    _desc_cache.clear();
     for (unsigned int i = 0; i < NUM_DB; i++)
         AllDBs[i].shutdown(true);
 }
@@ -467,7 +472,7 @@ static void _execute_embedded_lua(string &str)
 
 static void _substitute_descriptions(TextDB &db, string &str,
                                      bool canonicalise_key, bool run_lua,
-                                     bool untranslated)
+                                     bool untranslated, bool *ran_lua)
 {
     // Replace all keys found between "[[" and "]]" with corresponding
     // descriptions from the database.
@@ -483,7 +488,7 @@ static void _substitute_descriptions(TextDB &db, string &str,
 
         string key = str.substr(pos + 2, end - pos - 2);
         string result = _query_database(db, key, canonicalise_key,
-                                        run_lua, untranslated);
+                                        run_lua, untranslated, ran_lua);
         str.replace(pos, key.length() + 4, trim_string_right(result));
 
         pos = str.find("[[", pos + result.length());
@@ -736,7 +741,7 @@ static void _call_recursive_replacement(string &str, TextDB &db,
 }
 
 static string _query_database(TextDB &db, string key, bool canonicalise_key,
-                              bool run_lua, bool untranslated)
+                              bool run_lua, bool untranslated, bool *ran_lua)
 {
     if (canonicalise_key)
     {
@@ -764,13 +769,19 @@ static string _query_database(TextDB &db, string key, bool canonicalise_key,
         && str.find('\n') == str.size() - 1)
     {
         return _query_database(db, str.substr(1, str.size() - 3),
-                               canonicalise_key, run_lua, untranslated);
+                               canonicalise_key, run_lua, untranslated,
+                               ran_lua);
     }
 
-    _substitute_descriptions(db, str, canonicalise_key, run_lua, untranslated);
+    _substitute_descriptions(db, str, canonicalise_key, run_lua, untranslated,
+                             ran_lua);
 
     if (run_lua)
+    {
+        if (ran_lua && str.find("{{") != string::npos)
+            *ran_lua = true;
         _execute_embedded_lua(str);
+    }
 
     return str;
 }
@@ -788,7 +799,23 @@ string getQuoteString(const string &key)
 
 string getLongDescription(const string &key)
 {
-    return unwrap_desc(_query_database(DescriptionDB, key, true, true));
+    // Examine popups reassemble the same description text every time
+    // they're shown, and each lookup costs several dbm fetches plus the
+    // [[...]] expansion. The expanded text is fixed for the session
+    // except where it runs embedded Lua, so cache everything that
+    // didn't: repeated xv on the same monster or item then skips the
+    // database entirely.
+    string canonical = lowercase_string(key);
+    auto cached = _desc_cache.find(canonical);
+    if (cached != _desc_cache.end())
+        return cached->second;
+
+    bool ran_lua = false;
+    string desc = unwrap_desc(_query_database(DescriptionDB, key, true, true,
+                                              false, &ran_lua));
+    if (!ran_lua)
+        _desc_cache[canonical] = desc;
+    return desc;
 }
 
 vector<string> getLongDescKeysByRegex(const string &regex,
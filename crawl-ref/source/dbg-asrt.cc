@@ -6,9 +6,11 @@
 #include "AppHdr.h"
 
 #include <cerrno>
+#include <chrono>
 #include <csignal>
 
 #include "abyss.h"
+#include "act-iter.h"
 #include "chardump.h"
 #include "coordit.h"
 #include "crash.h"
@@ -23,6 +25,8 @@
 #include "initfile.h"
 #include "item-name.h"
 #include "jobs.h"
+#include "level-id.h"
+#include "macro.h"
 #include "mapmark.h"
 #include "message.h"
 #include "misc.h"
@@ -32,10 +36,12 @@
 #include "spl-util.h"
 #include "state.h"
 #include "stringutil.h"
+#include "syscalls.h"
 #include "tiles-build-specific.h"
 #include "travel.h"
 #include "version.h"
 #include "view.h"
+#include "zone-profile.h"
 
 #if defined(TARGET_OS_WINDOWS) || defined(TARGET_COMPILER_MINGW)
 #define NOCOMM            /* Comm driver APIs and definitions */
@@ -781,6 +787,86 @@ void do_crash_dump()
         fclose(file);
 }
 
+///////////////////////////////////////////////////////////////////////
+
+// Slow-turn watchdog. world_reacts() brackets each player-visible turn
+// with these; when a turn blows the slow_turn_budget_ms option, a
+// structured report goes to the morgue directory through the same file
+// naming and dump helpers the crash reports use, so server operators
+// get a ticketable artefact instead of player hearsay.
+
+static int64_t _now_us()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(
+            steady_clock::now().time_since_epoch()).count();
+}
+
+void slow_turn_watchdog_start()
+{
+    if (Options.slow_turn_budget_ms <= 0)
+        return;
+    crawl_state.turn_began_us = _now_us();
+}
+
+void slow_turn_watchdog_end()
+{
+    if (Options.slow_turn_budget_ms <= 0 || !crawl_state.turn_began_us)
+        return;
+
+    const int64_t elapsed_us = _now_us() - crawl_state.turn_began_us;
+    crawl_state.turn_began_us = 0;
+    if (elapsed_us < (int64_t)Options.slow_turn_budget_ms * 1000)
+        return;
+
+    const time_t t = time(nullptr);
+    string dir = (!Options.morgue_dir.empty() ? Options.morgue_dir :
+                  !SysEnv.crawl_dir.empty()   ? SysEnv.crawl_dir
+                                              : "");
+    if (!dir.empty() && dir[dir.length() - 1] != FILE_SEPARATOR)
+        dir += FILE_SEPARATOR;
+
+    char name[180] = {};
+    snprintf(name, sizeof(name), "%sslowturn-%s-%s.txt", dir.c_str(),
+             you.your_name.c_str(), make_file_time(t).c_str());
+
+    FILE *file = fopen_u(name, "a");
+    if (!file)
+        return;
+
+    fprintf(file, "Slow turn: %d ms (budget %d ms)\n\n",
+            (int)(elapsed_us / 1000), Options.slow_turn_budget_ms);
+
+    _dump_ver_stuff(file);
+
+    int mon_count = 0;
+    for (monster_iterator mi; mi; ++mi)
+        ++mon_count;
+
+    fprintf(file, "Turn: %d (elapsed time %d)\n", you.num_turns,
+            you.elapsed_time);
+    fprintf(file, "Level: %s\n", level_id::current().describe().c_str());
+    fprintf(file, "Monsters on level: %d\n", mon_count);
+    fprintf(file, "Last command: %s\n\n",
+            command_to_name(crawl_state.prev_cmd).c_str());
+
+#ifdef ZONE_PROFILING
+    fprintf(file, "Zone timings:\n%s\n", perf_zone_report(true).c_str());
+#else
+    fprintf(file, "Zone timings unavailable "
+                  "(built without ZONE_PROFILING).\n");
+#endif
+
+    fprintf(file, "Recent messages:\n<<<<<<<<<<<<<<<<<<<<<<\n");
+    fprintf(file, "%s", get_last_messages(NUM_STORED_MESSAGES, true).c_str());
+    fprintf(file, ">>>>>>>>>>>>>>>>>>>>>>\n");
+
+    fclose(file);
+
+    mprf(MSGCH_DIAGNOSTICS, "Slow turn (%d ms); report written to %s.",
+         (int)(elapsed_us / 1000), name);
+}
+
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
 
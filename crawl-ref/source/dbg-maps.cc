@@ -7,6 +7,11 @@
 
 #include "dbg-maps.h"
 
+#if defined(UNIX)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include "branch.h"
 #include "chardump.h"
 #include "crash.h"
@@ -26,6 +31,7 @@
 #include "stringutil.h"
 #include "syscalls.h"
 #include "tag-version.h"
+#include "tags.h"
 #include "view.h"
 
 #ifdef DEBUG_STATISTICS
@@ -50,6 +56,10 @@ static int build_attempts = 0, level_vetoes = 0;
 // Map from message to counts.
 static map<string, int> veto_messages;
 
+// False in all but the first of parallel worker processes, to keep the
+// progress display and the escape-to-cancel check out of the others.
+static bool _mapstat_interactive = true;
+
 void mapstat_report_map_build_start()
 {
     build_attempts++;
@@ -77,19 +87,23 @@ static bool _is_disconnected_level()
 
 static bool _do_build_level()
 {
-    clear_messages();
-    mprf("On %s; %d g, %d fail, %u err%s, %u uniq, "
-         "%d try, %d (%.2f%%) vetos",
-         level_id::current().describe().c_str(), levels_tried, levels_failed,
-         (unsigned int)errors.size(), last_error.empty() ? ""
-         : (" (" + last_error + ")").c_str(), (unsigned int) use_count.size(),
-         build_attempts, level_vetoes,
-         build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
+    if (_mapstat_interactive)
+    {
+        clear_messages();
+        mprf("On %s; %d g, %d fail, %u err%s, %u uniq, "
+             "%d try, %d (%.2f%%) vetos",
+             level_id::current().describe().c_str(), levels_tried,
+             levels_failed, (unsigned int)errors.size(), last_error.empty()
+             ? "" : (" (" + last_error + ")").c_str(),
+             (unsigned int) use_count.size(),
+             build_attempts, level_vetoes,
+             build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
+    }
 
     watchdog();
 
     msg::suppress mx;
-    if (kbhit() && key_is_escape(getch_ck()))
+    if (_mapstat_interactive && kbhit() && key_is_escape(getch_ck()))
     {
         mprf(MSGCH_WARN, "User requested cancel");
         return false;
@@ -234,24 +248,23 @@ static bool _build_dungeon()
  * builder() fails, as the level may be in an invalid state and any object
  * statistics erroneous.
 */
-bool mapstat_build_levels()
+static bool _mapstat_run_iterations(int niters)
 {
-    if (!generated_levels.size())
-        _dungeon_places();
-    printf("Iteration: ");
-    fflush(stdout);
-    for (int i = 0; i < SysEnv.map_gen_iters; ++i)
+    for (int i = 0; i < niters; ++i)
     {
-        clear_messages();
-        mprf("On %d of %d; %d g, %d fail, %u err%s, %u uniq, "
-             "%d try, %d (%.2f%%) vetoes",
-             i, SysEnv.map_gen_iters, levels_tried, levels_failed,
-             (unsigned int)errors.size(),
-             last_error.empty() ? "" : (" (" + last_error + ")").c_str(),
-             (unsigned int)use_count.size(), build_attempts, level_vetoes,
-             build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
-        printf("%d..", i + 1);
-        fflush(stdout);
+        if (_mapstat_interactive)
+        {
+            clear_messages();
+            mprf("On %d of %d; %d g, %d fail, %u err%s, %u uniq, "
+                 "%d try, %d (%.2f%%) vetoes",
+                 i, niters, levels_tried, levels_failed,
+                 (unsigned int)errors.size(),
+                 last_error.empty() ? "" : (" (" + last_error + ")").c_str(),
+                 (unsigned int)use_count.size(), build_attempts, level_vetoes,
+                 build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
+            printf("%d..", i + 1);
+            fflush(stdout);
+        }
 
         // At the end of each iteration, the lua state is closed, so we
         // re-initialize what we need. Skip this for the first iteration,
@@ -282,6 +295,227 @@ bool mapstat_build_levels()
 
         dlua.close();
     }
+    return true;
+}
+
+#if defined(UNIX)
+static void _marshall_count_map(writer &outf, const map<string, int> &counts)
+{
+    marshallInt(outf, (int)counts.size());
+    for (const auto &entry : counts)
+    {
+        marshallString(outf, entry.first);
+        marshallInt(outf, entry.second);
+    }
+}
+
+static void _merge_count_map(reader &inf, map<string, int> &counts)
+{
+    for (int n = unmarshallInt(inf); n > 0; --n)
+    {
+        const string key = unmarshallString(inf);
+        counts[key] += unmarshallInt(inf);
+    }
+}
+
+// Serialize every tally a worker process collected, so the parent can
+// fold it into its own (still empty) tables. Must mirror
+// _merge_mapstat_stats() field for field.
+static void _marshall_mapstat_stats(writer &outf)
+{
+    marshallInt(outf, levels_tried);
+    marshallInt(outf, levels_failed);
+    marshallInt(outf, build_attempts);
+    marshallInt(outf, level_vetoes);
+    marshallString(outf, last_error);
+    _marshall_count_map(outf, try_count);
+    _marshall_count_map(outf, use_count);
+    _marshall_count_map(outf, success_count);
+    _marshall_count_map(outf, veto_messages);
+    marshallInt(outf, (int)errors.size());
+    for (const auto &entry : errors)
+    {
+        marshallString(outf, entry.first);
+        marshallString(outf, entry.second);
+    }
+    marshallInt(outf, (int)level_mapcounts.size());
+    for (const auto &entry : level_mapcounts)
+    {
+        marshall_level_id(outf, entry.first);
+        marshallInt(outf, entry.second);
+    }
+    marshallInt(outf, (int)map_builds.size());
+    for (const auto &entry : map_builds)
+    {
+        marshall_level_id(outf, entry.first);
+        marshallInt(outf, entry.second.first);
+        marshallInt(outf, entry.second.second);
+    }
+    marshallInt(outf, (int)level_mapsused.size());
+    for (const auto &entry : level_mapsused)
+    {
+        marshall_level_id(outf, entry.first);
+        marshallInt(outf, (int)entry.second.size());
+        for (const string &name : entry.second)
+            marshallString(outf, name);
+    }
+    marshallInt(outf, (int)map_levelsused.size());
+    for (const auto &entry : map_levelsused)
+    {
+        marshallString(outf, entry.first);
+        marshallInt(outf, (int)entry.second.size());
+        for (const level_id &lid : entry.second)
+            marshall_level_id(outf, lid);
+    }
+}
+
+static void _merge_mapstat_stats(reader &inf)
+{
+    levels_tried += unmarshallInt(inf);
+    levels_failed += unmarshallInt(inf);
+    build_attempts += unmarshallInt(inf);
+    level_vetoes += unmarshallInt(inf);
+    const string worker_error = unmarshallString(inf);
+    if (!worker_error.empty())
+        last_error = worker_error;
+    _merge_count_map(inf, try_count);
+    _merge_count_map(inf, use_count);
+    _merge_count_map(inf, success_count);
+    _merge_count_map(inf, veto_messages);
+    for (int n = unmarshallInt(inf); n > 0; --n)
+    {
+        const string key = unmarshallString(inf);
+        errors[key] = unmarshallString(inf);
+    }
+    for (int n = unmarshallInt(inf); n > 0; --n)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        level_mapcounts[lid] += unmarshallInt(inf);
+    }
+    for (int n = unmarshallInt(inf); n > 0; --n)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        pair<int, int> &counts(map_builds[lid]);
+        counts.first += unmarshallInt(inf);
+        counts.second += unmarshallInt(inf);
+    }
+    for (int n = unmarshallInt(inf); n > 0; --n)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        set<string> &names(level_mapsused[lid]);
+        for (int k = unmarshallInt(inf); k > 0; --k)
+            names.insert(unmarshallString(inf));
+    }
+    for (int n = unmarshallInt(inf); n > 0; --n)
+    {
+        const string name = unmarshallString(inf);
+        set<level_id> &lids(map_levelsused[name]);
+        for (int k = unmarshallInt(inf); k > 0; --k)
+            lids.insert(unmarshall_level_id(inf));
+    }
+}
+
+// Split the mapstat/objstat iterations over forked worker processes and
+// merge their tallies. Each worker reseeds from system randomness every
+// iteration (as the serial loop does), so workers' levels are
+// independent; -iters already refuses to combine multiple iterations
+// with a fixed seed.
+static bool _mapstat_build_levels_parallel(int jobs)
+{
+    if (jobs > SysEnv.map_gen_iters)
+        jobs = SysEnv.map_gen_iters;
+
+    printf("Running %d iteration(s) over %d worker process(es).\n",
+           SysEnv.map_gen_iters, jobs);
+    printf("Iteration: ");
+    fflush(stdout);
+
+    vector<pid_t> workers;
+    vector<int> stat_fds;
+    for (int job = 0; job < jobs; ++job)
+    {
+        const int niters = SysEnv.map_gen_iters / jobs
+                           + (job < SysEnv.map_gen_iters % jobs ? 1 : 0);
+        int fds[2];
+        if (pipe(fds))
+            end(1, true, "Unable to create mapstat worker pipe");
+        const pid_t worker = fork();
+        if (worker == -1)
+            end(1, true, "Unable to fork mapstat worker");
+        if (!worker)
+        {
+            // Worker: run our share of the iterations and marshall the
+            // tallies up the pipe. Only the first worker reports progress.
+            close(fds[0]);
+            _mapstat_interactive = (job == 0);
+            const bool success = _mapstat_run_iterations(niters);
+            FILE *statf = fdopen(fds[1], "wb");
+            if (!statf)
+                _exit(1);
+            writer outf("mapstat worker pipe", statf);
+            _marshall_mapstat_stats(outf);
+            if (crawl_state.obj_stat_gen)
+                objstat_marshall_stats(outf);
+            fclose(statf);
+            _exit(success ? 0 : 1);
+        }
+        close(fds[1]);
+        workers.push_back(worker);
+        stat_fds.push_back(fds[0]);
+    }
+
+    // Drain the pipes before waiting: a worker with more stats than fit
+    // in a pipe buffer can't exit until we read them.
+    for (int job = 0; job < jobs; ++job)
+    {
+        FILE *statf = fdopen(stat_fds[job], "rb");
+        if (!statf)
+            end(1, true, "Unable to read mapstat worker pipe");
+        try
+        {
+            reader inf(statf);
+            inf.set_safe_read(true);
+            _merge_mapstat_stats(inf);
+            if (crawl_state.obj_stat_gen)
+                objstat_merge_stats(inf);
+        }
+        catch (const short_read_exception &)
+        {
+            // The worker died before reporting; its exit status will say
+            // so below.
+        }
+        fclose(statf);
+    }
+
+    bool ok = true;
+    for (int job = 0; job < jobs; ++job)
+    {
+        int status = 0;
+        if (waitpid(workers[job], &status, 0) != workers[job]
+            || !WIFEXITED(status) || WEXITSTATUS(status))
+        {
+            ok = false;
+        }
+    }
+    if (ok)
+        printf("Finished.\n");
+    fflush(stdout);
+    return ok;
+}
+#endif // defined(UNIX)
+
+bool mapstat_build_levels()
+{
+    if (!generated_levels.size())
+        _dungeon_places();
+#if defined(UNIX)
+    if (SysEnv.map_gen_jobs > 1)
+        return _mapstat_build_levels_parallel(SysEnv.map_gen_jobs);
+#endif
+    printf("Iteration: ");
+    fflush(stdout);
+    if (!_mapstat_run_iterations(SysEnv.map_gen_iters))
+        return false;
     printf("Finished.\n");
     fflush(stdout);
     return true;
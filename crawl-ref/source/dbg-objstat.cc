@@ -40,6 +40,7 @@
 #include "stringutil.h"
 #include "syscalls.h"
 #include "tag-version.h"
+#include "tags.h"
 #include "version.h"
 
 #ifdef DEBUG_STATISTICS
@@ -1076,6 +1077,208 @@ void objstat_iteration_stats()
     }
 }
 
+#if defined(UNIX)
+// Serialization of the objstat tables, so that the forked mapstat
+// workers (see _mapstat_build_levels_parallel) can report their tallies
+// for merging. All fields are additive sums across iterations except
+// the NumMin/NumMax extremes, which merge by min/max; the derived
+// values (SD, means, chances) are only computed from the merged sums at
+// output time, so they need no special handling here.
+
+static int _merge_field(const string &field, int ours, int theirs)
+{
+    if (field == "NumMin")
+        return min(ours, theirs);
+    if (field == "NumMax")
+        return max(ours, theirs);
+    return ours + theirs;
+}
+
+static void _marshall_field_map(writer &outf, const map<string, int> &fields)
+{
+    marshallInt(outf, (int)fields.size());
+    for (const auto &entry : fields)
+    {
+        marshallString(outf, entry.first);
+        marshallInt(outf, entry.second);
+    }
+}
+
+static void _merge_field_map(reader &inf, map<string, int> &fields)
+{
+    for (int n = unmarshallInt(inf); n > 0; --n)
+    {
+        const string field = unmarshallString(inf);
+        const int value = unmarshallInt(inf);
+        auto it = fields.find(field);
+        if (it == fields.end())
+            fields[field] = value;
+        else
+            it->second = _merge_field(field, it->second, value);
+    }
+}
+
+void objstat_marshall_stats(writer &outf)
+{
+    marshallInt(outf, (int)item_recs.size());
+    for (const auto &lentry : item_recs)
+    {
+        marshall_level_id(outf, lentry.first);
+        marshallInt(outf, (int)lentry.second.size());
+        for (const auto &bentry : lentry.second)
+        {
+            marshallInt(outf, bentry.first);
+            marshallInt(outf, (int)bentry.second.size());
+            for (const auto &sentry : bentry.second)
+            {
+                marshallInt(outf, sentry.first);
+                _marshall_field_map(outf, sentry.second);
+            }
+        }
+    }
+
+    marshallInt(outf, (int)brand_recs.size());
+    for (const auto &lentry : brand_recs)
+    {
+        marshall_level_id(outf, lentry.first);
+        marshallInt(outf, (int)lentry.second.size());
+        for (const auto &bentry : lentry.second)
+        {
+            marshallInt(outf, bentry.first);
+            marshallInt(outf, (int)bentry.second.size());
+            for (const auto &sentry : bentry.second)
+            {
+                marshallInt(outf, sentry.first);
+                marshallInt(outf, (int)sentry.second.size());
+                for (const auto &centry : sentry.second)
+                {
+                    marshallInt(outf, centry.first);
+                    marshallInt(outf, (int)centry.second.size());
+                    for (const auto &brentry : centry.second)
+                    {
+                        marshallInt(outf, brentry.first);
+                        marshallInt(outf, brentry.second);
+                    }
+                }
+            }
+        }
+    }
+
+    marshallInt(outf, (int)monster_recs.size());
+    for (const auto &lentry : monster_recs)
+    {
+        marshall_level_id(outf, lentry.first);
+        marshallInt(outf, (int)lentry.second.size());
+        for (const auto &mentry : lentry.second)
+        {
+            marshallInt(outf, mentry.first);
+            _marshall_field_map(outf, mentry.second);
+        }
+    }
+
+    marshallInt(outf, (int)feature_recs.size());
+    for (const auto &lentry : feature_recs)
+    {
+        marshall_level_id(outf, lentry.first);
+        marshallInt(outf, (int)lentry.second.size());
+        for (const auto &fentry : lentry.second)
+        {
+            marshallInt(outf, fentry.first);
+            _marshall_field_map(outf, fentry.second);
+        }
+    }
+
+    marshallInt(outf, (int)spell_recs.size());
+    for (const auto &lentry : spell_recs)
+    {
+        marshall_level_id(outf, lentry.first);
+        marshallInt(outf, (int)lentry.second.size());
+        for (const auto &sentry : lentry.second)
+        {
+            marshallInt(outf, sentry.first);
+            _marshall_field_map(outf, sentry.second);
+        }
+    }
+}
+
+void objstat_merge_stats(reader &inf)
+{
+    for (int l = unmarshallInt(inf); l > 0; --l)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        for (int b = unmarshallInt(inf); b > 0; --b)
+        {
+            const item_base_type base_type =
+                static_cast<item_base_type>(unmarshallInt(inf));
+            for (int s = unmarshallInt(inf); s > 0; --s)
+            {
+                const int sub_type = unmarshallInt(inf);
+                _merge_field_map(inf, item_recs[lid][base_type][sub_type]);
+            }
+        }
+    }
+
+    for (int l = unmarshallInt(inf); l > 0; --l)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        for (int b = unmarshallInt(inf); b > 0; --b)
+        {
+            const item_base_type base_type =
+                static_cast<item_base_type>(unmarshallInt(inf));
+            for (int s = unmarshallInt(inf); s > 0; --s)
+            {
+                const int sub_type = unmarshallInt(inf);
+                for (int c = unmarshallInt(inf); c > 0; --c)
+                {
+                    const stat_category_type cat =
+                        static_cast<stat_category_type>(unmarshallInt(inf));
+                    map<int, int> &brands =
+                        brand_recs[lid][base_type][sub_type][cat];
+                    for (int k = unmarshallInt(inf); k > 0; --k)
+                    {
+                        const int brand = unmarshallInt(inf);
+                        brands[brand] += unmarshallInt(inf);
+                    }
+                }
+            }
+        }
+    }
+
+    for (int l = unmarshallInt(inf); l > 0; --l)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        for (int m = unmarshallInt(inf); m > 0; --m)
+        {
+            const monster_type mc =
+                static_cast<monster_type>(unmarshallInt(inf));
+            _merge_field_map(inf, monster_recs[lid][mc]);
+        }
+    }
+
+    for (int l = unmarshallInt(inf); l > 0; --l)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        for (int f = unmarshallInt(inf); f > 0; --f)
+        {
+            const dungeon_feature_type feat =
+                static_cast<dungeon_feature_type>(unmarshallInt(inf));
+            _merge_field_map(inf, feature_recs[lid][feat]);
+        }
+    }
+
+    for (int l = unmarshallInt(inf); l > 0; --l)
+    {
+        const level_id lid = unmarshall_level_id(inf);
+        for (int s = unmarshallInt(inf); s > 0; --s)
+        {
+            const spell_type spell =
+                static_cast<spell_type>(unmarshallInt(inf));
+            _merge_field_map(inf, spell_recs[lid][spell]);
+        }
+    }
+}
+#endif // defined(UNIX)
+
 static FILE * _open_stat_file(string stat_file)
 {
     FILE *stat_fh = nullptr;
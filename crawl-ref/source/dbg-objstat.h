@@ -5,10 +5,17 @@
 
 #pragma once
 
+class reader;
+class writer;
+
 #ifdef DEBUG_STATISTICS
 void objstat_record_item(const item_def &item);
 void objstat_generate_stats();
 void objstat_record_monster(const monster *mons);
 void objstat_record_feature(dungeon_feature_type feat_type, bool vault);
 void objstat_iteration_stats();
+#if defined(UNIX)
+void objstat_marshall_stats(writer &outf);
+void objstat_merge_stats(reader &inf);
+#endif
 #endif
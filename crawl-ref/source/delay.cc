@@ -79,6 +79,20 @@ int interrupt_block::interrupts_blocked = 0;
 
 static const char *_activity_interrupt_name(activity_interrupt ai);
 
+const FixedBitVector<NUM_ACTIVITY_INTERRUPTS> &Delay::interrupts()
+{
+    // Snapshot the option mask on first use. Interrupt dispatch runs once
+    // per event per queued delay, so repeating the map lookup (and the
+    // string key it builds from name()) per event adds up during long
+    // rest/travel delays.
+    if (!interrupt_mask_cached)
+    {
+        interrupt_mask = Options.activity_interrupts[name()];
+        interrupt_mask_cached = true;
+    }
+    return interrupt_mask;
+}
+
 static string _eq_category(const item_def &equip)
 {
     if (is_weapon(equip))
@@ -1024,7 +1038,7 @@ static bool _should_stop_activity(Delay* delay,
     }
 
     return ai == activity_interrupt::force
-           || Options.activity_interrupts[delay->name()][static_cast<int>(ai)];
+           || delay->interrupts()[static_cast<int>(ai)];
 }
 
 // Turns autopickup off if we ran into an invisible monster or saw a monster
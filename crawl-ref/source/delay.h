@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "activity-interrupt-type.h"
+#include "bitary.h"
 #include "command-type.h"
 #include "enum.h"
 #include "equipment-slot.h"
@@ -227,6 +228,18 @@ public:
      * @return the delay's name; used in debugging and for the interrupt_ option family.
      */
     virtual const char* name() const = 0;
+
+    /**
+     * @return the set of activity interrupts this delay listens for, as
+     * configured by the interrupt_ option family. Snapshotted from Options
+     * the first time an interrupt is checked against this delay, so that
+     * per-event interrupt dispatch doesn't repeat the by-name map lookup.
+     */
+    const FixedBitVector<NUM_ACTIVITY_INTERRUPTS> &interrupts();
+
+private:
+    FixedBitVector<NUM_ACTIVITY_INTERRUPTS> interrupt_mask;
+    bool interrupt_mask_cached = false;
 };
 
 class EquipOnDelay : public Delay
@@ -13,9 +13,7 @@
 
 void dgn_initialise_heightmap(int height)
 {
-    env.heightmap.reset(new grid_heightmap);
-    for (rectangle_iterator ri(0); ri; ++ri)
-        dgn_height_at(*ri) = height;
+    env.heightmap.reset(new grid_heightmap(height));
 }
 
 void dgn_height_set_at(const coord_def &c, int height)
@@ -64,20 +62,27 @@ void dgn_smooth_height_at(coord_def c, int radius, int max_height)
         return;
 
     const int max_delta = radius * radius * 2 + 2;
+    // Clamp the neighbourhood to in_bounds() territory up front: this
+    // kernel runs for every grid square (several times over, for multipass
+    // smoothing), and hoisting the bounds check lets the inner loop run
+    // straight down contiguous heightmap columns.
+    const int x0 = max(c.x - radius, X_BOUND_1 + 1);
+    const int x1 = min(c.x + radius, X_BOUND_2 - 1);
+    const int y0 = max(c.y - radius, Y_BOUND_1 + 1);
+    const int y1 = min(c.y + radius, Y_BOUND_2 - 1);
     int divisor = 0;
     int total = 0;
-    for (int y = c.y - radius; y <= c.y + radius; ++y)
+    for (int x = x0; x <= x1; ++x)
     {
-        for (int x = c.x - radius; x <= c.x + radius; ++x)
+        const int dx2 = (c.x - x) * (c.x - x);
+        const short *col = &dgn_height_at(coord_def(x, y0));
+        for (int y = y0; y <= y1; ++y, ++col)
         {
-            const coord_def p(x, y);
-            if (!in_bounds(p))
-                continue;
-            const int nheight = dgn_height_at(p);
+            const int nheight = *col;
             if (max_height != DGN_UNDEFINED_HEIGHT && nheight > max_height)
                 continue;
-            const coord_def off = c - p;
-            const int weight = max_delta - off.abs();
+            const int dy = c.y - y;
+            const int weight = max_delta - (dx2 + dy * dy);
             divisor += weight;
             total += nheight * weight;
         }
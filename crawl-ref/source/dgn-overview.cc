@@ -503,21 +503,17 @@ static string _print_altars_for_gods(const vector<god_type>& gods,
     char const *colour;
     const int columns = 4;
 
+    // Scan the notable altars list once instead of once per god.
+    bool altar_seen[NUM_GODS] = {};
+    for (const auto &entry : altars_present)
+        altar_seen[entry.second] = true;
+
     for (const god_type god : gods)
     {
         if (!player_can_join_god(god, false))
             continue;
 
-        // for each god, look through the notable altars list for a match
-        bool has_altar_been_seen = false;
-        for (const auto &entry : altars_present)
-        {
-            if (entry.second == god)
-            {
-                has_altar_been_seen = true;
-                break;
-            }
-        }
+        const bool has_altar_been_seen = altar_seen[god];
 
         // If dumping, only laundry list the seen gods
         if (!display)
@@ -654,14 +650,26 @@ static string _get_portals()
 // Loop through each branch, printing stored notes.
 static string _get_notes(bool display)
 {
+    // Collect the levels that actually carry an annotation, rather than
+    // probing every possible level in the game.
+    set<level_id> annotated;
+    for (const auto &entry : level_annotations)
+        annotated.insert(entry.first);
+    for (const auto &entry : level_exclusions)
+        annotated.insert(entry.first);
+    for (const auto &entry : level_uniques)
+        annotated.insert(entry.first);
+
     string disp;
 
     for (branch_iterator it; it; ++it)
-        for (int d = 1; d <= brdepth[it->id]; ++d)
+        for (auto i = annotated.lower_bound(level_id(it->id, 0));
+             i != annotated.end() && i->branch == it->id; ++i)
         {
-            level_id i(it->id, d);
-            if (!get_level_annotation(i).empty())
-                disp += _get_coloured_level_annotation(i) + "\n";
+            if (i->depth < 1 || i->depth > brdepth[it->id])
+                continue;
+            if (!get_level_annotation(*i).empty())
+                disp += _get_coloured_level_annotation(*i) + "\n";
         }
 
     if (disp.empty())
@@ -131,8 +131,22 @@ RiverLayout::operator()(const coord_def &p, const uint32_t offset) const
 {
     const double scale = 10000;
     const double scalar = 90.0;
-    double x = (p.x + perlin::fBM(p.x/4.0, p.y/4.0, seed, 5) * 3) / scalar;
-    double y = (p.y + perlin::fBM(p.x/4.0 + 3.7, p.y/4.0 + 1.9, seed + 4, 5) * 3) / scalar;
+    const uint64_t key = static_cast<uint64_t>(static_cast<uint32_t>(p.x)) << 32
+                         | static_cast<uint32_t>(p.y);
+    auto warp = warp_cache.find(key);
+    if (warp == warp_cache.end())
+    {
+        // Keep roughly the working set of a few map-sized regions; the
+        // cache only refills as the major coordinate drifts.
+        if (warp_cache.size() >= 16384)
+            warp_cache.clear();
+        warp = warp_cache.emplace(key, make_pair(
+                    perlin::fBM(p.x/4.0, p.y/4.0, seed, 5),
+                    perlin::fBM(p.x/4.0 + 3.7, p.y/4.0 + 1.9, seed + 4, 5)))
+               .first;
+    }
+    double x = (p.x + warp->second.first * 3) / scalar;
+    double y = (p.y + warp->second.second * 3) / scalar;
     worley::noise_datum n = worley::noise(x, y, offset / scale + seed);
     const uint32_t changepoint = offset + _get_changepoint(n, scale);
     if ((n.id[0] ^ n.id[1] ^ seed) % 4)
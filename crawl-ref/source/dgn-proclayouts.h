@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <unordered_map>
 #include <vector>
 
 #include "dungeon.h"
@@ -157,6 +158,11 @@ class RiverLayout : public ProceduralLayout
     private:
         const uint32_t seed;
         const ProceduralLayout &layout;
+        // The perlin domain warp depends only on the sample point, never
+        // on the morph offset, but costs ten noise evaluations; abyss
+        // shifts re-sample the same squares every pass, so memoize it.
+        // See RiverLayout::operator().
+        mutable unordered_map<uint64_t, pair<double, double>> warp_cache;
 };
 
 // A reimagining of the beloved newabyss layout.
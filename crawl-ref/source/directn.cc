@@ -942,12 +942,16 @@ static dist _look_around_target(const coord_def &whence)
 range_view_annotator::range_view_annotator(targeter *range)
 {
     if (range && Options.darken_beyond_range)
+    {
         crawl_state.darken_range = range;
+        invalidate_darken_range_cache();
+    }
 }
 
 range_view_annotator::~range_view_annotator()
 {
     crawl_state.darken_range = nullptr;
+    invalidate_darken_range_cache();
 }
 
 monster_view_annotator::monster_view_annotator(vector<monster *> *monsters)
@@ -1228,6 +1232,12 @@ void direction_chooser::calculate_target_info()
         }
     }
 
+    // Several foes that can't be aimed at directly may resolve to the same
+    // fallback square (which can also coincide with another foe's own
+    // position); drop duplicates so cycling has no dead stops.
+    sort(cycle_pos.begin(), cycle_pos.end());
+    cycle_pos.erase(unique(cycle_pos.begin(), cycle_pos.end()), cycle_pos.end());
+
     // Sort found targets from near to far (from the player).
     sort(cycle_pos.begin(), cycle_pos.end(), [](const coord_def& a, const coord_def& b)
     {
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "command-type.h"
+#include "coord-def.h"
 #include "enum.h"
 #include "mon-info.h"
 #include "targ-mode-type.h"
@@ -387,4 +388,5 @@ bool targeting_mouse_select(const coord_def &gc);
 bool targeting_mouse_move(const coord_def &gc);
 #endif
 
-extern const struct coord_def Compass[9];
+// Clockwise, around the compass from north (same order as run_dir_type).
+constexpr const coord_def (&Compass)[9] = COMPASS_DELTA;
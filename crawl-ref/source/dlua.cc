@@ -148,13 +148,53 @@ int dlua_chunk::check_op(CLua &interp, int err)
     return err;
 }
 
+// Registry table of closures keyed by compiled chunk, so chunks that run
+// repeatedly (map preludes, validation and veto checks, hooks) don't get
+// re-deserialized from bytecode on every run. Values are weak, so closures
+// of unloaded maps can be collected. Reusing a closure is safe because
+// dgn_run_map re-binds the map environment with setfenv before each call.
+static void _push_chunk_cache(lua_State *ls)
+{
+    lua_getfield(ls, LUA_REGISTRYINDEX, "dlua_chunk_cache");
+    if (lua_istable(ls, -1))
+        return;
+    lua_pop(ls, 1);
+    lua_newtable(ls);
+    lua_newtable(ls);
+    lua_pushstring(ls, "v");
+    lua_setfield(ls, -2, "__mode");
+    lua_setmetatable(ls, -2);
+    lua_pushvalue(ls, -1);
+    lua_setfield(ls, LUA_REGISTRYINDEX, "dlua_chunk_cache");
+}
+
 int dlua_chunk::load(CLua &interp)
 {
     if (!compiled.empty())
     {
-        return check_op(interp,
+        lua_State *ls = interp.state();
+        _push_chunk_cache(ls);
+        lua_pushlstring(ls, compiled.c_str(), compiled.length());
+        lua_rawget(ls, -2);
+        if (lua_isfunction(ls, -1))
+        {
+            lua_remove(ls, -2);
+            return 0;
+        }
+        lua_pop(ls, 2);
+
+        const int err = check_op(interp,
                          interp.loadbuffer(compiled.c_str(), compiled.length(),
                                            context.c_str()));
+        if (!err)
+        {
+            _push_chunk_cache(ls);
+            lua_pushlstring(ls, compiled.c_str(), compiled.length());
+            lua_pushvalue(ls, -3);
+            lua_rawset(ls, -3);
+            lua_pop(ls, 1);
+        }
+        return err;
     }
 
     if (empty())
@@ -179,6 +219,18 @@ int dlua_chunk::load(CLua &interp)
     return err;
 }
 
+// Compiles the chunk's source down to bytecode without running it, so that
+// a subsequent write() marshalls the compiled form. Unlike load(), leaves
+// nothing on the Lua stack. Errors are reported in this->error as usual.
+int dlua_chunk::precompile(CLua &interp)
+{
+    if (!compiled.empty() || empty())
+        return 0;
+
+    lua_stack_cleaner clean(interp);
+    return load(interp);
+}
+
 int dlua_chunk::run(CLua &interp)
 {
     int err = load(interp);
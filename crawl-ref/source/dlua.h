@@ -56,6 +56,7 @@ public:
     void set_chunk(const string &s);
 
     int load(CLua &interp);
+    int precompile(CLua &interp);
     int run(CLua &interp);
     int load_call(CLua &interp, const char *function);
     void set_file(const string &s);
@@ -8,6 +8,7 @@
 #include "dungeon.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -78,6 +79,7 @@
 #ifdef WIZARD
 #include "wiz-dgn.h"
 #endif
+#include "zone-profile.h"
 
 #ifdef DEBUG_DIAGNOSTICS
 #define DEBUG_TEMPLES
@@ -178,6 +180,24 @@ static dungeon_feature_type _pick_an_altar();
 static vector<god_type> _temple_altar_list;
 static CrawlHashTable*       _current_temple_hash = nullptr; // XXX: hack!
 
+// One entry per failed build attempt for the level currently being
+// generated: attempt number, elapsed time and veto reason. Rolling the
+// level back to a mid-build checkpoint instead of restarting has been
+// considered and rejected: most vetoes are connectivity failures where
+// the already-placed layout is itself the problem, and a partial replay
+// would consume a different amount of the level's rng stream than a
+// clean restart, diverging seeded games. So retries stay whole-level,
+// and this journal makes their cost visible instead (in crash reports
+// via BUILD_JOURNAL_KEY, and in the &ctrl-l builder log).
+static vector<string> _builder_attempt_journal;
+
+static int64_t _now_us()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(
+            steady_clock::now().time_since_epoch()).count();
+}
+
 // MISC FUNCTIONS
 static void _dgn_set_floor_colours();
 static bool _fixup_interlevel_connectivity();
@@ -272,8 +292,17 @@ int dgn_builder_y()
 /**********************************************************************
  * builder() - kickoff for the dungeon generator.
  *********************************************************************/
+// N.b. on stair-descent latency: generating the destination level ahead
+// of arrival (or on a worker thread) has been considered and doesn't fit
+// this architecture. The builder works directly on the global env/you
+// state and the per-branch rng streams, so it can't run concurrently
+// with play, and in non-pregen games generating levels out of arrival
+// order would make level content depend on the route taken. Games with
+// deterministic_levelgen set already build whole branches ahead via
+// pregen_dungeon() and pay only the save-chunk load on stairs.
 bool builder(bool enable_random_maps)
 {
+    PERF_ZONE("builder");
 #ifndef DEBUG_FULL_DUNGEON_SPAM
     // hide builder debug spam by default -- this is still collected by a tee
     // and accessible via &ctrl-l without this #define.
@@ -316,8 +345,11 @@ bool builder(bool enable_random_maps)
         level_id::current().describe().c_str()));
 #endif
 
+    _builder_attempt_journal.clear();
+
     // N tries to build the level, after which we bail with a capital B.
-    int tries = 50;
+    const int max_tries = 50;
+    int tries = max_tries;
     while (tries-- > 0)
     {
         // If we're getting low on available retries, disable random vaults
@@ -325,13 +357,25 @@ bool builder(bool enable_random_maps)
         if (tries < 5)
             enable_random_maps = false;
 
+        const int64_t attempt_start_us = _now_us();
+
         try
         {
             // clean slate
             crawl_state.last_builder_error_fatal = false;
 
             if (_build_level_vetoable(enable_random_maps))
+            {
+                // If earlier attempts failed, leave the retry history in
+                // the level's properties for crash reports and perf triage.
+                if (!_builder_attempt_journal.empty())
+                {
+                    env.properties[BUILD_JOURNAL_KEY] =
+                        join_strings(_builder_attempt_journal.begin(),
+                                     _builder_attempt_journal.end(), "; ");
+                }
                 return true;
+            }
 #if defined(DEBUG_VETO_RESUME) && defined(WIZARD)
             else if (is_wizard_travel_target(level_id::current()))
             {
@@ -392,6 +436,14 @@ bool builder(bool enable_random_maps)
             reread_maps();
         }
 
+        _builder_attempt_journal.push_back(make_stringf(
+            "attempt %d: %s (%d ms)",
+            max_tries - tries,
+            crawl_state.last_builder_error.empty()
+                ? "post-build validation failed"
+                : crawl_state.last_builder_error.c_str(),
+            static_cast<int>((_now_us() - attempt_start_us) / 1000)));
+
         get_uniq_map_tags() = uniq_tags;
         get_uniq_map_names() = uniq_names;
         if (crawl_state.last_builder_error_fatal &&
@@ -430,6 +482,8 @@ bool builder(bool enable_random_maps)
         // it does show up in the builder log / crashlog at least.
         mprf(MSGCH_ERROR, "Unable to generate level for '%s'!",
             level_id::current().describe().c_str());
+        for (const string &entry : _builder_attempt_journal)
+            dprf(DIAG_DNGN, "    %s", entry.c_str());
     }
 
     env.level_layout_types.clear(); // is this necessary?
@@ -1140,12 +1194,25 @@ static int _process_disconnected_zones(int x1, int y1, int x2, int y2,
                 continue;
             }
 
+            // Collect the zone's squares as the flood discovers them, so
+            // the fill path below doesn't have to rescan the whole grid
+            // once per zone. The start square isn't reported through
+            // record_point (and doesn't count towards zone_size), so seed
+            // the list with it by hand.
             int zone_size = 0;
-            auto inc_zone_size = [&zone_size](const coord_def &) { zone_size++; };
+            vector<coord_def> zone_points;
+            if (fill)
+                zone_points.emplace_back(x, y);
+            auto record_zone_point = [&](const coord_def &zc)
+            {
+                zone_size++;
+                if (fill)
+                    zone_points.push_back(zc);
+            };
 
             const bool found_exit_stair =
                 _dgn_fill_zone(coord_def(x, y), ++nzones,
-                               inc_zone_size,
+                               record_zone_point,
                                passable,
                                choose_stairless ? (at_branch_bottom() ?
                                                    _is_upwards_exit_stair :
@@ -1165,23 +1232,15 @@ static int _process_disconnected_zones(int x1, int y1, int x2, int y2,
                 bool veto = false;
                 vector<coord_def> coords;
                 dprf("Filling zone %d", nzones);
-                for (int fy = y1; fy <= y2 ; ++fy)
+                for (const coord_def &zc : zone_points)
                 {
-                    for (int fx = x1; fx <= x2; ++fx)
+                    if (map_masked(zc, MMT_VAULT))
                     {
-                        if (travel_point_distance[fx][fy] == nzones)
-                        {
-                            if (map_masked(coord_def(fx, fy), MMT_VAULT))
-                            {
-                                veto = true;
-                                break;
-                            }
-                            else if (!fill_check || fill_check(coord_def(fx, fy)))
-                                coords.emplace_back(fx, fy);
-                        }
-                    }
-                    if (veto)
+                        veto = true;
                         break;
+                    }
+                    else if (!fill_check || fill_check(zc))
+                        coords.push_back(zc);
                 }
                 if (!veto)
                 {
@@ -5895,7 +5954,7 @@ vector<coord_def> dgn_join_the_dots_pathfind(const coord_def &from,
     coord_def curr = from;
     while (true)
     {
-        int &tpd = travel_point_distance[curr.x][curr.y];
+        int16_t &tpd = travel_point_distance[curr.x][curr.y];
         // flip the sign of the path we are actually following. Used paths end
         // up negative, unused paths, positive. -1000 is the starting point.
         tpd = !tpd ? -1000 : -tpd;
@@ -6421,6 +6480,24 @@ void place_spec_shop(const coord_def& where, shop_spec &spec, int shop_level)
 
     _set_grd(where, DNGN_ENTER_SHOP);
 
+    // A generic spec doesn't constrain the stock, so the expensive item
+    // rolls can wait until the player first enters the shop. Vault item
+    // lists and Gozag calls are stocked eagerly, since the spec can't be
+    // kept around; stat generation wants the items on the spot too.
+    if (spec.items.empty() && !spec.use_all && spec.num_items == -1
+        && !spec.gozag
+        && !crawl_state.map_stat_gen && !crawl_state.obj_stat_gen)
+    {
+        // Capture a child seed the same way rng::subgenerator() derives
+        // one, to be replayed at first entry.
+        shop.stock_seed = rng::get_uint64();
+        shop.stock_seq  = rng::get_uint64();
+        shop.stocked = false;
+        shop.stock.clear();
+        return;
+    }
+
+    shop.stocked = true;
     const int num_items = _shop_num_items(spec);
 
     // For books shops, store how many copies of a given book are on display.
@@ -6435,6 +6512,33 @@ void place_spec_shop(const coord_def& where, shop_spec &spec, int shop_level)
         _stock_shop_item(j, shop.type, stocked, supplied, spec, shop, shop_level);
 }
 
+// Roll the stock of a shop whose generation was deferred at placement.
+// This runs under the seed captured back then, so the items are the same
+// ones stocking the shop during level build would have produced.
+void stock_deferred_shop(shop_struct &shop)
+{
+    if (shop.stocked)
+        return;
+    shop.stocked = true;
+
+    rng::subgenerator shop_rng(shop.stock_seed, shop.stock_seq);
+    no_notes nx;
+
+    shop_spec spec(shop.type);
+    const int level_number = shop.level / 2;
+    const int num_items = _shop_num_items(spec);
+
+    int stocked[NUM_BOOKS] = { 0 };
+    int supplied[NUM_SPELLS] = { 0 };
+
+    shop.stock.clear();
+    for (int j = 0; j < num_items; j++)
+    {
+        _stock_shop_item(j, shop.type, stocked, supplied, spec, shop,
+                         level_number);
+    }
+}
+
 object_class_type item_in_shop(shop_type shop_type)
 {
     switch (shop_type)
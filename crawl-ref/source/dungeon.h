@@ -18,6 +18,9 @@ COMPILE_CHECK(sizeof(feature_property_type) <= sizeof(terrain_property_t));
 
 #define BUILD_METHOD_KEY "build_method_key"
 #define LAYOUT_TYPE_KEY  "layout_type_key"
+// Retry history for levels whose builder vetoed at least once; see
+// _builder_attempt_journal in dungeon.cc.
+#define BUILD_JOURNAL_KEY "build_journal_key"
 
 // See _build_overflow_temples() in dungeon.cc for details on overflow
 // temples.
@@ -239,8 +242,10 @@ void level_clear_vault_memory();
 void run_map_epilogues();
 
 struct shop_spec;
+struct shop_struct;
 void place_spec_shop(const coord_def& where, shop_type force_type);
 void place_spec_shop(const coord_def& where, shop_spec &spec, int shop_level = 0);
+void stock_deferred_shop(shop_struct &shop);
 int greed_for_shop_type(shop_type shop, int level_number);
 object_class_type item_in_shop(shop_type shop_type);
 bool seen_destroy_feat(dungeon_feature_type old_feat);
@@ -88,8 +88,6 @@ void cio_cleanup()
 static void _clear_globals_on_exit()
 {
     clear_rays_on_exit();
-    clear_zap_info_on_exit();
-    clear_form_info_on_exit();
     destroy_abyss();
 }
 
@@ -174,6 +172,9 @@ NORETURN void end(int exit_code, bool print_error, const char *format, ...)
         tiles.shutdown();
 #endif
 
+        // Don't truncate a morgue still being written in the background.
+        join_dump_writer();
+
         cio_cleanup();
         msg::deinitialise_mpr_streams();
         _clear_globals_on_exit();
@@ -311,7 +312,10 @@ NORETURN void end_game(scorefile_entry &se)
     delete_files();
 
     string fname = morgue_name(you.your_name, se.get_death_time());
-    if (!dump_char(fname, true, true, &se))
+    // Write the morgue on a background thread, so scoring, whereis and the
+    // end-of-game screens don't serialize behind it; joined below before the
+    // exit reason is broadcast.
+    if (!dump_char(fname, true, true, &se, true))
         mpr("Char dump unsuccessful! Sorry about that.");
 #ifdef USE_TILE_WEB
     else
@@ -424,6 +428,10 @@ NORETURN void end_game(scorefile_entry &se)
         ui::run_layout(std::move(popup), done);
     }
 
+    // Make sure the morgue is complete on disk before anyone is told the
+    // game is over and goes looking for it.
+    join_dump_writer();
+
 #ifdef USE_TILE_WEB
     tiles.send_exit_reason(reason, hiscore);
 #endif
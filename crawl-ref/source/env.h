@@ -40,6 +40,12 @@ struct crawl_environment
     // completely safe if it's an overestimate - just not an underestimate.
     int                             max_mon_index;
 
+    // Sorted indices of the env.mons slots that may hold a live monster.
+    // Grown in get_free_monster(), pruned back to the defined slots by
+    // clear_monster_flags() each round; like max_mon_index it is safe as
+    // an overestimate, and monster_iterator walks only these slots.
+    vector<int>                     live_mon_slots;
+
     feature_grid                             grid;  // terrain grid
     FixedArray<terrain_property_t, GXM, GYM> pgrid; // terrain properties
     FixedArray< unsigned short, GXM, GYM >   mgrid; // monster grid
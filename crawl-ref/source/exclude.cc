@@ -21,6 +21,7 @@
 #include "mon-util.h"
 #include "options.h"
 #include "player-notices.h"
+#include "showsymb.h"
 #include "stringutil.h"
 #include "tags.h"
 #include "terrain.h"
@@ -233,10 +234,10 @@ void exclude_set::add_exclude_points(travel_exclude& ex)
         return;
     }
 
+    // If the exclusion is up to date, its LOS field already reflects the
+    // current terrain; don't re-flood it just to re-read the points.
     if (!ex.uptodate)
         ex.set_los();
-    else
-        ex.los.update();
 
     for (radius_iterator ri(ex.pos, ex.radius, C_SQUARE); ri; ++ri)
         if (ex.affects(*ri))
@@ -315,15 +316,6 @@ exclude_set::iterator exclude_set::end()
 
 /////////////////////////////////////////////////////////////////////////
 
-static void _mark_excludes_non_updated(const coord_def &p)
-{
-    for (auto &entry : curr_excludes)
-    {
-        travel_exclude &ex = entry.second;
-        ex.uptodate = ex.uptodate && !ex.in_bounds(p);
-    }
-}
-
 void init_exclusion_los()
 {
     curr_excludes.recompute_excluded_points(true);
@@ -388,8 +380,11 @@ static void _update_gate_exclusions(coord_def c)
 /*
  * Update exclusions' LOS to reflect changes within their range.
  * "changed" is a list of coordinates that have been changed.
- * Only exclusions that might have one of the changed points
- * in view are updated.
+ * The whole batch of changes is applied in a single pass: each exclusion is
+ * updated at most once however many cells changed, exclusions whose bounds
+ * none of the changed cells intersect are left alone, and a handful of
+ * changed cells inside an up-to-date field are re-resolved individually
+ * instead of re-flooding the whole field.
  */
 void update_exclusion_los(vector<coord_def> changed)
 {
@@ -397,12 +392,43 @@ void update_exclusion_los(vector<coord_def> changed)
         return;
 
     for (coord_def c : changed)
-    {
-        _mark_excludes_non_updated(c);
         _update_gate_exclusions(c);
+
+    bool any_affected = false;
+    for (auto &entry : curr_excludes)
+    {
+        travel_exclude &ex = entry.second;
+
+        // Radius 0 and 1 exclusions are purely positional; there's no LOS
+        // field to maintain.
+        if (ex.radius <= 1)
+            continue;
+
+        vector<coord_def> hits;
+        for (coord_def c : changed)
+            if (ex.in_bounds(c))
+                hits.push_back(c);
+
+        if (hits.empty())
+            continue;
+
+        any_affected = true;
+
+        // Re-resolving one cell costs about a quadrant of the full flood,
+        // so beyond a few cells recomputing from scratch is cheaper; mark
+        // the exclusion stale and let recompute_excluded_points() re-flood
+        // just the stale ones.
+        if (ex.uptodate && hits.size() <= 3)
+        {
+            for (coord_def c : hits)
+                ex.los.update_cell(c);
+        }
+        else
+            ex.uptodate = false;
     }
 
-    curr_excludes.update_excluded_points(true);
+    if (any_affected)
+        curr_excludes.recompute_excluded_points(false);
 }
 
 bool is_excluded(const coord_def &p, const exclude_set &exc)
@@ -451,6 +477,9 @@ static void _exclude_update()
 {
     set_level_exclusion_annotation(curr_excludes.get_exclusion_desc());
     travel_cache.update_excludes();
+    travel_invalidate_distance_cache();
+    // Exclusions recolour stairs without a turn passing.
+    bump_glyph_epoch();
 }
 
 static void _exclude_update(const coord_def &p)
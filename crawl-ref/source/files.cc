@@ -83,6 +83,7 @@
 #include "spl-transloc.h" // cell_vetoes_teleport
 #include "stairs.h"
 #include "state.h"
+#include "status.h"
 #include "stringutil.h"
 #include "syscalls.h"
 #include "tag-version.h"
@@ -101,6 +102,7 @@
 #include "version.h"
 #include "view.h"
 #include "xom.h"
+#include "zone-profile.h"
 #include "zot.h"
 
 #ifdef __ANDROID__
@@ -157,7 +159,8 @@ static void _redraw_all()
     you.redraw_armour_class  = true;
     you.redraw_evasion       = true;
     you.redraw_experience    = true;
-    you.redraw_status_lights = true;
+    invalidate_status_cache();
+    invalidate_derived_stats();
     you.redraw_doom          = true;
     you.redraw_contam        = true;
 }
@@ -1056,6 +1059,56 @@ static void _write_tagged_chunk(const string &chunkname, tag_type tag)
     tag_write(tag, outf);
 }
 
+// A small cache of the most recently saved levels in their marshalled but
+// uncompressed form. Levels are written through to the save package as
+// usual (so crash recovery and has_chunk checks are unaffected), but
+// reloading a cached level skips the package and zlib entirely. This makes
+// stair round-trips and level excursions (shopping list, apportation,
+// cross-level god effects) considerably cheaper.
+static const size_t MAX_CACHED_LEVELS = 4;
+static map<string, vector<unsigned char>> _level_cache;
+static vector<string> _level_cache_order; // least recently used first
+
+static void _level_cache_touch(const string &name)
+{
+    erase_val(_level_cache_order, name);
+    _level_cache_order.push_back(name);
+}
+
+static void _level_cache_store(const string &name, vector<unsigned char> &&data)
+{
+    _level_cache_touch(name);
+    _level_cache[name] = std::move(data);
+    if (_level_cache.size() > MAX_CACHED_LEVELS)
+    {
+        _level_cache.erase(_level_cache_order.front());
+        _level_cache_order.erase(_level_cache_order.begin());
+    }
+}
+
+static const vector<unsigned char> *_level_cache_find(const string &name)
+{
+    auto it = _level_cache.find(name);
+    if (it == _level_cache.end())
+        return nullptr;
+    _level_cache_touch(name);
+    return &it->second;
+}
+
+static void _level_cache_erase(const string &name)
+{
+    _level_cache.erase(name);
+    erase_val(_level_cache_order, name);
+}
+
+// Forget all cached levels. Must be called whenever a save package is
+// opened or created, as the cache is only coherent within one game.
+void reset_level_cache()
+{
+    _level_cache.clear();
+    _level_cache_order.clear();
+}
+
 static int _get_dest_stair_type(dungeon_feature_type stair_taken,
                                 bool &find_first)
 {
@@ -1892,6 +1945,15 @@ bool pregen_dungeon(const level_id &stopping_point)
             return generate_level(stopping_point);
     }
 
+    // Optionally run a triggered pregen pass to the end of the target
+    // branch, so later descents within it are pure save-chunk loads.
+    // Generation order doesn't affect content here: deterministic
+    // levelgen gives every level its own rng stream. (Ziggurats delete
+    // levels as they go and are never filled ahead.)
+    const bool fill_branch = Options.pregen_whole_branches
+                             && stopping_point.branch != BRANCH_ZIGGURAT
+                             && _branch_pregenerates(stopping_point.branch);
+
     vector<level_id> to_generate;
     bool at_end = false;
     for (auto br : branch_generation_order)
@@ -1923,7 +1985,8 @@ bool pregen_dungeon(const level_id &stopping_point)
                 to_generate.push_back(new_level);
 
                 if (br == stopping_point.branch
-                    && (i == stopping_point.depth || i == brdepth[br]))
+                    && (i == brdepth[br]
+                        || !fill_branch && i == stopping_point.depth))
                 {
                     at_end = true;
                     break;
@@ -1941,7 +2004,7 @@ bool pregen_dungeon(const level_id &stopping_point)
     }
     // TODO: some levels are very slow (typically in depths), and a popup might
     // be helpful to the player. But is there a good way to tell?
-    else if (to_generate.size() == 1)
+    else if (to_generate.size() == 1 && to_generate[0] == stopping_point)
         return generate_level(to_generate[0]); // no popup for this case
     else
     {
@@ -1979,7 +2042,12 @@ bool pregen_dungeon(const level_id &stopping_point)
                 return false; // level failed to generate -- bail immediately
         }
 
-        return true;
+        // A whole-branch pass may continue past the requested level, in
+        // which case env now holds a deeper level: report that we didn't
+        // stop on the requested one, and the caller reloads it from its
+        // save chunk.
+        return stopping_point.branch == NUM_BRANCHES
+               || to_generate.back() == stopping_point;
     }
 }
 
@@ -2087,6 +2155,7 @@ static void _learn_transporters()
 bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
                 const level_id& old_level)
 {
+    PERF_ZONE("load_level");
     const string level_name = level_id::current().describe();
     if (!you.save->has_chunk(level_name) && load_mode == LOAD_VISITOR)
         return false;
@@ -2542,7 +2611,27 @@ void save_level(const level_id& lid)
     // Nail all items to the ground.
     fix_item_coordinates();
 
-    _write_tagged_chunk(lid.describe(), TAG_LEVEL);
+    const string chunkname = lid.describe();
+
+    // Marshal into memory once, then hand the same bytes to the save
+    // package and keep them in the level cache for cheap reloads.
+    vector<unsigned char> buf;
+    writer memw(&buf);
+    write_save_version(memw, save_version::current());
+    tag_write(TAG_LEVEL, memw);
+
+    // If the level is byte-identical to the version last handed to the
+    // package, skip the rewrite. Excursions and stair round-trips resave
+    // levels that often haven't changed at all, and rewriting them just
+    // churns compression and storage writes for nothing.
+    if (const vector<unsigned char> *cached = _level_cache_find(chunkname))
+        if (*cached == buf)
+            return;
+
+    writer outf(you.save, chunkname);
+    outf.write(&buf[0], buf.size());
+
+    _level_cache_store(chunkname, std::move(buf));
 }
 
 #if TAG_MAJOR_VERSION == 34
@@ -2626,6 +2715,7 @@ static void _save_game_exit()
 
 void save_game(bool leave_game, const char *farewellmsg)
 {
+    PERF_ZONE("save_game");
     unwind_bool saving_game(crawl_state.saving_game, true);
     // Should you.no_save disable more here? Currently it entails an empty
     // package, and persists won't save, but there's a bunch of other stuff
@@ -2664,7 +2754,10 @@ void save_game(bool leave_game, const char *farewellmsg)
 #endif
         if (!crawl_state.disables[DIS_SAVE_CHECKPOINTS])
         {
-            you.save->commit();
+            // Checkpoint saves needn't block the player: compression is
+            // already handed off, and the commit (block writes, directory,
+            // fsync) can follow it to the background.
+            you.save->commit_async();
             save_game_prefs();
         }
         return;
@@ -2790,17 +2883,22 @@ static vector<string> _list_bones()
 {
     string bonefile_dir = _get_bonefile_directory();
     string base_filename = _make_ghost_filename();
-    string underscored_filename = base_filename + "_";
 
-    vector<string> filenames = get_dir_files_sorted(bonefile_dir);
+    // Ephemeral bones files are always named <base>_<n> with n below
+    // GHOST_LIMIT (see _make_bones_file), so probe the possible names
+    // directly instead of listing and sorting the whole bones directory,
+    // which on a busy server holds files for every level of every branch.
     vector<string> bonefiles;
-    for (const auto &filename : filenames)
-        if (starts_with(filename, underscored_filename)
-                                            && !ends_with(filename, ".backup"))
+    for (int i = 0; i < GHOST_LIMIT; i++)
+    {
+        const string filename = make_stringf("%s%s_%d", bonefile_dir.c_str(),
+                                             base_filename.c_str(), i);
+        if (access(filename.c_str(), F_OK) == 0)
         {
-            bonefiles.push_back(bonefile_dir + filename);
-            _ghost_dprf("bonesfile %s", (bonefile_dir + filename).c_str());
+            bonefiles.push_back(filename);
+            _ghost_dprf("bonesfile %s", filename.c_str());
         }
+    }
 
     string old_bonefile = _get_old_bonefile_directory() + base_filename;
     if (access(old_bonefile.c_str(), F_OK) == 0)
@@ -3049,7 +3147,28 @@ static vector<ghost_demon> _load_ephemeral_ghosts()
 
 static vector<ghost_demon> _load_permastore_ghosts(bool backup_on_upgrade=false)
 {
-    return _load_ghosts_core(_bones_permastore_file(), backup_on_upgrade);
+    // The permastore is read-mostly: placing a ghost out of it doesn't
+    // rewrite the file, but it used to be re-read and re-validated from
+    // disk for every ghost placed during level build. Cache the parsed
+    // records per file, and reload only when the file has been replaced
+    // (by _update_permastore here, or by another process sharing the
+    // bones directory).
+    static map<string, pair<time_t, vector<ghost_demon>>> cache;
+
+    const string filename = _bones_permastore_file();
+    if (filename.empty())
+        return vector<ghost_demon>();
+
+    const time_t mtime = file_modtime(filename);
+    auto cached = cache.find(filename);
+    if (backup_on_upgrade
+        || cached == cache.end() || cached->second.first != mtime)
+    {
+        cache[filename] = make_pair(mtime,
+                              _load_ghosts_core(filename, backup_on_upgrade));
+        cached = cache.find(filename);
+    }
+    return cached->second.second;
 }
 
 /**
@@ -3078,7 +3197,7 @@ bool define_ghost_from_bones(monster& mons)
     _ghost_dprf("Loaded ghost file with %u ghost(s), placing %s",
          (unsigned int)loaded_ghosts.size(), loaded_ghosts[place_i].name.c_str());
 
-    mons.set_ghost(loaded_ghosts[place_i]);
+    mons.set_ghost(std::move(loaded_ghosts[place_i]));
     mons.type = MONS_PLAYER_GHOST;
     mons.ghost_init(false);
 
@@ -3145,7 +3264,7 @@ bool load_ghosts(int max_ghosts, bool creating_level)
             break;
 
         mons->set_new_monster_id();
-        mons->set_ghost(loaded_ghosts[0]);
+        mons->set_ghost(std::move(loaded_ghosts[0]));
         mons->type = MONS_PLAYER_GHOST;
         mons->ghost_init();
 
@@ -3202,6 +3321,7 @@ static bool _restore_game(const string& filename)
 
     clear_message_store();
 
+    reset_level_cache();
     you.save = new package((_get_savefile_directory() + filename).c_str(), true);
 
     player_save_info save_info = _read_character_info(you.save);
@@ -3395,6 +3515,7 @@ void delete_level(const level_id &level)
     clear_level_exclusion_annotation(level);
     clear_level_annotations(level);
 
+    _level_cache_erase(level.describe());
     if (you.save)
         you.save->delete_chunk(level.describe());
 
@@ -3716,10 +3837,30 @@ static bool _tagged_chunk_version_compatible(reader &inf, string* reason)
     return true;
 }
 
+static bool _restore_tagged_chunk_from(reader &inf, const string &name,
+                                       tag_type tag, const char* complaint);
+
 static bool _restore_tagged_chunk(package *save, const string &name,
                                   tag_type tag, const char* complaint)
 {
+    // Recently saved levels can be restored from memory, skipping the
+    // package and decompression.
+    if (tag == TAG_LEVEL)
+    {
+        if (const vector<unsigned char> *buf = _level_cache_find(name))
+        {
+            reader inf(*buf);
+            return _restore_tagged_chunk_from(inf, name, tag, complaint);
+        }
+    }
+
     reader inf(save, name);
+    return _restore_tagged_chunk_from(inf, name, tag, complaint);
+}
+
+static bool _restore_tagged_chunk_from(reader &inf, const string &name,
+                                       tag_type tag, const char* complaint)
+{
     string reason;
     if (!_tagged_chunk_version_compatible(inf, &reason))
     {
@@ -397,23 +397,26 @@ protected:
 class make_derived_undead_fineff : public final_effect
 {
 public:
+    void merge(const final_effect& a) override;
     void fire() override;
 
     make_derived_undead_fineff(coord_def pos, mgen_data _mg, int _xl,
         const string& _agent, const string& _msg,
         bool _act_immediately)
         : final_effect(0, 0, pos), mg(_mg), experience_level(_xl),
-        agent(_agent), message(_msg), act_immediately(_act_immediately)
+        agent(_agent), message(_msg), act_immediately(_act_immediately),
+        count(1)
     {
     }
 protected:
-    bool mergeable(const final_effect&) const override { return false; }
+    bool mergeable(const final_effect& a) const override;
 
     mgen_data mg;
     int experience_level;
     string agent;
     string message;
     bool act_immediately;
+    int count;
 };
 
 class mummy_death_curse_fineff : public final_effect
@@ -524,16 +527,18 @@ protected:
 class death_spawn_fineff : public final_effect
 {
 public:
+    void merge(const final_effect& a) override;
     void fire() override;
 
     death_spawn_fineff(mgen_data _mg)
-        : final_effect(0, 0, _mg.pos), mg(_mg)
+        : final_effect(0, 0, _mg.pos), mg(_mg), count(1)
     {
     }
 protected:
-    bool mergeable(const final_effect&) const override { return false; }
+    bool mergeable(const final_effect& a) const override;
 
     const mgen_data mg;
+    int count;
 };
 
 class detonation_fineff : public final_effect
@@ -915,6 +920,40 @@ bool rakshasa_clone_fineff::mergeable(const final_effect &fe) const
     return att == o.att && def == o.def && posn == o.posn;
 }
 
+// Two queued spawns can be collapsed into a single counted entry only if
+// every field that placement looks at matches. props carries per-spawn
+// data (head counts and the like), so specs using it are never merged.
+static bool _same_spawn_spec(const mgen_data &a, const mgen_data &b)
+{
+    return a.cls == b.cls && a.base_type == b.base_type
+           && a.behaviour == b.behaviour && a.summoner == b.summoner
+           && a.summon_duration == b.summon_duration
+           && a.summon_type == b.summon_type
+           && a.pos == b.pos && a.foe == b.foe && a.flags == b.flags
+           && a.god == b.god && a.colour == b.colour
+           && a.hd == b.hd && a.hp == b.hp
+           && a.extra_flags == b.extra_flags
+           && a.mname == b.mname
+           && a.non_actor_summoner == b.non_actor_summoner
+           && a.props.empty() && b.props.empty();
+}
+
+bool make_derived_undead_fineff::mergeable(const final_effect &fe) const
+{
+    const make_derived_undead_fineff& o =
+        static_cast<const make_derived_undead_fineff&>(fe);
+    return posn == o.posn && experience_level == o.experience_level
+           && agent == o.agent && message == o.message
+           && act_immediately == o.act_immediately
+           && _same_spawn_spec(mg, o.mg);
+}
+
+bool death_spawn_fineff::mergeable(const final_effect &fe) const
+{
+    const death_spawn_fineff& o = static_cast<const death_spawn_fineff&>(fe);
+    return posn == o.posn && _same_spawn_spec(mg, o.mg);
+}
+
 bool summon_dismissal_fineff::mergeable(const final_effect &fe) const
 {
     const summon_dismissal_fineff& o =
@@ -988,6 +1027,24 @@ void shock_discharge_fineff::merge(const final_effect &fe)
     power += ssdfe->power;
 }
 
+void make_derived_undead_fineff::merge(const final_effect &fe)
+{
+    const make_derived_undead_fineff *mdufe =
+        dynamic_cast<const make_derived_undead_fineff *>(&fe);
+    ASSERT(mdufe);
+    ASSERT(is_mergeable(*mdufe));
+    count += mdufe->count;
+}
+
+void death_spawn_fineff::merge(const final_effect &fe)
+{
+    const death_spawn_fineff *dsfe =
+        dynamic_cast<const death_spawn_fineff *>(&fe);
+    ASSERT(dsfe);
+    ASSERT(is_mergeable(*dsfe));
+    count += dsfe->count;
+}
+
 void summon_dismissal_fineff::merge(const final_effect &)
 {
     // no damage to accumulate, but no need to fire this more than once
@@ -1487,30 +1544,33 @@ void infestation_death_fineff::fire()
 
 void make_derived_undead_fineff::fire()
 {
-    monster *undead = create_monster(mg);
-    if (!undead)
-        return;
+    for (int i = 0; i < count; ++i)
+    {
+        monster *undead = create_monster(mg);
+        if (!undead)
+            continue;
 
-    if (!message.empty() && you.can_see(*undead))
-        mpr(message);
+        if (!message.empty() && you.can_see(*undead))
+            mpr(message);
 
-    // If the original monster has been levelled up, its HD might be
-    // different from its class HD, in which case its HP should be
-    // rerolled to match.
-    if (undead->get_experience_level() != experience_level)
-    {
-        undead->set_hit_dice(max(experience_level, 1));
-        roll_zombie_hp(undead);
-    }
+        // If the original monster has been levelled up, its HD might be
+        // different from its class HD, in which case its HP should be
+        // rerolled to match.
+        if (undead->get_experience_level() != experience_level)
+        {
+            undead->set_hit_dice(max(experience_level, 1));
+            roll_zombie_hp(undead);
+        }
 
-    if (!agent.empty())
-        mons_add_blame(undead, "animated by " + agent);
+        if (!agent.empty())
+            mons_add_blame(undead, "animated by " + agent);
 
-    if (act_immediately)
-    {
-        undead->flags &= ~MF_JUST_SUMMONED;
-        undead->speed_increment = 80;
-        queue_monster_for_action(undead);
+        if (act_immediately)
+        {
+            undead->flags &= ~MF_JUST_SUMMONED;
+            undead->speed_increment = 80;
+            queue_monster_for_action(undead);
+        }
     }
 }
 
@@ -1672,7 +1732,8 @@ void dismiss_divine_allies_fineff::fire()
 
 void death_spawn_fineff::fire()
 {
-    create_monster(mg);
+    for (int i = 0; i < count; ++i)
+        create_monster(mg);
 }
 
 void splinterfrost_fragment_fineff::fire()
@@ -89,10 +89,24 @@ public:
         return mData[p.first][p.second];
     }
 
+    // ----- Raw access -----
+    // The backing store is one contiguous block of WIDTH*HEIGHT
+    // elements, with (x, y) at underlying()[x * HEIGHT + y]. Hot
+    // loops that don't care about coordinates can scan it linearly.
+    TYPE* underlying() { return mData[0].buffer(); }
+    const TYPE* underlying() const { return mData[0].buffer(); }
+
+    typedef TYPE*       iterator;
+    typedef const TYPE* const_iterator;
+
+    iterator begin() { return underlying(); }
+    const_iterator begin() const { return underlying(); }
+    iterator end() { return underlying() + size(); }
+    const_iterator end() const { return underlying() + size(); }
+
     void init(const TYPE& def)
     {
-        for (auto &col : mData)
-            col.init(def);
+        std::fill(begin(), end(), def);
     }
 
 protected:
@@ -101,9 +115,7 @@ protected:
 
     void copy_from(const FixedArray &other)
     {
-        for (int i = 0; i < width(); i++)
-            for (int j = 0; j < height(); j++)
-                (*this)[i][j] = other[i][j];
+        std::copy(other.begin(), other.end(), begin());
     }
 };
 
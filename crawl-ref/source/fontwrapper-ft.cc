@@ -23,9 +23,9 @@
 #include "unwind.h"
 
 // maximum number of unique glyphs that can be rendered with this font at once; e.g. 4096, 256, 36
-#define MAX_GLYPHS 256
+#define MAX_GLYPHS 1024
 // dimensions of glyph grid; GLYPHS_PER_ROWCOL^2 <= MAX_GLYPHS; e.g. 64, 16, 6
-#define GLYPHS_PER_ROWCOL 16
+#define GLYPHS_PER_ROWCOL 32
 // char to use if we can't find it in the font (upside-down question mark)
 #define MISSING_CHAR 0xbf
 
@@ -62,6 +62,8 @@ FontWrapper* FontWrapper::create()
 
 FTFontWrapper::FTFontWrapper() :
     m_atlas(nullptr),
+    m_atlas_live(0),
+    m_atlas_clock(0),
     m_max_advance(0, 0),
     m_min_offset(0),
     charsz(1,1),
@@ -145,6 +147,9 @@ bool FTFontWrapper::configure_font()
     m_tex.load_texture(nullptr, m_ft_width, m_ft_height, MIPMAP_NONE);
 
     m_glyphs.clear();
+    m_atlas_map.clear();
+    m_atlas_live = 0;
+    m_atlas_clock = 0;
 
     for (int i = 0; i < MAX_GLYPHS; i++)
         m_atlas[i] = FontAtlasEntry();
@@ -168,9 +173,13 @@ bool FTFontWrapper::configure_font()
         ASSERT(success);
     }
 
-    // precache common chars
+    // precache common chars: ASCII, plus the printable Latin-1 supplement
+    // (accented letters and common punctuation), so ordinary text never
+    // triggers a glyph rasterisation or texture upload mid-frame
     for (int i = 0x20; i < 0x7f; i++)
         map_unicode(i);
+    for (int i = 0xa1; i < 0x100; i++)
+        map_unicode(i);
     return true;
 }
 
@@ -213,8 +222,8 @@ bool FTFontWrapper::load_font(const char *font_name, unsigned int font_size)
     }
 
     m_atlas = new FontAtlasEntry[MAX_GLYPHS];
-    m_atlas_lru.clear();
-    m_atlas_lru.reserve(MAX_GLYPHS);
+    m_atlas_map.clear();
+    m_atlas_map.reserve(MAX_GLYPHS);
 
     return configure_font();
 }
@@ -327,27 +336,33 @@ unsigned int FTFontWrapper::map_unicode(char *ch)
 
 unsigned int FTFontWrapper::map_unicode(char32_t uchar)
 {
-    unsigned int c = MAX_GLYPHS;
-    for (unsigned int i = 1; i < MAX_GLYPHS; i++)
-        if (m_atlas[i].uchar == uchar)
+    unsigned int c;
+    auto it = m_atlas_map.find(uchar);
+    if (it != m_atlas_map.end())
+        c = it->second;
+    else // not found: need to load into atlas
+    {
+        if (m_atlas_live == MAX_GLYPHS-1)
         {
-            c = i;
-            break;
+            // atlas full: evict the least recently used glyph. (Slot 0
+            // is the reserved white block and never evicted.) Eviction is
+            // rare, so a scan for the oldest stamp is fine; lookups, the
+            // per-glyph hot path, stay O(1).
+            c = 1;
+            for (unsigned int i = 2; i < MAX_GLYPHS; i++)
+                if (m_atlas[i].last_used < m_atlas[c].last_used)
+                    c = i;
+            m_atlas_map.erase(m_atlas[c].uchar);
         }
-
-    if (c == MAX_GLYPHS) // not found: need to load into atlas
-    {
-        bool atlas_full = m_atlas_lru.size() == MAX_GLYPHS-1;
-        c = atlas_full ? m_atlas_lru[0] : m_atlas_lru.size()+1;
+        else
+            c = ++m_atlas_live;
         m_atlas[c].uchar = uchar;
+        m_atlas_map[uchar] = c;
         load_glyph(c, uchar);
         n_subst++;
     }
 
-    auto it = find(m_atlas_lru.begin(), m_atlas_lru.end(), (uint8_t)c);
-    if (it != m_atlas_lru.end())
-        m_atlas_lru.erase(it);
-    m_atlas_lru.push_back(c);
+    m_atlas[c].last_used = ++m_atlas_clock;
 
     return c;
 }
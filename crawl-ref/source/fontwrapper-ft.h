@@ -4,6 +4,7 @@
 #ifdef USE_FT
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include <ft2build.h>
@@ -123,9 +124,15 @@ protected:
     struct FontAtlasEntry
     {
         char32_t uchar;
+        // use stamp from m_atlas_clock, for LRU eviction
+        int last_used;
     };
     FontAtlasEntry *m_atlas;
-    vector<char32_t> m_atlas_lru;
+    // codepoint -> atlas slot, so lookups don't scan the whole atlas
+    std::unordered_map<char32_t, unsigned int> m_atlas_map;
+    // number of atlas slots in use (slot 0 is reserved)
+    unsigned int m_atlas_live;
+    int m_atlas_clock;
 
     // count of glyph loads in the current text block
     int n_subst;
@@ -3,6 +3,7 @@
 #include "format.h"
 
 #include <climits>
+#include <unordered_map>
 
 #include "cio.h"
 #include "colour.h"
@@ -75,9 +76,22 @@ void display_tagged_block(const string &s)
  * @param main_colour   The initial & default text colour.
  * @return          A formatted string corresponding to the input.
  */
+// Parsed-ops cache. HUD and message redraws parse the same tagged strings
+// over and over, and parsing is a pure function of the source string and
+// initial colour, so memoize the resulting op list and hand out copies
+// instead of re-lexing. Dropped wholesale when full, so one-shot menu
+// text can't grow it without bound.
+static std::unordered_map<string, formatted_string> _parse_cache;
+static const size_t PARSE_CACHE_MAX_ENTRIES = 1024;
+
 formatted_string formatted_string::parse_string(const string &s,
                                                 int main_colour)
 {
+    const string key = std::to_string(main_colour) + ":" + s;
+    auto cached = _parse_cache.find(key);
+    if (cached != _parse_cache.end())
+        return cached->second;
+
     // main_colour will usually be LIGHTGREY (default).
     vector<int> colour_stack(1, main_colour);
     // background will not change anything by default
@@ -91,6 +105,10 @@ formatted_string formatted_string::parse_string(const string &s,
     // if the bg colours are unbalanced, reset to black
     if (bg_stack.back() != bg_stack.front())
         fs.textbackground(bg_stack.back());
+
+    if (_parse_cache.size() >= PARSE_CACHE_MAX_ENTRIES)
+        _parse_cache.clear();
+    _parse_cache[key] = fs;
     return fs;
 }
 
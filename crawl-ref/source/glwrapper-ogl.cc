@@ -327,14 +327,30 @@ void OGLStateManager::set(const GLState& state)
 
 struct {
     GLW_3VF trans, scale;
+    // whether trans/scale match the live modelview matrix; anything that
+    // touches the matrix behind our back must clear this
+    bool valid;
 } current_transform;
 
 void OGLStateManager::set_transform(const GLW_3VF &trans, const GLW_3VF &scale)
 {
+    // Most draws use the same transform as the previous one (usually the
+    // identity); don't reload the matrix for those.
+    if (current_transform.valid
+        && trans.x == current_transform.trans.x
+        && trans.y == current_transform.trans.y
+        && trans.z == current_transform.trans.z
+        && scale.x == current_transform.scale.x
+        && scale.y == current_transform.scale.y
+        && scale.z == current_transform.scale.z)
+    {
+        return;
+    }
+
     glLoadIdentity();
     glTranslatef(trans.x, trans.y, trans.z);
     glScalef(scale.x, scale.y, scale.z);
-    current_transform = { trans, scale };
+    current_transform = { trans, scale, true };
 }
 
 void OGLStateManager::reset_transform()
@@ -362,14 +378,29 @@ int OGLStateManager::device_to_logical(int n, bool round) const
 
 void OGLStateManager::set_scissor(int x, int y, unsigned int w, unsigned int h)
 {
+    if (m_scissor_set
+        && m_scissor[0] == x && m_scissor[1] == y
+        && m_scissor[2] == (int)w && m_scissor[3] == (int)h)
+    {
+        return;
+    }
+
     glEnable(GL_SCISSOR_TEST);
     glScissor(logical_to_device(x), logical_to_device(m_window_height-y-h),
                 logical_to_device(w), logical_to_device(h));
+    m_scissor_set = true;
+    m_scissor[0] = x;
+    m_scissor[1] = y;
+    m_scissor[2] = w;
+    m_scissor[3] = h;
 }
 
 void OGLStateManager::reset_scissor()
 {
+    if (!m_scissor_set)
+        return;
     glDisable(GL_SCISSOR_TEST);
+    m_scissor_set = false;
 }
 
 void OGLStateManager::reset_view_for_resize(const coord_def &m_windowsz,
@@ -378,6 +409,10 @@ void OGLStateManager::reset_view_for_resize(const coord_def &m_windowsz,
     glViewport(0, 0, m_drawablesz.x, m_drawablesz.y);
     m_window_height = m_windowsz.y;
 
+    // A cached scissor rect maps to different device pixels after a
+    // resize or density change; force the next set_scissor through.
+    m_scissor[2] = -1;
+
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
 
@@ -404,6 +439,8 @@ void OGLStateManager::delete_textures(size_t count, unsigned int *textures)
 {
     glDeleteTextures(count, (GLuint*)textures);
     glDebug("glDeleteTextures");
+    // deleting the bound texture unbinds it, and freed names can be reused
+    m_current_texture = -1;
 }
 
 void OGLStateManager::generate_textures(size_t count, unsigned int *textures)
@@ -414,8 +451,14 @@ void OGLStateManager::generate_textures(size_t count, unsigned int *textures)
 
 void OGLStateManager::bind_texture(unsigned int texture)
 {
+    // Consecutive draws very often share a texture (the tile page, the
+    // font atlas); skip the rebind for those.
+    if ((int)texture == m_current_texture)
+        return;
+
     glBindTexture(GL_TEXTURE_2D, texture);
     glDebug("glBindTexture");
+    m_current_texture = texture;
 }
 
 void OGLStateManager::load_texture(unsigned char *pixels, unsigned int width,
@@ -495,6 +538,8 @@ void OGLStateManager::reset_view_for_redraw()
 
     glTranslatef(0.0f, 0.0f, 1.0f);
     glDebug("glTranslatef");
+
+    current_transform.valid = false;
 }
 
 bool OGLStateManager::glDebug(const char* msg) const
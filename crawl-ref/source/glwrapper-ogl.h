@@ -38,6 +38,11 @@ public:
 protected:
     GLState m_current_state;
     int m_window_height;
+    // redundant-call elision: the texture currently bound and the scissor
+    // rect currently set, or -1/unset when unknown
+    int m_current_texture = -1;
+    bool m_scissor_set = false;
+    int m_scissor[4];
     // optional, possibly nullptr function pointer to OpenGL 3+ function
     // The function pointer type is often ifdef'd in annoying headers
     // So we save the cast for the point where we use it, rather than
@@ -48,6 +48,7 @@
 #include "spl-clouds.h"
 #include "spl-zap.h"
 #include "state.h"
+#include "status.h"
 #include "stringutil.h"
 #include "tag-version.h"
 #include "terrain.h"
@@ -1856,7 +1857,7 @@ void wu_jian_trigger_serpents_lash(bool wall_jump)
         you.turn_is_over = false;
         you.elapsed_time_at_last_input = you.elapsed_time;
         you.attribute[ATTR_SERPENTS_LASH] -= wall_jump ? 2 : 1;
-        you.redraw_status_lights = true;
+        invalidate_status_cache();
         update_turn_count();
         fire_final_effects();
         mons_reset_just_seen();
@@ -798,21 +798,49 @@ void scorefile_entry::init_from(const scorefile_entry &se)
 
     // We could just reset raw_line to "" instead.
     raw_line          = se.raw_line;
+    deferred_parse    = se.deferred_parse;
 }
 
 actor* scorefile_entry::killer() const
 {
+    ensure_parsed();
     return actor_by_mid(death_source);
 }
 
 xlog_fields scorefile_entry::get_fields() const
 {
+    ensure_parsed();
     if (!fields)
         return xlog_fields();
     else
         return *fields;
 }
 
+// Extracts just the sc= field from an xlog line, walking the fields the
+// same way _xlog_split_fields does (':' separates, '::' is an escaped
+// colon) without building any of them.
+static int _parse_score_field(const string &line)
+{
+    string::size_type start = 0;
+    while (start < line.length())
+    {
+        string::size_type end = start;
+        while ((end = line.find(':', end)) != string::npos
+               && end + 1 < line.length() && line[end + 1] == ':')
+        {
+            end += 2;
+        }
+        if (end == string::npos)
+            end = line.length();
+
+        if (!line.compare(start, 3, "sc="))
+            return atoi(line.c_str() + start + 3);
+
+        start = end + 1;
+    }
+    return 0;
+}
+
 bool scorefile_entry::parse(const string &line)
 {
     // Scorefile formats down the ages:
@@ -836,7 +864,26 @@ bool scorefile_entry::parse(const string &line)
     }
 
     raw_line = line;
-    return parse_scoreline(line);
+
+    // Every death reparses the whole scores file just to slot in one
+    // line, and rewriting it only needs the raw lines back. Pull out
+    // nothing but the score here; the full field decode waits until
+    // somebody actually looks at the entry (ensure_parsed()).
+    points = _parse_score_field(line);
+    deferred_parse = true;
+    return true;
+}
+
+// Deferred full decode of a parse()d line. Logically const, so the lazy
+// accessors can invoke it.
+void scorefile_entry::ensure_parsed() const
+{
+    if (!deferred_parse)
+        return;
+
+    scorefile_entry *self = const_cast<scorefile_entry*>(this);
+    self->deferred_parse = false;
+    self->parse_scoreline(raw_line);
 }
 
 string scorefile_entry::raw_string() const
@@ -1142,14 +1189,14 @@ void scorefile_entry::set_base_xlog_fields() const
     fields->add_field("explbr", EXPERIMENTAL_BRANCH);
 #endif
     if (tiles)
-        fields->add_field("tiles", "%d", tiles);
+        fields->add_field("tiles", tiles);
     fields->add_field("name", "%s", name.c_str());
     fields->add_field("race", "%s", _species_name(race).c_str());
     fields->add_field("cls",  "%s", _job_name(job));
     fields->add_field("char", "%s", race_class_name.c_str());
-    fields->add_field("xl",    "%d", lvl);
+    fields->add_field("xl",    lvl);
     fields->add_field("sk",    "%s", skill_name(best_skill));
-    fields->add_field("sklev", "%d", best_skill_lvl);
+    fields->add_field("sklev", best_skill_lvl);
     fields->add_field("title", "%s", title.c_str());
 
     fields->add_field("place", "%s",
@@ -1161,47 +1208,47 @@ void scorefile_entry::set_base_xlog_fields() const
     // Note: "br", "lvl" (and former "ltyp") are redundant with "place"
     // but may still be used by DGL logs.
     fields->add_field("br",   "%s", _short_branch_name(branch));
-    fields->add_field("lvl",  "%d", dlvl);
-    fields->add_field("absdepth", "%d", absdepth);
-
-    fields->add_field("hp",   "%d", final_hp);
-    fields->add_field("mhp",  "%d", final_max_hp);
-    fields->add_field("mmhp", "%d", final_max_max_hp);
-    fields->add_field("mp",   "%d", final_mp);
-    fields->add_field("mmp",  "%d", final_max_mp);
-    fields->add_field("bmmp", "%d", final_base_max_mp);
-    fields->add_field("str", "%d", str);
-    fields->add_field("int", "%d", intel);
-    fields->add_field("dex", "%d", dex);
-    fields->add_field("ac", "%d", ac);
-    fields->add_field("ev", "%d", ev);
-    fields->add_field("sh", "%d", sh);
+    fields->add_field("lvl",  dlvl);
+    fields->add_field("absdepth", absdepth);
+
+    fields->add_field("hp",   final_hp);
+    fields->add_field("mhp",  final_max_hp);
+    fields->add_field("mmhp", final_max_max_hp);
+    fields->add_field("mp",   final_mp);
+    fields->add_field("mmp",  final_max_mp);
+    fields->add_field("bmmp", final_base_max_mp);
+    fields->add_field("str", str);
+    fields->add_field("int", intel);
+    fields->add_field("dex", dex);
+    fields->add_field("ac", ac);
+    fields->add_field("ev", ev);
+    fields->add_field("sh", sh);
 
     fields->add_field("god", "%s", god == GOD_NO_GOD ? "" :
                       god_name(god).c_str());
 
     if (wiz_mode)
-        fields->add_field("wiz", "%d", wiz_mode);
+        fields->add_field("wiz", wiz_mode);
     if (explore_mode)
-        fields->add_field("explore", "%d", explore_mode);
+        fields->add_field("explore", explore_mode);
 
     fields->add_field("start", "%s", make_date_string(birth_time).c_str());
-    fields->add_field("dur",   "%d", (int)real_time);
-    fields->add_field("turn",  "%d", num_turns);
-    fields->add_field("aut",   "%d", num_aut);
+    fields->add_field("dur",   (int)real_time);
+    fields->add_field("turn",  num_turns);
+    fields->add_field("aut",   num_aut);
 
     if (num_diff_runes)
-        fields->add_field("urune", "%d", num_diff_runes);
+        fields->add_field("urune", num_diff_runes);
 
     if (num_runes)
-        fields->add_field("nrune", "%d", num_runes);
+        fields->add_field("nrune", num_runes);
 
     if (gems_found)
-        fields->add_field("fgem", "%d", gems_found);
+        fields->add_field("fgem", gems_found);
     if (gems_intact)
-        fields->add_field("igem", "%d", gems_intact);
+        fields->add_field("igem", gems_intact);
 
-    fields->add_field("kills", "%d", kills);
+    fields->add_field("kills", kills);
     if (!maxed_skills.empty())
         fields->add_field("maxskills", "%s", maxed_skills.c_str());
     if (!fifteen_skills.empty())
@@ -1209,15 +1256,15 @@ void scorefile_entry::set_base_xlog_fields() const
     if (!status_effects.empty())
         fields->add_field("status", "%s", status_effects.c_str());
 
-    fields->add_field("gold", "%d", gold);
-    fields->add_field("goldfound", "%d", gold_found);
-    fields->add_field("goldspent", "%d", gold_spent);
+    fields->add_field("gold", gold);
+    fields->add_field("goldfound", gold_found);
+    fields->add_field("goldspent", gold_spent);
     if (zigs)
-        fields->add_field("zigscompleted", "%d", zigs);
+        fields->add_field("zigscompleted", zigs);
     if (zigmax)
-        fields->add_field("zigdeepest", "%d", zigmax);
-    fields->add_field("scrollsused", "%d", scrolls_used);
-    fields->add_field("potionsused", "%d", potions_used);
+        fields->add_field("zigdeepest", zigmax);
+    fields->add_field("scrollsused", scrolls_used);
+    fields->add_field("potionsused", potions_used);
 }
 
 void scorefile_entry::set_score_fields() const
@@ -1229,7 +1276,7 @@ void scorefile_entry::set_score_fields() const
 
     set_base_xlog_fields();
 
-    fields->add_field("sc", "%d", points);
+    fields->add_field("sc", points);
     fields->add_field("ktyp", "%s", _kill_method_name(kill_method_type(death_type)));
 
     fields->add_field("killer", "%s", death_source_desc().c_str());
@@ -1241,9 +1288,9 @@ void scorefile_entry::set_score_fields() const
             " ", " ");
         fields->add_field("killer_flags", "%s", kflags.c_str());
     }
-    fields->add_field("dam", "%d", damage);
-    fields->add_field("sdam", "%d", source_damage);
-    fields->add_field("tdam", "%d", turn_damage);
+    fields->add_field("dam", damage);
+    fields->add_field("sdam", source_damage);
+    fields->add_field("tdam", turn_damage);
 
     fields->add_field("kaux", "%s", auxkilldata.c_str());
 
@@ -1254,9 +1301,9 @@ void scorefile_entry::set_score_fields() const
         fields->add_field("kpath", "%s", killerpath.c_str());
 
     if (piety > 0)
-        fields->add_field("piety", "%d", piety);
+        fields->add_field("piety", piety);
     if (penance > 0)
-        fields->add_field("pen", "%d", penance);
+        fields->add_field("pen", penance);
 
     fields->add_field("end", "%s", make_date_string(death_time).c_str());
 
@@ -1517,6 +1564,7 @@ void scorefile_entry::reset()
 {
     // simple init
     raw_line.clear();
+    deferred_parse       = false;
     version.clear();
     save_rcs_version.clear();
     save_tag_version.clear();
@@ -1840,6 +1888,7 @@ string scorefile_entry::hiscore_line(death_desc_verbosity verbosity) const
 
 string scorefile_entry::game_time(death_desc_verbosity verbosity) const
 {
+    ensure_parsed();
     string line;
 
     if (verbosity == DDV_VERBOSE)
@@ -2033,6 +2082,7 @@ string scorefile_entry::runes_gems_desc(bool semiverbose) const
 string
 scorefile_entry::character_description(death_desc_verbosity verbosity) const
 {
+    ensure_parsed();
     bool single  = verbosity == DDV_TERSE || verbosity == DDV_ONELINE;
 
     if (single)
@@ -2133,6 +2183,7 @@ static bool _very_boring_death_type(int death_type)
 
 string scorefile_entry::death_place(death_desc_verbosity verbosity) const
 {
+    ensure_parsed();
     bool verbose = (verbosity == DDV_VERBOSE);
     string place;
 
@@ -2172,6 +2223,7 @@ string scorefile_entry::death_place(death_desc_verbosity verbosity) const
  */
 string scorefile_entry::death_description(death_desc_verbosity verbosity) const
 {
+    ensure_parsed();
     bool needs_beam_cause_line = false;
     bool needs_called_by_monster_line = false;
     bool needs_damage = false;
@@ -3067,6 +3119,13 @@ void xlog_fields::add_field(const string &key, const char *format, ...)
     fieldmap[key] = buf;
 }
 
+void xlog_fields::add_field(const string &key, int value)
+{
+    const string buf = to_string(value);
+    fields.emplace_back(key, buf);
+    fieldmap[key] = buf;
+}
+
 string xlog_fields::str_field(const string &s) const
 {
     return lookup(fieldmap, s, "");
@@ -3087,7 +3146,15 @@ void xlog_fields::map_fields() const
 
 string xlog_fields::xlog_line() const
 {
+    // Size the buffer up front; escaping only grows the rare value that
+    // contains a ':'.
+    string::size_type len = 0;
+    for (const pair<string, string> &f : fields)
+        if (!f.second.empty())
+            len += f.first.length() + f.second.length() + 2;
+
     string line;
+    line.reserve(len);
     for (const pair<string, string> &f : fields)
     {
         // Don't write empty fields.
@@ -3095,11 +3162,18 @@ string xlog_fields::xlog_line() const
             continue;
 
         if (!line.empty())
-            line += ":";
+            line += ':';
 
         line += f.first;
-        line += "=";
-        line += _xlog_escape(f.second);
+        line += '=';
+        // xlogfile escape (s/:/::/g), applied while appending instead of
+        // through a temporary string per field.
+        for (const char c : f.second)
+        {
+            line += c;
+            if (c == ':')
+                line += ':';
+        }
     }
 
     return line;
@@ -3142,7 +3216,7 @@ void sync_last_milestone()
                     you.props[LAST_MILESTONE_TYPE_PROP].get_string().c_str());
     xl.add_field("milestone", "%s",
                     you.props[LAST_MILESTONE_PROP].get_string().c_str());
-    xl.add_field("turn", "%d", you.props[LAST_MILESTONE_TURN_PROP].get_int());
+    xl.add_field("turn", you.props[LAST_MILESTONE_TURN_PROP].get_int());
     xl.add_field("status", "milestone_only");
 
     tiles.send_milestone(xl);
@@ -3245,7 +3319,7 @@ void update_whereis_chargen(string name)
         return;
     xlog_fields xl;
     xl.add_field("name", "%s", name.c_str());
-    xl.add_field("lvl", "%d", 0);
+    xl.add_field("lvl", 0);
     xl.add_field("time", "%s", make_date_string(time(nullptr)).c_str());
     xl.add_field("status", "chargen");
     xl.add_field("milestone", "started generating a character.");
@@ -54,6 +54,9 @@ public:
 #endif
 
     void add_field(const string &key, PRINTF(2, ));
+    // Direct numeric emission; most xlog fields are plain ints and don't
+    // need a trip through printf formatting.
+    void add_field(const string &key, int value);
 
     string str_field(const string &) const;
     int int_field(const string &) const;
@@ -151,6 +154,10 @@ private:
 
     mutable unique_ptr<xlog_fields> fields;
 
+    // True for entries read from disk whose full field decode is still
+    // pending; see ensure_parsed().
+    bool deferred_parse;
+
 public:
     scorefile_entry();
     scorefile_entry(int damage, mid_t death_source, int death_type,
@@ -186,10 +193,12 @@ public:
     string death_place(death_desc_verbosity) const;
     string game_time(death_desc_verbosity) const;
 
-    string get_name() const       { return name; }
+    // get_score() doesn't need the full decode: the score is extracted
+    // up front when a line is parse()d.
+    string get_name() const       { ensure_parsed(); return name; }
     int    get_score() const      { return points; }
-    int    get_death_type() const { return death_type; }
-    time_t get_death_time() const { return death_time; }
+    int    get_death_type() const { ensure_parsed(); return death_type; }
+    time_t get_death_time() const { ensure_parsed(); return death_time; }
     actor* killer() const; // Obviously does not work across games.
     xlog_fields get_fields() const;
 
@@ -210,6 +219,7 @@ private:
     string runes_gems_desc(bool semiverbose) const;
 
     bool parse_scoreline(const string &line);
+    void ensure_parsed() const;
 
     void init_with_fields();
     void add_auxkill_field() const;
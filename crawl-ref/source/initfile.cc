@@ -600,6 +600,7 @@ const vector<GameOption*> game_options::build_options_list()
             false
 #endif
             ),
+        new IntGameOption(SIMPLE_NAME(animation_budget_ms), 0, 0, 60000),
 
         new ListGameOption<text_pattern>(SIMPLE_NAME(unusual_monster_items), {}, true,
                                          {[this]() { process_unusual_items(); }}),
@@ -647,6 +648,7 @@ const vector<GameOption*> game_options::build_options_list()
         new IntGameOption(SIMPLE_NAME(note_hp_percent), 5, 0, 100),
         new IntGameOption(SIMPLE_NAME(hp_warning), 30, 0, 100),
         new IntGameOption(magic_point_warning, {"mp_warning"}, 0, 0, 100),
+        new IntGameOption(SIMPLE_NAME(slow_turn_budget_ms), 0, 0, 60000),
         new IntGameOption(SIMPLE_NAME(autofight_warning), 0, 0, 1000),
         // These need to be odd, hence allow +1.
         new IntGameOption(SIMPLE_NAME(view_max_width),
@@ -780,6 +782,7 @@ const vector<GameOption*> game_options::build_options_list()
              {"classic", level_gen_type::classic},
              {"false", level_gen_type::classic}
             }, true),
+        new BoolGameOption(SIMPLE_NAME(pregen_whole_branches), false),
         new BoolGameOption(SIMPLE_NAME(single_column_item_menus), true),
 
 #ifdef DGL_SIMPLE_MESSAGING
@@ -1013,10 +1016,10 @@ const vector<GameOption*> game_options::build_options_list()
     return options;
 }
 
-map<string, GameOption*> base_game_options::build_options_map(
+unordered_map<string, GameOption*> base_game_options::build_options_map(
     const vector<GameOption*> &options)
 {
-    map<string, GameOption*> option_map;
+    unordered_map<string, GameOption*> option_map;
     for (GameOption* option : options)
         for (string name : option->getNames())
             option_map[name] = option;
@@ -4658,9 +4661,47 @@ void base_game_options::include(const string &rawfilename, bool resolve,
     // Also unwind any aliases defined in included files.
     unwind_var<map<string, string>> unalias(aliases);
 
-    FileLineInput fl(include_file.c_str());
-    if (!fl.error())
-        read_options(fl, runscripts, false);
+    // Cache the decoded contents of included files, revalidated by mtime,
+    // so that re-triggered option reads during play (and the repeated
+    // shared includes of server rcs) skip the disk read and BOM/locale
+    // decoding. The lines still run through read_options: option effects
+    // depend on parse-time state (variables, Lua), so only the text can
+    // be reused safely.
+    struct include_cache_entry
+    {
+        time_t mtime;
+        bool read_failed;
+        bool populated;
+        string text;
+    };
+    static map<string, include_cache_entry> _include_cache;
+
+    include_cache_entry &cache = _include_cache[include_file];
+    const time_t mtime = file_modtime(include_file);
+    if (!cache.populated || cache.mtime != mtime)
+    {
+        cache.mtime = mtime;
+        cache.read_failed = false;
+        cache.populated = true;
+        cache.text.clear();
+        FileLineInput file_in(include_file.c_str());
+        if (file_in.error())
+            cache.read_failed = true;
+        else
+        {
+            while (!file_in.eof())
+            {
+                cache.text += file_in.get_line();
+                cache.text += '\n';
+            }
+        }
+    }
+
+    if (cache.read_failed)
+        return;
+
+    StringLineInput fl(cache.text);
+    read_options(fl, runscripts, false);
 }
 
 void base_game_options::report_error(const char* format, ...)
@@ -4772,6 +4813,7 @@ enum commandline_option_type
     CLO_MAPSTAT_DUMP_DISCONNECT,
     CLO_OBJSTAT,
     CLO_ITERATIONS,
+    CLO_MAPSTAT_JOBS,
     CLO_FORCE_MAP,
     CLO_ARENA,
     CLO_DUMP_MAPS,
@@ -4814,6 +4856,7 @@ enum commandline_option_type
     CLO_PRINT_WEBTILES_OPTIONS,
 #endif
     CLO_RESET_CACHE,
+    CLO_STARTUP_REPORT,
 
     CLO_NOPS
 };
@@ -4824,6 +4867,7 @@ static set<commandline_option_type> clo_headless_ok = {
     CLO_SCORES,
     CLO_BUILDDB,
     CLO_RESET_CACHE,
+    CLO_STARTUP_REPORT,
     CLO_HELP,
     CLO_VERSION,
     CLO_PLAYABLE_JSON, // JSON metadata for species, jobs, combos.
@@ -4852,7 +4896,8 @@ static const char *cmd_ops[] =
 {
     "scores", "name", "species", "background", "dir", "rc", "rcdir", "tscores",
     "vscores", "scorefile", "morgue", "macro", "mapstat", "dump-disconnect",
-    "objstat", "iters", "force-map", "arena", "dump-maps", "test", "script",
+    "objstat", "iters", "mapstat-jobs", "force-map", "arena", "dump-maps",
+    "test", "script",
     "builddb", "help", "version", "seed", "pregen", "save-version", "sprint",
     "extra-opt-first", "extra-opt-last", "sprint-map", "edit-save",
     "print-charset", "tutorial", "wizard", "explore", "no-save",
@@ -4865,7 +4910,7 @@ static const char *cmd_ops[] =
 #ifdef USE_TILE_WEB
     "webtiles-socket", "await-connection", "print-webtiles-options",
 #endif
-    "reset-cache",
+    "reset-cache", "startup-report",
 };
 
 
@@ -5685,6 +5730,7 @@ bool parse_args(int argc, char **argv, bool rc_only)
 
     SysEnv.rcdirs.clear();
     SysEnv.map_gen_iters = 0;
+    SysEnv.map_gen_jobs = 1;
 
     if (argc < 2)           // no args!
         return true;
@@ -5872,6 +5918,26 @@ bool parse_args(int argc, char **argv, bool rc_only)
 #endif
             break;
 
+        case CLO_MAPSTAT_JOBS:
+#if defined(DEBUG_STATISTICS) && defined(UNIX)
+            if (!next_is_param || !isadigit(*next_arg))
+                end(1, false, "Integer argument required for -%s\n", arg);
+            else
+            {
+                SysEnv.map_gen_jobs = atoi(next_arg);
+                if (SysEnv.map_gen_jobs < 1)
+                    SysEnv.map_gen_jobs = 1;
+                else if (SysEnv.map_gen_jobs > 16)
+                    SysEnv.map_gen_jobs = 16;
+                nextUsed = true;
+            }
+#elif defined(DEBUG_STATISTICS)
+            end(1, false, "mapstat-jobs requires a UNIX build\n");
+#else
+            end(1, false, "%s", dbg_stat_err);
+#endif
+            break;
+
         case CLO_FORCE_MAP:
 #ifdef DEBUG_STATISTICS
             if (!next_is_param)
@@ -5975,6 +6041,12 @@ bool parse_args(int argc, char **argv, bool rc_only)
             crawl_state.use_des_cache = false;
             break;
 
+        case CLO_STARTUP_REPORT:
+            if (next_is_param)
+                return false;
+            crawl_state.startup_report = true;
+            break;
+
         case CLO_GDB:
             crawl_state.no_gdb = 0;
             break;
@@ -11,6 +11,7 @@
 #include <cstring>
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 
 #include "areas.h"
 #include "artefact.h"
@@ -133,6 +134,49 @@ static string _item_inscription(const item_def &item)
                                              ", ").c_str());
 }
 
+// Memoized name_aux results. Name assembly is the top allocator in
+// menu-heavy profiles, and inventory redraws rename every item, so cache
+// the expensive interior of name() (articles, equip markers and
+// inscriptions stay live; they depend on equipment and quiver state).
+//
+// Only items whose name is a pure function of the cache key are eligible:
+// no props-derived names (artefacts, corpses, named books) and no
+// time-varying text (gems' clock countdown). The other inputs to name_aux
+// are you.type_ids, invalidated below from identify_item_type(), and the
+// per-game unidentified description tables, handled by clearing the cache
+// between games.
+static std::unordered_map<string, string> _name_aux_cache;
+
+// Keep a menu's worth of names without letting a long game grow the cache
+// unboundedly.
+static const size_t NAME_CACHE_MAX_ENTRIES = 4096;
+
+void clear_item_name_cache()
+{
+    _name_aux_cache.clear();
+}
+
+static bool _name_aux_cacheable(const item_def &item)
+{
+    if (is_artefact(item))
+        return false;
+
+    switch (item.base_type)
+    {
+    case OBJ_WEAPONS:
+    case OBJ_MISSILES:
+    case OBJ_ARMOUR:
+    case OBJ_WANDS:
+    case OBJ_SCROLLS:
+    case OBJ_POTIONS:
+    case OBJ_JEWELLERY:
+    case OBJ_STAVES:
+        return true;
+    default:
+        return false;
+    }
+}
+
 string item_def::name(description_level_type descrip, bool terse, bool ident,
                       bool with_inscription, bool quantity_in_words) const
 {
@@ -141,7 +185,33 @@ string item_def::name(description_level_type descrip, bool terse, bool ident,
 
     ostringstream buff;
 
-    const string auxname = name_aux(descrip, terse, ident, with_inscription);
+    string auxname;
+    string cache_key;
+    if (_name_aux_cacheable(*this))
+    {
+        // Every item field name_aux reads, plus the relevant arguments.
+        cache_key = make_stringf("%d/%d/%d/%d/%d/%d/%d/%" PRIx64 "/%d%d%d%d/",
+                                 (int)base_type, (int)sub_type, (int)plus,
+                                 (int)plus2, (int)special, (int)rnd,
+                                 (int)quantity, (uint64_t)flags,
+                                 (int)descrip, (int)terse, (int)ident,
+                                 (int)with_inscription)
+                    + inscription;
+        auto cached = _name_aux_cache.find(cache_key);
+        if (cached != _name_aux_cache.end())
+            auxname = cached->second;
+    }
+
+    if (auxname.empty())
+    {
+        auxname = name_aux(descrip, terse, ident, with_inscription);
+        if (!cache_key.empty())
+        {
+            if (_name_aux_cache.size() >= NAME_CACHE_MAX_ENTRIES)
+                _name_aux_cache.clear();
+            _name_aux_cache[cache_key] = auxname;
+        }
+    }
 
     const bool startvowel     = is_vowel(auxname[0]);
     const bool qualname       = (descrip == DESC_QUALNAME);
@@ -2065,6 +2135,8 @@ bool identify_item_type(object_class_type basetype, int subtype)
         return false;
 
     you.type_ids[basetype][subtype] = true;
+    // Cached names of the newly identified type are stale now.
+    clear_item_name_cache();
     maybe_mark_set_known(basetype, subtype);
     request_autoinscribe();
 
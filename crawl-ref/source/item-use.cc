@@ -2119,6 +2119,10 @@ static void _brand_weapon(item_def &wpn)
 
     _rebrand_weapon(wpn);
 
+    // The brand of a wielded weapon just changed in place; refresh the
+    // equipment brand tallies.
+    you.equipment.update();
+
     bool success = true;
     colour_t flash_colour = BLACK;
 
@@ -97,6 +97,30 @@ static bool _merge_items_into_inv(item_def &it, int quant_got,
 static bool will_autopickup   = false;
 static bool will_autoinscribe = false;
 
+// Lowest env.item index that might be free: the first-fit scan in
+// get_mitm_slot starts here instead of at 0, so allocating n items costs
+// O(n) overall instead of O(n^2). The hint is conservative - it is
+// lowered whenever a slot is freed through init_item/destroy_item and
+// reset when the array is wholesale replaced via link_items - so it can
+// never skip past a free slot.
+static int _min_free_slot = 0;
+
+// Bumped whenever floor item state changes (stacks linked, unlinked,
+// moved, resized or identified in place). Readers snapshot the counter
+// and can skip rescanning squares while it is unchanged; see
+// Stash::update. Same idiom as terrain_change_mark().
+static unsigned _item_change_mark = 1;
+
+unsigned item_change_mark()
+{
+    return _item_change_mark;
+}
+
+static void _note_item_change()
+{
+    _item_change_mark++;
+}
+
 static inline string _autopickup_item_name(const item_def &item)
 {
     return userdef_annotate_item(STASH_LUA_SEARCH_ANNOTATE, &item)
@@ -125,6 +149,11 @@ void fix_item_coordinates()
 // This function uses the items coordinates to relink all the env.igrid lists.
 void link_items()
 {
+    // The item array may just have been replaced under us (level load,
+    // abyss shift), so any free slot hint is stale.
+    _min_free_slot = 0;
+    _note_item_change();
+
     // First, initialise env.igrid array.
     env.igrid.init(NON_ITEM);
 
@@ -426,6 +455,7 @@ bool dec_mitm_item_quantity(int obj, int amount, bool player_action)
     }
 
     item.quantity -= amount;
+    _note_item_change();
     return false;
 }
 
@@ -438,6 +468,7 @@ void inc_mitm_item_quantity(int obj, int amount)
 {
     env.item[obj].quantity += amount;
     ASSERT(env.item[obj].defined());
+    _note_item_change();
 }
 
 void init_item(int item)
@@ -446,6 +477,8 @@ void init_item(int item)
         return;
 
     env.item[item].clear();
+    if (item < _min_free_slot)
+        _min_free_slot = item;
 }
 
 // Returns an unused env.item slot, or NON_ITEM if none available.
@@ -460,10 +493,14 @@ int get_mitm_slot(int reserve)
 
     int item = NON_ITEM;
 
-    for (item = 0; item < (MAX_ITEMS - reserve); item++)
+    for (item = _min_free_slot; item < (MAX_ITEMS - reserve); item++)
         if (!env.item[item].defined())
             break;
 
+    // Everything below the slot we just found is in use.
+    if (item < MAX_ITEMS - reserve)
+        _min_free_slot = item;
+
     if (item >= MAX_ITEMS - reserve)
     {
         if (crawl_state.game_is_arena())
@@ -495,6 +532,8 @@ void unlink_item(int dest)
     if (dest == NON_ITEM || !env.item[dest].defined())
         return;
 
+    _note_item_change();
+
     monster* mons = env.item[dest].holding_monster();
 
     if (mons != nullptr)
@@ -633,6 +672,11 @@ void destroy_item(item_def &item, bool never_created)
     }
 
     item.clear();
+
+    // If this was a floor/monster item, its slot is free again.
+    const int idx = item.index();
+    if (valid_item_index(idx) && idx < _min_free_slot)
+        _min_free_slot = idx;
 }
 
 void destroy_item(int dest, bool never_created)
@@ -680,6 +724,7 @@ void lose_item_stack(const coord_def& where)
         }
     }
     env.igrid(where) = NON_ITEM;
+    _note_item_change();
 }
 
 /**
@@ -978,6 +1023,10 @@ void identify_item(item_def& item)
 
     item.flags |= ISFLAG_IDENTIFIED;
 
+    // Identifying a floor item changes what a stash scan would record.
+    if (!in_inventory(item))
+        _note_item_change();
+
     request_autoinscribe();
 
     if (!is_artefact(item) && !crawl_state.game_is_arena())
@@ -2658,6 +2707,8 @@ bool move_item_to_grid(int *const obj, const coord_def& p, bool silent)
     if (p == you.pos() && _id_floor_item(item))
         mprf("You see here %s.", item.name(DESC_A).c_str());
 
+    _note_item_change();
+
     return true;
 }
 
@@ -2681,6 +2732,7 @@ void move_item_stack_to_grid(const coord_def& from, const coord_def& to)
 
     env.igrid(to) = env.igrid(from);
     env.igrid(from) = NON_ITEM;
+    _note_item_change();
 }
 
 // Returns the mitm index of the item. If the item was copied but destroyed,
@@ -4892,6 +4944,7 @@ void move_items(const coord_def r, const coord_def p)
     // Move entire stack over to p.
     env.igrid(p) = env.igrid(r);
     env.igrid(r) = NON_ITEM;
+    _note_item_change();
 }
 
 int runes_in_pack()
@@ -86,6 +86,11 @@ void link_items();
 
 void fix_item_coordinates();
 
+// Generation counter bumped whenever floor item state changes (stacks
+// linked, unlinked, moved, resized or identified in place). Snapshot it
+// to skip rescanning item piles while it is unchanged.
+unsigned item_change_mark();
+
 int get_mitm_slot(int reserve = 50);
 
 void unlink_item(int dest);
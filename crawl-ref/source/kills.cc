@@ -268,8 +268,8 @@ void Kills::merge(const Kills &k)
     // Regular kills are messier to merge.
     for (const auto &entry : k.kills)
     {
-        const kill_monster_desc &kmd = entry.first;
-        kill_def &ki = kills[kmd];
+        const kill_monster_desc kmd = kill_monster_desc::unpacked(entry.first);
+        kill_def &ki = kills[entry.first];
         const kill_def &ko = entry.second;
         bool uniq = mons_is_unique(kmd.monnum);
         ki.merge(ko, uniq);
@@ -290,7 +290,7 @@ void Kills::record_kill(const monster* mon)
     // Create a descriptor
     kill_monster_desc descriptor = mon;
 
-    kill_def &k = kills[descriptor];
+    kill_def &k = kills[descriptor.packed()];
     if (k.kills)
         k.add_kill(mon, level_id::current());
     else
@@ -302,7 +302,7 @@ int Kills::get_kills(vector<kill_exp> &all_kills) const
     int count = 0;
     for (const auto &entry : kills)
     {
-        const kill_monster_desc &md = entry.first;
+        const kill_monster_desc md = kill_monster_desc::unpacked(entry.first);
         if (mons_class_is_firewood(md.monnum))
             continue;
         const kill_def &k = entry.second;
@@ -325,7 +325,7 @@ void Kills::save(writer& outf) const
 
     for (const auto &entry : kills)
     {
-        entry.first.save(outf);
+        kill_monster_desc::unpacked(entry.first).save(outf);
         entry.second.save(outf);
     }
 
@@ -344,7 +344,7 @@ void Kills::load(reader& inf)
     {
         kill_monster_desc md;
         md.load(inf);
-        kills[md].load(inf);
+        kills[md.packed()].load(inf);
     }
 
     short ghost_count = unmarshallShort(inf);
@@ -379,13 +379,13 @@ int Kills::num_kills(const monster_info& mon) const
 
 int Kills::num_kills(kill_monster_desc desc) const
 {
-    auto iter = kills.find(desc);
+    auto iter = kills.find(desc.packed());
     int total = (iter == kills.end() ? 0 : iter->second.kills);
 
     if (desc.modifier == kill_monster_desc::M_SHAPESHIFTER)
     {
         desc.modifier = kill_monster_desc::M_NORMAL;
-        iter = kills.find(desc);
+        iter = kills.find(desc.packed());
         total += (iter == kills.end() ? 0 : iter->second.kills);
     }
 
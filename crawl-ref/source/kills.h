@@ -6,8 +6,8 @@
 #pragma once
 
 #include <cstdio>
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "enum.h"
@@ -37,15 +37,21 @@ struct kill_monster_desc
     monster_type monnum;        // Number of the beast
     name_modifier modifier;     // Nature of the beast
 
-    struct less_than
+    // The kill table is keyed on this packed form, so that per-kill
+    // bookkeeping is integer hashing; expansion back to a descriptive
+    // form is deferred to dump time.
+    int packed() const
     {
-        bool operator () (const kill_monster_desc &m1,
-                          const kill_monster_desc &m2) const
-        {
-            return m1.monnum < m2.monnum
-                   || (m1.monnum == m2.monnum && m1.modifier < m2.modifier);
-        }
-    };
+        return monnum * 16 + modifier;
+    }
+
+    static kill_monster_desc unpacked(int key)
+    {
+        kill_monster_desc desc;
+        desc.monnum = static_cast<monster_type>(key / 16);
+        desc.modifier = static_cast<name_modifier>(key % 16);
+        return desc;
+    }
 };
 
 #define PLACE_LIMIT 5   // How many unique kill places we're prepared to track
@@ -145,8 +151,7 @@ public:
 private:
     int num_kills(kill_monster_desc desc) const;
 
-    typedef map<kill_monster_desc, kill_def,
-                kill_monster_desc::less_than> kill_map;
+    typedef unordered_map<int, kill_def> kill_map;
     typedef vector<kill_ghost> ghost_vec;
 
     kill_map    kills;
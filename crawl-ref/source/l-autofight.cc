@@ -182,6 +182,39 @@ LUAFN(autofight_is_candidate_for_attack)
     return 1;
 }
 
+/*** Which squares have a monster worth attacking? Runs the same check as
+ * is_candidate_for_attack over the whole field of view in one call, so the
+ * per-cell loop doesn't cross the Lua boundary; policy (scoring, target
+ * choice) stays with the caller. Returns a flat array
+ * {x1, y1, x2, y2, ...} in player coordinates, in the same order the cells
+ * would be visited by a -los..los nested loop.
+ * @tparam boolean whether we are allowed to move
+ * @tparam boolean whether to check and exclude shot paths blocked by monsters
+ * @treturn table flat array of candidate coordinates
+ * @function attack_candidates
+ */
+LUAFN(autofight_attack_candidates)
+{
+    const bool no_move = lua_toboolean(ls, 1);
+    const bool check_path = lua_toboolean(ls, 2);
+
+    lua_newtable(ls);
+    int n = 0;
+    const int r = you.current_vision;
+    for (int dx = -r; dx <= r; dx++)
+        for (int dy = -r; dy <= r; dy++)
+        {
+            const coord_def c = player2grid(coord_def(dx, dy));
+            if (!_is_candidate_for_autofight_attack(c, no_move, check_path))
+                continue;
+            lua_pushnumber(ls, dx);
+            lua_rawseti(ls, -2, ++n);
+            lua_pushnumber(ls, dy);
+            lua_rawseti(ls, -2, ++n);
+        }
+    return 1;
+}
+
 /*** Is the weapon/throwable the player is using penetrating?
  * @tparam boolean Whether we're firing the quivered action (as opposed to our weapon)
  */
@@ -199,6 +232,7 @@ static const struct luaL_Reg autofight_lib[] =
 {
     { "best_aim", autofight_best_aim },
     { "is_candidate_for_attack", autofight_is_candidate_for_attack},
+    { "attack_candidates", autofight_attack_candidates},
     { "is_piercing", autofight_is_piercing},
     { nullptr, nullptr }
 };
@@ -34,6 +34,7 @@
 #include "sound.h"
 #include "state.h"
 #include "state.h"
+#include "status.h"
 #include "stringutil.h"
 #include "throw.h"
 #include "tutorial.h"
@@ -1654,7 +1655,7 @@ LUAFN(_crawl_redraw_stats)
     you.redraw_experience    = true;
     you.redraw_armour_class  = true;
     you.redraw_evasion       = true;
-    you.redraw_status_lights = true;
+    invalidate_status_cache();
     quiver::set_needs_redraw();
 
 
@@ -1861,7 +1862,12 @@ LUAFN(crawl_setfenv)
     if (lua_gettop(ls) != 2)
         luaL_error(ls, "crawl.setfenv: Too many arguments given");
 
+#ifdef USE_LUAJIT
+    // 5.1 keeps function environments separate from upvalues.
+    lua_setfenv(ls, 1);
+#else
     lua_setupvalue(ls, 1, 1);
+#endif
     return 1;
 }
 
@@ -16,6 +16,7 @@
 #include "colour.h"
 #include "coord.h"
 #include "describe.h"
+#include "dungeon.h" // stock_deferred_shop
 #include "env.h"
 #include "evoke.h" // evoke_damage_string()
 #include "invent.h"
@@ -1567,6 +1568,7 @@ int lua_push_shop_items_at(lua_State *ls, const coord_def &s)
     shop_struct *shop = shop_at(s);
     if (!shop)
         return 0;
+    stock_deferred_shop(*shop);
     shopping_list.refresh(); // prevent crash if called during tests
 
     lua_newtable(ls);
@@ -983,9 +983,47 @@ LUAFN(mi_get_monster_at)
     return 1;
 }
 
+/*** Get all visible monsters in a rectangle with one call, rather than
+ * looping get_monster_at over every cell and paying the cross-language call
+ * overhead each time. Uses the same player-centered coordinates and
+ * visibility rules as get_monster_at; positions are available on the
+ * returned objects via pos().
+ * @tparam int x1
+ * @tparam int y1
+ * @tparam int x2
+ * @tparam int y2
+ * @treturn table[monster.info] array of monster information objects
+ * @function get_monsters_in_rect
+ */
+LUAFN(mi_get_monsters_in_rect)
+{
+    COORDSHOW(s1, 1, 2)
+    COORDSHOW(s2, 3, 4)
+    const coord_def tl(min(s1.x, s2.x), min(s1.y, s2.y));
+    const coord_def br(max(s1.x, s2.x), max(s1.y, s2.y));
+
+    lua_newtable(ls);
+    int n = 0;
+    for (int y = tl.y; y <= br.y; y++)
+        for (int x = tl.x; x <= br.x; x++)
+        {
+            const coord_def p = player2grid(coord_def(x, y));
+            if (!you.see_cell(p) || env.mgrid(p) == NON_MONSTER)
+                continue;
+            monster* m = &env.mons[env.mgrid(p)];
+            if (!m->visible_to(&you))
+                continue;
+            monster_info mi(m);
+            lua_push_moninf(ls, &mi);
+            lua_rawseti(ls, -2, ++n);
+        }
+    return 1;
+}
+
 static const struct luaL_Reg mon_lib[] =
 {
     { "get_monster_at", mi_get_monster_at },
+    { "get_monsters_in_rect", mi_get_monsters_in_rect },
 
     { nullptr, nullptr }
 };
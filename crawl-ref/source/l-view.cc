@@ -380,6 +380,40 @@ LUAFN(view_get_map)
     return 1;
 }
 
+/*** What are the features in a whole rectangle? One call to this replaces a
+ * per-cell loop of feature_at calls, each of which pays cross-language call
+ * overhead. Returns a flat array of feature names in row-major order: the
+ * name for (x, y) is at index (y - y1) * (x2 - x1 + 1) + (x - x1) + 1.
+ * Out-of-bounds cells read as "unseen", as with feature_at.
+ * @tparam int x1
+ * @tparam int y1
+ * @tparam int x2
+ * @tparam int y2
+ * @treturn table[string] feature names
+ * @function features_in_rect
+ */
+LUAFN(view_features_in_rect)
+{
+    PLAYERCOORDS(p1, 1, 2)
+    PLAYERCOORDS(p2, 3, 4)
+    const coord_def tl(min(p1.x, p2.x), min(p1.y, p2.y));
+    const coord_def br(max(p1.x, p2.x), max(p1.y, p2.y));
+
+    lua_createtable(ls, (br.x - tl.x + 1) * (br.y - tl.y + 1), 0);
+    int i = 0;
+    for (int y = tl.y; y <= br.y; y++)
+        for (int x = tl.x; x <= br.x; x++)
+        {
+            const coord_def p(x, y);
+            if (map_bounds(p))
+                lua_pushstring(ls, dungeon_feature_name(env.map_knowledge(p).feat()));
+            else
+                lua_pushstring(ls, "unseen");
+            lua_rawseti(ls, -2, ++i);
+        }
+    return 1;
+}
+
 /*** Are the given coordinates in the minimal bounding box of the known map?
  * @tparam int x
  * @tparam int y
@@ -414,6 +448,7 @@ static const struct luaL_Reg view_lib[] =
     { "cell_see_cell_no_trans", view_cell_see_cell_no_trans },
     { "cell_see_cell_solid", view_cell_see_cell_solid },
     { "cell_see_cell_solid_see", view_cell_see_cell_solid_see },
+    { "features_in_rect", view_features_in_rect },
     { "in_known_map_bounds", view_in_known_map_bounds },
     { "get_map", view_get_map },
 
@@ -63,9 +63,18 @@ public:
         return branch < NUM_BRANCHES && depth > 0;
     }
 
+    // A single integer that orders the same way as (branch, depth),
+    // so the comparisons behind every level-keyed map (travel cache,
+    // stashes, overview) are one compare instead of two. Depths are
+    // far smaller than 256, and -1 (invalid) still sorts first.
+    int flat_key() const
+    {
+        return (static_cast<int>(branch) << 8) + depth;
+    }
+
     bool operator == (const level_id &id) const
     {
-        return branch == id.branch && depth == id.depth;
+        return flat_key() == id.flat_key();
     }
 
     bool operator != (const level_id &id) const
@@ -75,7 +84,7 @@ public:
 
     bool operator <(const level_id &id) const
     {
-        return branch < id.branch || (branch==id.branch && depth < id.depth);
+        return flat_key() < id.flat_key();
     }
 
     void save(writer&) const;
@@ -553,6 +553,24 @@ static bool _curses_has_key()
     return _curses_fetch_pending_key(false);
 }
 
+// Set when update_screen() has work for the terminal; flushed just before
+// waiting for input (and in delay()). ncurses already coalesces cell
+// writes into row spans and tracks the damaged region internally, so the
+// point of deferring is to transmit one frame per input-loop iteration
+// instead of one per update_screen() call - intermediate states within a
+// turn never reach the terminal, which is what SSH players notice.
+static bool _refresh_pending = false;
+
+static void _flush_refresh()
+{
+    if (!_refresh_pending || !stdscr)
+        return;
+    _refresh_pending = false;
+    // Refreshing the default colors helps keep colors synced in ttyrecs.
+    curs_set_default_colors();
+    refresh();
+}
+
 static int _get_key_from_curses()
 {
 #ifdef WATCHDOG
@@ -561,6 +579,8 @@ static int _get_key_from_curses()
     watchdog();
 #endif
 
+    _flush_refresh();
+
 #ifdef USE_TILE_WEB
     refresh();
     tiles.redraw();
@@ -930,14 +950,34 @@ void cprintf(const char *format, ...)
     vsnprintf(buffer, sizeof(buffer), format, argp);
     va_end(argp);
 
-    char32_t c;
-    char *bp = buffer;
-    while (int s = utf8towc(&c, bp))
+    // Decode the whole string in one pass rather than once per character.
+    static vector<ucs_glyph> glyphs;
+    utf8_to_glyphs(buffer, glyphs);
+
+    if (_headless_mode)
     {
-        bp += s;
-        // headless check handled in putwch
-        putwch(c);
+        // putwch simulates cursor movement and wrapping.
+        for (const ucs_glyph &g : glyphs)
+            putwch(g.code);
+        return;
     }
+
+    // Hand curses the string as one run instead of a call per character.
+    static vector<wchar_t> run;
+    run.clear();
+    for (const ucs_glyph &g : glyphs)
+        run.push_back(g.code ? (wchar_t)g.code : L' ');
+    if (!run.empty())
+        addnwstr(&run[0], run.size());
+
+#ifdef USE_TILE_WEB
+    static vector<char32_t> wbuf;
+    wbuf.clear();
+    for (const ucs_glyph &g : glyphs)
+        wbuf.push_back(g.code);
+    wbuf.push_back(0);
+    tiles.put_ucs_string(&wbuf[0]);
+#endif
 }
 
 void putwch(char32_t chr)
@@ -978,15 +1018,62 @@ void puttext(int x1, int y1, const crawl_view_buffer &vbuf)
 {
     const screen_cell_t *cell = vbuf;
     const coord_def size = vbuf.size();
+
+    if (_headless_mode)
+    {
+        // putwch simulates cursor movement and wrapping, so keep the
+        // cell-by-cell path here.
+        for (int y = 0; y < size.y; ++y)
+        {
+            cgotoxy(x1, y1 + y);
+            for (int x = 0; x < size.x; ++x)
+            {
+                put_colour_ch(cell->colour, cell->glyph);
+                cell++;
+            }
+        }
+        return;
+    }
+
+    // Emit each row as spans of same-coloured cells: one attribute change
+    // and one addnwstr per span, rather than a curses call pair per cell.
+    // Map rows are dominated by long single-colour stretches (rock, floor,
+    // unseen), so this collapses most of a frame into a few dozen calls.
+    static vector<wchar_t> run;
+#ifdef USE_TILE_WEB
+    static vector<char32_t> wrun;
+#endif
     for (int y = 0; y < size.y; ++y)
     {
         cgotoxy(x1, y1 + y);
-        for (int x = 0; x < size.x; ++x)
+        int x = 0;
+        while (x < size.x)
         {
-            // headless check handled in putwch, which this calls
-            put_colour_ch(cell->colour, cell->glyph);
-            cell++;
+            const unsigned short colour = cell[x].colour;
+            run.clear();
+#ifdef USE_TILE_WEB
+            wrun.clear();
+#endif
+            do
+            {
+                run.push_back(cell[x].glyph ? (wchar_t)cell[x].glyph : L' ');
+#ifdef USE_TILE_WEB
+                // 0 would terminate the string put_ucs_string sees; pad
+                // with the same space the curses side prints.
+                wrun.push_back(cell[x].glyph ? cell[x].glyph : U' ');
+#endif
+                x++;
+            }
+            while (x < size.x && cell[x].colour == colour);
+
+            textcolour(colour);
+            addnwstr(&run[0], run.size());
+#ifdef USE_TILE_WEB
+            wrun.push_back(0);
+            tiles.put_ucs_string(&wrun[0]);
+#endif
         }
+        cell += size.x;
     }
 }
 
@@ -1000,9 +1087,11 @@ void update_screen()
     // In objstat, headless, and similar modes, there might not be a screen to update.
     if (stdscr)
     {
-        // Refreshing the default colors helps keep colors synced in ttyrecs.
-        curs_set_default_colors();
-        refresh();
+        // Deferred: the actual refresh() happens just before the next
+        // input wait (or delay()). Reads go through get_wch, which
+        // flushes modified windows itself, so even polling loops that
+        // never call update_screen still present their output.
+        _refresh_pending = true;
     }
 
 #ifdef USE_TILE_WEB
@@ -1836,14 +1925,19 @@ void delay(unsigned int time)
         return;
 
 #ifdef USE_TILE_WEB
-    tiles.redraw();
-    if (time)
+    // Animation frames all pass through here; frames the throttle drops
+    // are coalesced into the next one, and lagging clients are not sent
+    // a pacing delay for frames they never received.
+    if (tiles.redraw_animation_frame() && time)
     {
         tiles.send_message("{\"msg\":\"delay\",\"t\":%d}", time);
         tiles.flush_messages();
     }
 #endif
 
+    // Unconditional: animations draw straight to curses without going
+    // through update_screen().
+    _refresh_pending = false;
     refresh();
     if (time)
         usleep(time * 1000);
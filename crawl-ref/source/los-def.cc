@@ -54,6 +54,11 @@ void los_def::update()
     losight(show, center, *opc, bds);
 }
 
+void los_def::update_cell(const coord_def& p)
+{
+    losight_cell_update(show, center, p, *opc, bds);
+}
+
 void los_def::set_center(const coord_def& c)
 {
     center = c;
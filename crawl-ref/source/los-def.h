@@ -25,6 +25,9 @@ public:
     circle_def get_bounds() const;
 
     void update();
+    // Recompute after a change to a single cell, re-resolving only the
+    // affected quadrant(s). Requires a previous full update().
+    void update_cell(const coord_def& p);
     bool in_bounds(const coord_def& p) const;
     bool see_cell(const coord_def& p) const;
 };
@@ -51,9 +51,14 @@
 #include "coord.h"
 #include "coordit.h"
 #include "env.h"
+#include "files.h"
 #include "losglobal.h"
 #include "mon-act.h"
 #include "mpr.h"
+#include "state.h"
+#include "stringutil.h"
+#include "syscalls.h"
+#include "tags.h"
 
 // These determine what rays are cast in the precomputation,
 // and affect start-up time significantly.
@@ -435,6 +440,225 @@ static void _create_blockrays()
           n_cellrays, (unsigned int)fullrays.size(), n_min_rays);
 }
 
+// On-disk cache of the ray precomputation. The tables depend only on
+// the geometry constants above, so they can be computed once per save
+// directory and reloaded on subsequent process starts, which matters
+// for servers that launch one process per player session.
+// Bump this whenever the serialised format or the ray generation
+// changes in a way the geometry constants don't capture.
+#define RAY_CACHE_VERSION 1
+
+// Word size and byte order tag, as used by the des cache in maps.cc.
+#ifndef BYTE_ORDER
+# error BYTE_ORDER is not defined
+#endif
+#if BYTE_ORDER == LITTLE_ENDIAN
+# define WORD_LEN (int8_t)sizeof(long)
+#else
+# define WORD_LEN -(int8_t)sizeof(long)
+#endif
+
+static string _ray_cache_path()
+{
+    return catpath(savedir_versioned_path(),
+                   make_stringf("losrays-%d-%d-%d-%d.cache",
+                                RAY_CACHE_VERSION, LOS_MAX_RANGE,
+                                LOS_MAX_ANGLE, LOS_INTERCEPT_MULT));
+}
+
+// doubles are marshalled through their 64-bit pattern, analogously to
+// marshallFloat.
+static void _marshall_double(writer &outf, double data)
+{
+    COMPILE_CHECK(sizeof(double) == sizeof(int64_t));
+    int64_t intform;
+    memcpy(&intform, &data, sizeof(double));
+    marshallSigned(outf, intform);
+}
+
+static double _unmarshall_double(reader &inf)
+{
+    int64_t intform = unmarshallSigned(inf);
+    double data;
+    memcpy(&data, &intform, sizeof(double));
+    return data;
+}
+
+static void _marshall_bits(writer &outf, const bit_vector &bits)
+{
+    for (int w = 0; w < bits.num_words(); ++w)
+        marshallUnsigned(outf, bits.get_word(w));
+}
+
+static void _unmarshall_bits(reader &inf, bit_vector &bits)
+{
+    for (int w = 0; w < bits.num_words(); ++w)
+        bits.set_word(w, unmarshallUnsigned(inf));
+}
+
+static void _save_ray_cache()
+{
+    if (!crawl_state.use_des_cache)
+        return;
+
+    const string cachefile = _ray_cache_path();
+    const string tmpfile = cachefile + ".tmp";
+    FILE *fp = fopen_u(tmpfile.c_str(), "wb");
+    if (!fp)
+        return;
+
+    writer outf(tmpfile, fp);
+    write_save_version(outf, save_version::current());
+    marshallByte(outf, WORD_LEN);
+
+    marshallInt(outf, fullrays.size());
+    for (const los_ray &ray : fullrays)
+    {
+        _marshall_double(outf, ray.r.start.x);
+        _marshall_double(outf, ray.r.start.y);
+        _marshall_double(outf, ray.r.dir.x);
+        _marshall_double(outf, ray.r.dir.y);
+        marshallInt(outf, ray.start);
+        marshallInt(outf, ray.length);
+    }
+
+    marshallInt(outf, ray_coords.size());
+    for (const coord_def &c : ray_coords)
+        marshallCoord(outf, c);
+
+    marshallInt(outf, cellray_ends.size());
+    for (const coord_def &c : cellray_ends)
+        marshallCoord(outf, c);
+
+    for (quadrant_iterator qi; qi; ++qi)
+        _marshall_bits(outf, *blockrays(*qi));
+
+    for (quadrant_iterator qi; qi; ++qi)
+    {
+        const vector<cellray> &min = min_cellrays(*qi);
+        marshallInt(outf, min.size());
+        for (const cellray &c : min)
+        {
+            // Identify the fullray by its offset into ray_coords.
+            int rayidx = -1;
+            for (unsigned int i = 0; i < fullrays.size(); ++i)
+                if (fullrays[i].start == c.ray.start)
+                {
+                    rayidx = i;
+                    break;
+                }
+            ASSERT(rayidx >= 0);
+            marshallInt(outf, rayidx);
+            marshallInt(outf, c.end);
+            marshallInt(outf, c.imbalance);
+            marshallBoolean(outf, c.first_diag);
+        }
+    }
+
+    fclose(fp);
+    if (rename_u(tmpfile.c_str(), cachefile.c_str()) != 0)
+        unlink_u(tmpfile.c_str());
+}
+
+// Try to restore the precomputed tables from the cache file. Returns
+// false (leaving the tables empty) if the file is missing, stale or
+// truncated, in which case the caller recomputes from scratch.
+static bool _load_ray_cache()
+{
+    if (!crawl_state.use_des_cache)
+        return false;
+
+    const string cachefile = _ray_cache_path();
+    FILE *fp = fopen_u(cachefile.c_str(), "rb");
+    if (!fp)
+        return false;
+
+    try
+    {
+        reader inf(fp, TAG_MINOR_VERSION);
+        const auto version = get_save_version(inf);
+        if (version.major != TAG_MAJOR_VERSION
+            || version.minor > TAG_MINOR_VERSION
+            || unmarshallByte(inf) != WORD_LEN)
+        {
+            fclose(fp);
+            return false;
+        }
+
+        const int n_fullrays = unmarshallInt(inf);
+        for (int i = 0; i < n_fullrays; ++i)
+        {
+            const double sx = _unmarshall_double(inf);
+            const double sy = _unmarshall_double(inf);
+            const double dx = _unmarshall_double(inf);
+            const double dy = _unmarshall_double(inf);
+            los_ray ray = los_ray(geom::ray(sx, sy, dx, dy));
+            ray.start = unmarshallInt(inf);
+            ray.length = unmarshallInt(inf);
+            fullrays.push_back(ray);
+        }
+
+        const int n_cellrays = unmarshallInt(inf);
+        ray_coords.reserve(n_cellrays);
+        for (int i = 0; i < n_cellrays; ++i)
+            ray_coords.push_back(unmarshallCoord(inf));
+
+        const int n_min_rays = unmarshallInt(inf);
+        cellray_ends.reserve(n_min_rays);
+        for (int i = 0; i < n_min_rays; ++i)
+            cellray_ends.push_back(unmarshallCoord(inf));
+
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            blockrays(*qi) = new bit_vector(n_min_rays);
+            _unmarshall_bits(inf, *blockrays(*qi));
+        }
+
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            const int n_min = unmarshallInt(inf);
+            vector<cellray> &min = min_cellrays(*qi);
+            min.reserve(n_min);
+            for (int i = 0; i < n_min; ++i)
+            {
+                const int rayidx = unmarshallInt(inf);
+                const unsigned int end = unmarshallInt(inf);
+                if (rayidx < 0 || rayidx >= (int)fullrays.size())
+                    throw short_read_exception();
+                cellray c(fullrays[rayidx], end);
+                c.imbalance = unmarshallInt(inf);
+                c.first_diag = unmarshallBoolean(inf);
+                min.push_back(c);
+            }
+        }
+
+        dead_rays  = new bit_vector(n_min_rays);
+        smoke_rays = new bit_vector(n_min_rays);
+    }
+    catch (const short_read_exception&)
+    {
+        // Partial state may have been installed; wipe it so the
+        // caller can recompute cleanly.
+        fullrays.clear();
+        ray_coords.clear();
+        cellray_ends.clear();
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            delete blockrays(*qi);
+            blockrays(*qi) = nullptr;
+            min_cellrays(*qi).clear();
+        }
+        delete dead_rays;
+        delete smoke_rays;
+        dead_rays = smoke_rays = nullptr;
+        fclose(fp);
+        return false;
+    }
+
+    fclose(fp);
+    return true;
+}
+
 static int _gcd(int x, int y)
 {
     int tmp;
@@ -464,6 +688,10 @@ static void raycast()
     // We have a considerable amount of overkill.
     done_raycast = true;
 
+    // Reuse tables computed by an earlier process if possible.
+    if (_load_ray_cache())
+        return;
+
     // register perpendiculars FIRST, to make them top choice
     // when selecting beams
     _register_ray(geom::ray(0.5, 0.5, 0.0, 1.0));
@@ -504,6 +732,7 @@ static void raycast()
 
     // Now create the appropriate blockrays array
     _create_blockrays();
+    _save_ray_cache();
 }
 
 static int _imbalance(ray_def ray, const coord_def& target)
@@ -732,6 +961,22 @@ bool cell_see_cell_nocache(const coord_def& p1, const coord_def& p2)
 // Smoke will now only block LOS after two cells of smoke. This is
 // done by updating with a second array.
 
+// Find the index of the lowest set bit in a nonzero word.
+static inline int _first_set_bit(unsigned long x)
+{
+#ifdef TARGET_COMPILER_VC
+    unsigned long index;
+#ifdef _WIN64
+    _BitScanForward64(&index, x);
+#else
+    _BitScanForward(&index, x);
+#endif
+    return index;
+#else
+    return __builtin_ctzl(x);
+#endif
+}
+
 static void _losight_quadrant(los_grid& sh, const los_param& dat, int sx, int sy)
 {
     const unsigned int num_cellrays = cellray_ends.size();
@@ -762,12 +1007,18 @@ static void _losight_quadrant(los_grid& sh, const los_param& dat, int sx, int sy
     }
 
     // Ray calculation done. Now work out which cells in this
-    // quadrant are visible.
-    for (unsigned int rayidx = 0; rayidx < num_cellrays; ++rayidx)
+    // quadrant are visible. Scan the dead-ray bits a word at a time
+    // so that fully blocked words are skipped with a single compare.
+    const int nwords = dead_rays->num_words();
+    for (int w = 0; w < nwords; ++w)
     {
-        // make the cells seen by this ray at this point visible
-        if (!dead_rays->get(rayidx))
+        unsigned long live = ~dead_rays->get_word(w);
+        while (live)
         {
+            const unsigned int rayidx = w * LONGSIZE + _first_set_bit(live);
+            live &= live - 1;
+            if (rayidx >= num_cellrays)
+                break;
             // This ray is alive, thus the end cell is visible.
             const coord_def p = coord_def(sx * cellray_ends[rayidx].x,
                                           sy * cellray_ends[rayidx].y);
@@ -820,6 +1071,49 @@ void losight(los_grid& sh, const coord_def& center,
     sh(o) = true;
 }
 
+// Update an existing LOS grid after a change to a single cell, by
+// clearing and re-resolving only the quadrant(s) containing that cell.
+// The other quadrants' results cannot be affected: a quadrant sweep
+// only reads opacity of cells within its own quadrant. Cells on the
+// axes are computed identically by the adjacent quadrants (only the
+// straight axis cellray reaches them), so recomputing one side is
+// enough.
+void losight_cell_update(los_grid& sh, const coord_def& center,
+                         const coord_def& changed,
+                         const opacity_func& opc, const circle_def& bounds)
+{
+    const coord_def rel = changed - center;
+    if (rel.rdist() > LOS_RADIUS)
+        return;
+
+    // Do precomputations if necessary.
+    raycast();
+
+    const los_param& dat = los_param_funcs(center, opc, bounds);
+
+    const int quadrant_x[4] = {  1, -1, -1,  1 };
+    const int quadrant_y[4] = {  1,  1, -1, -1 };
+    for (int q = 0; q < 4; ++q)
+    {
+        const int sx = quadrant_x[q];
+        const int sy = quadrant_y[q];
+        if (rel.x * sx < 0 || rel.y * sy < 0)
+            continue; // changed cell is not in this quadrant
+
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            const coord_def p = coord_def(sx*(qi->x), sy*(qi->y));
+            if (dat.los_bounds(p))
+                sh(p) = false;
+        }
+        _losight_quadrant(sh, dat, sx, sy);
+    }
+
+    // Center is always visible.
+    const coord_def o = coord_def(0,0);
+    sh(o) = true;
+}
+
 opacity_type mons_opacity(monster_type mc, los_type how)
 {
     // no regard for LOS_ARENA
@@ -40,6 +40,10 @@ void clear_rays_on_exit();
 void losight(los_grid& sh, const coord_def& center,
              const opacity_func &opc = opc_default,
              const circle_def &bds = BDS_DEFAULT);
+void losight_cell_update(los_grid& sh, const coord_def& center,
+                         const coord_def& changed,
+                         const opacity_func &opc = opc_default,
+                         const circle_def &bds = BDS_DEFAULT);
 
 void los_actor_moved(const actor* act, const coord_def& oldpos);
 void los_monster_died(const monster* mon);
@@ -17,20 +17,50 @@ typedef halflos_t globallos_t[GXM][GYM];
 
 static globallos_t globallos;
 
-static losfield_t* _lookup_globallos(const coord_def& p, const coord_def& q)
+// Validity is tracked with generation stamps instead of eagerly
+// clearing cached entries: a cell's half-los block is only current if
+// its stamp matches the global generation. Invalidation then just
+// writes stamps (or, for a full invalidation, bumps the generation),
+// and stale blocks are wiped lazily on next access.
+typedef uint32_t losgen_t;
+static losgen_t globallos_gen[GXM][GYM];
+static losgen_t current_gen = 1;
+
+// The caller must have checked that p and q are in bounds and within
+// LOS_RADIUS of each other.
+static losfield_t* _lookup_globallos_unchecked(const coord_def& p,
+                                               const coord_def& q)
 {
     COMPILE_CHECK(LOS_KNOWN * 2 <= sizeof(losfield_t) * 8);
 
-    if (!map_bounds(p) || !map_bounds(q))
-        return nullptr;
     coord_def diff = q - p;
-    if (diff.rdist() > LOS_RADIUS)
-        return nullptr;
     // p < q iff p.x < q.x || p.x == q.x && p.y < q.y
+    // Each pair is stored at its lexicographically smaller endpoint.
+    coord_def store;
     if (diff < coord_def(0, 0))
-        return &globallos[q.x][q.y][-diff.x + o_half_x][-diff.y + o_half_y];
+    {
+        store = q;
+        diff = -diff;
+    }
     else
-        return &globallos[p.x][p.y][ diff.x + o_half_x][ diff.y + o_half_y];
+        store = p;
+
+    losgen_t &gen = globallos_gen[store.x][store.y];
+    if (gen != current_gen)
+    {
+        memset(globallos[store.x][store.y], 0, sizeof(halflos_t));
+        gen = current_gen;
+    }
+    return &globallos[store.x][store.y][diff.x + o_half_x][diff.y + o_half_y];
+}
+
+static losfield_t* _lookup_globallos(const coord_def& p, const coord_def& q)
+{
+    if (!map_bounds(p) || !map_bounds(q))
+        return nullptr;
+    if ((q - p).rdist() > LOS_RADIUS)
+        return nullptr;
+    return _lookup_globallos_unchecked(p, q);
 }
 
 static void _save_los(los_def* los, los_type l)
@@ -67,13 +97,18 @@ void invalidate_los_around(const coord_def& p)
     int y2 = min(p.y + LOS_MAX_RANGE, GYM - 1);
     for (int y = y1; y <= y2; y++)
         for (int x = x1; x <= x2; x++)
-            memset(globallos[x][y], 0, sizeof(halflos_t));
+            globallos_gen[x][y] = 0;
 }
 
 void invalidate_los()
 {
-    for (rectangle_iterator ri(0); ri; ++ri)
-        memset(globallos[ri->x][ri->y], 0, sizeof(halflos_t));
+    if (++current_gen == 0)
+    {
+        // Generation counter wrapped; old stamps could now collide
+        // with it, so reset them all and restart from 1.
+        memset(globallos_gen, 0, sizeof(globallos_gen));
+        current_gen = 1;
+    }
 }
 
 static void _update_globallos_at(const coord_def& p, los_type l)
@@ -129,3 +164,21 @@ bool cell_see_cell(const coord_def& p, const coord_def& q, los_type l)
     ASSERT(*flags & (l << LOS_KNOWN));
     return *flags & l;
 }
+
+// As cell_see_cell(), for area loops probing cells generated from a
+// radius offset table: the caller guarantees both cells are in bounds
+// and within LOS_RADIUS of each other, so the per-probe validation can
+// be skipped and the check is a straight cached bit test.
+bool cell_see_cell_near(const coord_def& p, const coord_def& q, los_type l)
+{
+    if (l == LOS_NONE)
+        return true;
+
+    losfield_t* flags = _lookup_globallos_unchecked(p, q);
+
+    if (!(*flags & (l << LOS_KNOWN)))
+        _update_globallos_at(p, l);
+
+    ASSERT(*flags & (l << LOS_KNOWN));
+    return *flags & l;
+}
@@ -6,3 +6,6 @@ void invalidate_los_around(const coord_def& p);
 void invalidate_los();
 
 bool cell_see_cell(const coord_def& p, const coord_def& q, los_type l);
+// Leaner variant for cells known to be in bounds and within LOS_RADIUS
+// of each other, e.g. cells walked from a radius offset table.
+bool cell_see_cell_near(const coord_def& p, const coord_def& q, los_type l);
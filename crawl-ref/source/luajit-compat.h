@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @brief Lua 5.4 API shims for building against LuaJIT.
+ *
+ * LuaJIT implements the Lua 5.1 C API plus a subset of 5.2's (notably
+ * luaL_setfuncs). The rest of the codebase targets stock Lua 5.4; this
+ * header papers over the remaining divergences so the bindings compile
+ * unchanged under USE_LUAJIT. Included from clua.h, right after the Lua
+ * headers themselves — don't include it directly.
+**/
+
+#pragma once
+
+#ifdef USE_LUAJIT
+
+// 5.1 spells this lua_objlen; identical semantics for the strings and
+// tables we call it on.
+#define lua_rawlen lua_objlen
+
+// From 5.2 on, lua_getglobal returns the type of the pushed value.
+// (The 5.1 header defines lua_getglobal as a macro over lua_getfield,
+// which is what we expand to here.)
+#undef lua_getglobal
+static inline int crawl_lua_getglobal(lua_State *ls, const char *name)
+{
+    lua_getfield(ls, LUA_GLOBALSINDEX, name);
+    return lua_type(ls, -1);
+}
+#define lua_getglobal crawl_lua_getglobal
+
+// 5.3 added a strip argument to lua_dump. LuaJIT has no equivalent of
+// stripping here; the only cost is slightly larger des cache bytecode.
+static inline int crawl_lua_dump(lua_State *ls, lua_Writer w, void *data,
+                                 int /*strip*/)
+{
+    return lua_dump(ls, w, data);
+}
+#define lua_dump crawl_lua_dump
+
+// In 5.1 the coroutine library is part of the base library; "opening" it
+// again just has to produce the table luaopen_base already registered.
+static inline int crawl_luaopen_coroutine(lua_State *ls)
+{
+    lua_getfield(ls, LUA_GLOBALSINDEX, LUA_COLIBNAME);
+    return 1;
+}
+#define luaopen_coroutine crawl_luaopen_coroutine
+
+// 5.2's luaL_requiref: call the opener, record the module in
+// package.loaded, and optionally set the global.
+static inline void crawl_luaL_requiref(lua_State *ls, const char *modname,
+                                       lua_CFunction openf, int glb)
+{
+    lua_pushcfunction(ls, openf);
+    lua_pushstring(ls, modname);
+    lua_call(ls, 1, 1);
+    lua_getfield(ls, LUA_REGISTRYINDEX, "_LOADED");
+    lua_pushvalue(ls, -2);
+    lua_setfield(ls, -2, modname);
+    lua_pop(ls, 1);
+    if (glb)
+    {
+        lua_pushvalue(ls, -1);
+        lua_setfield(ls, LUA_GLOBALSINDEX, modname);
+    }
+}
+#define luaL_requiref crawl_luaL_requiref
+
+#endif
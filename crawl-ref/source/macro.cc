@@ -115,6 +115,35 @@ typedef map<int, int> cmd_to_key_map;
 static key_to_cmd_map _keys_to_cmds[KMC_CONTEXT_COUNT];
 static cmd_to_key_map _cmds_to_keys[KMC_CONTEXT_COUNT];
 
+// Flat dispatch table mirroring _keys_to_cmds over the common key range,
+// so resolving a keypress is two array indexes rather than a map lookup.
+// Keys outside the range (wide unicode) fall back to the map. Rebuilt
+// lazily after any binding change.
+static const int FLAT_KEY_MIN = -512;
+static const int FLAT_KEY_MAX = 512;
+static command_type _flat_keys_to_cmds[KMC_CONTEXT_COUNT]
+                                      [FLAT_KEY_MAX - FLAT_KEY_MIN];
+static bool _flat_keys_valid = false;
+
+static void _rebuild_flat_key_table()
+{
+    for (int c = 0; c < KMC_CONTEXT_COUNT; ++c)
+    {
+        for (int i = 0; i < FLAT_KEY_MAX - FLAT_KEY_MIN; ++i)
+            _flat_keys_to_cmds[c][i] = CMD_NO_CMD;
+
+        for (const auto &bind : _keys_to_cmds[c])
+        {
+            if (bind.first >= FLAT_KEY_MIN && bind.first < FLAT_KEY_MAX)
+            {
+                _flat_keys_to_cmds[c][bind.first - FLAT_KEY_MIN] =
+                    static_cast<command_type>(bind.second);
+            }
+        }
+    }
+    _flat_keys_valid = true;
+}
+
 static inline int userfunc_index(int key)
 {
     int index = (key <= USERFUNCBASE ? USERFUNCBASE - key : -1);
@@ -599,6 +628,17 @@ void macro_buf_add_cmd(command_type cmd, bool reverse)
 static void macro_buf_add_long(keyseq actions,
                                macromap &keymap = Keymaps[KMC_DEFAULT])
 {
+    if (keymap.empty())
+    {
+        macro_buf_add(actions, false, false);
+        return;
+    }
+
+    // Candidate matches can be no longer than the longest mapping.
+    size_t max_len = 0;
+    for (const auto &entry : keymap)
+        max_len = max(max_len, entry.first.size());
+
     keyseq tmp;
 
     // debug << "Adding: " << vtostr(actions) << endl;
@@ -612,7 +652,8 @@ static void macro_buf_add_long(keyseq actions,
 
     while (!actions.empty())
     {
-        tmp = actions;
+        tmp.assign(actions.begin(),
+                   actions.begin() + min(actions.size(), max_len));
 
         while (!tmp.empty())
         {
@@ -694,7 +735,17 @@ static void macro_buf_apply_command_macro()
     if (macro_keys_left > 0 || expanded_keys_left > 0)
         return;
 
-    keyseq tmp = Buffer;
+    if (Macros.empty())
+        return;
+
+    // No trigger longer than the longest defined macro can match, so
+    // don't copy or compare more of the buffer than that.
+    size_t max_len = 0;
+    for (const auto &entry : Macros)
+        max_len = max(max_len, entry.first.size());
+
+    keyseq tmp(Buffer.begin(),
+               Buffer.begin() + min(Buffer.size(), max_len));
 
     // find the longest match from the start of the buffer and replace it
     while (!tmp.empty())
@@ -2152,6 +2203,8 @@ void init_keybindings()
     }
 
     ASSERT(i >= 130);
+
+    _flat_keys_valid = false;
 }
 
 command_type name_to_command(string name)
@@ -2194,8 +2247,17 @@ command_type key_to_command(int key, KeymapContext context)
         return cmd;
     }
 
-    const auto cmd = static_cast<command_type>(lookup(_keys_to_cmds[context],
-                                                      key, CMD_NO_CMD));
+    if (!_flat_keys_valid)
+        _rebuild_flat_key_table();
+
+    command_type cmd;
+    if (key >= FLAT_KEY_MIN && key < FLAT_KEY_MAX)
+        cmd = _flat_keys_to_cmds[context][key - FLAT_KEY_MIN];
+    else
+    {
+        cmd = static_cast<command_type>(lookup(_keys_to_cmds[context],
+                                               key, CMD_NO_CMD));
+    }
 
     ASSERT(cmd == CMD_NO_CMD || context_for_command(cmd) == context);
 
@@ -2331,6 +2393,7 @@ void bind_command_to_key(command_type cmd, int key)
 
     key_map[key] = cmd;
     cmd_map[cmd] = key;
+    _flat_keys_valid = false;
 }
 
 string command_to_string(command_type cmd, bool tutorial)
@@ -128,6 +128,7 @@
 #include "stairs.h"
 #include "startup.h"
 #include "stash.h"
+#include "status.h"
 #include "state.h"
 #include "stepdown.h"
 #include "stringutil.h"
@@ -155,6 +156,7 @@
 #include "wiz-you.h" // FREEZE_TIME_KEY
 #include "wizard.h" // handle_wizard_command() and enter_explore_mode()
 #include "xom.h" // XOM_CLOUD_TRAIL_TYPE_KEY
+#include "zone-profile.h"
 #include "zot.h"
 
 // ----------------------------------------------------------------------
@@ -179,17 +181,6 @@ void world_reacts();
 
 static key_recorder repeat_again_rec;
 
-// Clockwise, around the compass from north (same order as run_dir_type)
-const struct coord_def Compass[9] =
-{
-    // kuln
-    {0, -1}, {1, -1}, {1, 0}, {1, 1},
-    // jbhy
-    {0, 1}, {-1, 1}, {-1, 0}, {-1, -1},
-    // .
-    {0, 0}
-};
-
 // Functions in main module
 static void _launch_game_loop();
 NORETURN static void _launch_game();
@@ -372,7 +363,8 @@ static void _reset_game()
     clear_level_target();
     overview_clear();
     clear_message_window();
-    note_list.clear();
+    clear_notes();
+    clear_item_name_cache();
     dlua_errors.clear();
     msg::deinitialise_mpr_streams();
     quiver::reset_state();
@@ -591,6 +583,8 @@ static void _show_commandline_options_help()
     puts("      Defaults to entire dungeon; same level syntax as -mapstat.");
     puts("  -iters <num>        For -mapstat and -objstat, set the number of "
          "iterations");
+    puts("  -mapstat-jobs <num> For -mapstat, split iterations over this many "
+         "worker processes (UNIX only)");
     puts("  -force-map <map>    For -mapstat and -objstat, always choose the "
          "      given map on every level.");
 #endif
@@ -598,6 +592,7 @@ static void _show_commandline_options_help()
     puts("Miscellaneous options:");
     puts("  -builddb         don't start the game; rebuild the .des cache and exit");
     puts("  -reset-cache     force a full rebuild of the .des cache");
+    puts("  -startup-report  print per-phase startup timings (also to stderr)");
     puts("  -dump-maps       write map Lua to stderr when parsing .des files");
 #ifndef TARGET_OS_WINDOWS
     puts("  -gdb/-no-gdb     produce gdb backtrace when a crash happens (default:on)");
@@ -2517,7 +2512,7 @@ static void _prep_input()
     you.attempted_attack = false;
     you.pos_at_turn_start = you.pos();
 
-    you.redraw_status_lights = true;
+    invalidate_status_cache();
     you.redraw_title = true;
     if (you.running == 0)
     {
@@ -2575,6 +2570,17 @@ void world_reacts()
     // All markers should be activated at this point.
     ASSERT(!env.markers.need_activate());
 
+    // Backstop for anything that wrote resist inputs without going
+    // through one of the hooked mutators.
+    invalidate_derived_stats();
+
+    // The player's action may have changed durations or statuses without
+    // an explicit invalidation; recompute once before the HUD reprints.
+    invalidate_status_cache();
+
+    perf_zone_turn_start();
+    slow_turn_watchdog_start();
+
     you.rampage_hints.clear(); // only draw on your turn
 
     fire_final_effects();
@@ -2719,6 +2725,9 @@ void world_reacts()
     // the loudest noise tracking for the next world_reacts cycle.
     you.los_noise_last_turn = you.los_noise_level;
     you.los_noise_level = 0;
+
+    perf_zone_turn_end();
+    slow_turn_watchdog_end();
 }
 
 static command_type _get_next_cmd()
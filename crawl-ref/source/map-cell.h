@@ -78,10 +78,33 @@ struct cloud_info
     killer_type killer;
 };
 
+/*
+ * The rarely-populated part of a map_cell: most known cells are bare
+ * terrain. Kept behind a single pointer in map_cell so that the passes
+ * which only read flags and features (travel safety, exploration) touch
+ * a 24-byte cell instead of dragging three cold pointers through cache.
+ */
+struct map_cell_detail
+{
+    map_cell_detail()
+    {
+    }
+
+    map_cell_detail(const map_cell_detail& o)
+        : cloud(o.cloud ? make_unique<cloud_info>(*o.cloud) : nullptr),
+          item(o.item ? make_unique<item_def>(*o.item) : nullptr),
+          mons(o.mons ? make_unique<monster_info>(*o.mons) : nullptr)
+    {
+    }
+
+    unique_ptr<cloud_info> cloud;
+    unique_ptr<item_def> item;
+    unique_ptr<monster_info> mons;
+};
+
 /*
  * A map_cell stores what the player knows about a cell.
  * These go in env.map_knowledge.
- * TODO: this can shrink to 32 bytes by shrinking enums
  */
 struct map_cell
 {
@@ -107,9 +130,8 @@ struct map_cell
         flags = o.flags;
         _feat = o._feat;
         _feat_colour = o._feat_colour;
-        _cloud = o._cloud ? make_unique<cloud_info>(*o._cloud) : nullptr;
-        _item = o._item ? make_unique<item_def>(*o._item) : nullptr;
-        _mons = o._mons ? make_unique<monster_info>(*o._mons) : nullptr;
+        _detail = o._detail ? make_unique<map_cell_detail>(*o._detail)
+                            : nullptr;
 
         return *this;
     }
@@ -124,9 +146,7 @@ struct map_cell
         flags = o.flags;
         _feat = o._feat;
         _feat_colour = o._feat_colour;
-        _cloud = std::move(o._cloud);
-        _item = std::move(o._item);
-        _mons = std::move(o._mons);
+        _detail = std::move(o._detail);
         return *this;
     }
 
@@ -178,14 +198,14 @@ struct map_cell
 
     item_def* item() const
     {
-        return _item.get();
+        return _detail ? _detail->item.get() : nullptr;
     }
 
     bool detected_item() const
     {
         const bool ret = !!(flags & MAP_DETECTED_ITEM);
         // TODO: change to an ASSERT when the underlying crash goes away
-        if (ret && !_item)
+        if (ret && !item())
         {
             //clear_item();
             return false;
@@ -196,7 +216,7 @@ struct map_cell
     void set_item(const item_def& ii, bool more_items)
     {
         clear_item();
-        _item = make_unique<item_def>(ii);
+        _get_detail().item = make_unique<item_def>(ii);
         if (more_items)
             flags |= MAP_MORE_ITEMS;
     }
@@ -206,24 +226,26 @@ struct map_cell
     void clear_item()
     {
         // TODO: internal callers are doing a bit of duplicate work here
-        _item.reset();
+        if (_detail)
+            _detail->item.reset();
         flags &= ~(MAP_DETECTED_ITEM | MAP_MORE_ITEMS);
     }
 
     monster_type monster() const
     {
-        return _mons ? _mons->type : MONS_NO_MONSTER;
+        const monster_info* mi = monsterinfo();
+        return mi ? mi->type : MONS_NO_MONSTER;
     }
 
     monster_info* monsterinfo() const
     {
-        return _mons.get();
+        return _detail ? _detail->mons.get() : nullptr;
     }
 
     void set_monster(const monster_info& mi)
     {
         clear_monster();
-        _mons = make_unique<monster_info>(mi);
+        _get_detail().mons = make_unique<monster_info>(mi);
     }
 
     bool detected_monster() const
@@ -239,8 +261,9 @@ struct map_cell
     void set_detected_monster(monster_type mons)
     {
         clear_monster();
-        _mons = make_unique<monster_info>(MONS_SENSED);
-        _mons->base_type = mons;
+        map_cell_detail& detail = _get_detail();
+        detail.mons = make_unique<monster_info>(MONS_SENSED);
+        detail.mons->base_type = mons;
         flags |= MAP_DETECTED_MONSTER;
     }
 
@@ -253,34 +276,38 @@ struct map_cell
     void clear_monster()
     {
         // TODO: internal callers are doing a bit of duplicate work here
-        _mons.reset();
+        if (_detail)
+            _detail->mons.reset();
         flags &= ~(MAP_DETECTED_MONSTER | MAP_INVISIBLE_MONSTER);
     }
 
     cloud_type cloud() const
     {
-        return _cloud ? _cloud->type : CLOUD_NONE;
+        const cloud_info* ci = cloudinfo();
+        return ci ? ci->type : CLOUD_NONE;
     }
 
     // TODO: should this be colour_t?
     unsigned cloud_colour() const
     {
-        return _cloud ? _cloud->colour : static_cast<colour_t>(0);
+        const cloud_info* ci = cloudinfo();
+        return ci ? ci->colour : static_cast<colour_t>(0);
     }
 
     cloud_info* cloudinfo() const
     {
-        return _cloud.get();
+        return _detail ? _detail->cloud.get() : nullptr;
     }
 
     void set_cloud(const cloud_info& ci)
     {
-        _cloud = make_unique<cloud_info>(ci);
+        _get_detail().cloud = make_unique<cloud_info>(ci);
     }
 
     void clear_cloud()
     {
-        _cloud.reset();
+        if (_detail)
+            _detail->cloud.reset();
     }
 
     bool update_cloud_state();
@@ -324,11 +351,24 @@ struct map_cell
 
 public:
     uint32_t flags = 0;   // Flags describing the mappedness of this square.
+
+    // Memoized glyph for this cell (maintained by get_cell_glyph): the
+    // hash of the inputs it was computed from, or 0 when nothing is
+    // memoized. Deliberately not copied or marshalled; a stale slot is
+    // just a hash mismatch and gets recomputed.
+    mutable uint32_t glyph_key = 0;
+    mutable char32_t glyph_ch = 0;
+    mutable uint16_t glyph_col = 0;
 private:
+    map_cell_detail& _get_detail()
+    {
+        if (!_detail)
+            _detail = make_unique<map_cell_detail>();
+        return *_detail;
+    }
+
     // TODO: shrink enums, shrink/re-order cloud_info and inline it
     dungeon_feature_type _feat:8;
     colour_t _feat_colour = 0;
-    unique_ptr<cloud_info> _cloud;
-    unique_ptr<item_def> _item;
-    unique_ptr<monster_info> _mons;
+    unique_ptr<map_cell_detail> _detail;
 };
@@ -24,12 +24,54 @@
 #include "viewchar.h"
 #include "viewmap.h"
 
+// While a map_bulk_update is live, per-cell redraws from the set_terrain_*
+// functions are deferred into one bounding rectangle, flushed as a single
+// consolidated pass when the outermost update ends. Magic mapping a large
+// level otherwise redraws each cell (and its whole minimap neighbourhood)
+// individually, and sends the webtiles client a matching burst of dirty
+// cells.
+static int _bulk_update_depth = 0;
+static coord_def _bulk_update_tl(-1, -1);
+static coord_def _bulk_update_br(-1, -1);
+
+static bool _defer_redraw(const coord_def &pos)
+{
+    if (!_bulk_update_depth)
+        return false;
+
+    if (_bulk_update_tl.x < 0)
+        _bulk_update_tl = _bulk_update_br = pos;
+    else
+    {
+        _bulk_update_tl.x = min(_bulk_update_tl.x, pos.x);
+        _bulk_update_tl.y = min(_bulk_update_tl.y, pos.y);
+        _bulk_update_br.x = max(_bulk_update_br.x, pos.x);
+        _bulk_update_br.y = max(_bulk_update_br.y, pos.y);
+    }
+    return true;
+}
+
+map_bulk_update::map_bulk_update()
+{
+    _bulk_update_depth++;
+}
+
+map_bulk_update::~map_bulk_update()
+{
+    if (--_bulk_update_depth || _bulk_update_tl.x < 0)
+        return;
+
+    redraw_view_region(_bulk_update_tl, _bulk_update_br);
+    _bulk_update_tl = _bulk_update_br = coord_def(-1, -1);
+}
+
 void set_terrain_mapped(const coord_def gc)
 {
     map_cell* cell = &env.map_knowledge(gc);
     cell->flags &= (~MAP_CHANGED_FLAG);
     cell->flags |= MAP_MAGIC_MAPPED_FLAG;
-    redraw_view_at(gc);
+    if (!_defer_redraw(gc))
+        redraw_view_at(gc);
 }
 
 int count_detected_mons()
@@ -110,6 +152,7 @@ static int _map_quality()
 void reautomap_level()
 {
     int passive = _map_quality();
+    map_bulk_update bulk;
 
     for (int x = X_BOUND_1; x <= X_BOUND_2; ++x)
         for (int y = Y_BOUND_1; y <= Y_BOUND_2; ++y)
@@ -121,9 +164,10 @@ void set_terrain_seen(const coord_def pos)
 {
     const dungeon_feature_type feat = env.grid(pos);
     map_cell* cell = &env.map_knowledge(pos);
+    const bool first_seen = !(cell->flags & MAP_SEEN_FLAG);
 
     // First time we've seen a notable feature.
-    if (!(cell->flags & MAP_SEEN_FLAG))
+    if (first_seen)
     {
         _automap_from(pos.x, pos.y, _map_quality());
 
@@ -139,11 +183,17 @@ void set_terrain_seen(const coord_def pos)
     cell->flags &= (~MAP_CHANGED_FLAG);
     cell->flags |= MAP_SEEN_FLAG;
 
+    if (first_seen)
+        explore_frontier_seen(pos);
+
 #ifdef USE_TILE
     // This may have changed the explore horizon, so update adjacent minimap
     // squares as well.
-    for (adjacent_iterator ai(pos, false); ai; ++ai)
-        tiles.update_minimap(*ai);
+    if (!_defer_redraw(pos))
+        for (adjacent_iterator ai(pos, false); ai; ++ai)
+            tiles.update_minimap(*ai);
+#else
+    _defer_redraw(pos);
 #endif
 }
 
@@ -168,11 +218,11 @@ void clear_terrain_visibility()
 
 void map_cell::set_detected_item()
 {
-    clear_item();
+    item_def detected;
+    detected.base_type = OBJ_DETECTED;
+    detected.rnd       = 1;
+    set_item(detected, false);
     flags |= MAP_DETECTED_ITEM;
-    _item = make_unique<item_def>();
-    _item->base_type = OBJ_DETECTED;
-    _item->rnd       = 1;
 }
 
 static bool _floor_mf(map_feature mf)
@@ -279,23 +329,50 @@ map_feature get_cell_map_feature(const map_cell& cell)
     return base_feature;
 }
 
+// Positions whose map knowledge may hold a cloud, so the per-turn prune
+// in update_cloud_knowledge() needn't walk the whole grid. Kept as a
+// conservative superset: stale entries are dropped during the prune, and
+// the set is rebuilt from the grid once on each level change.
+static set<coord_def> _known_cloud_positions;
+static level_id _known_cloud_level;
+
+void remember_cloud_knowledge(const coord_def &pos)
+{
+    _known_cloud_positions.insert(pos);
+}
+
 /// Iter over all known-but-unseen clouds & remove known-gone clouds.
 void update_cloud_knowledge()
 {
-    for (int x = X_BOUND_1; x <= X_BOUND_2; ++x)
+    if (_known_cloud_level != level_id::current())
     {
-        for (int y = Y_BOUND_1; y <= Y_BOUND_2; ++y)
+        _known_cloud_positions.clear();
+        for (rectangle_iterator ri(BOUNDARY_BORDER - 1); ri; ++ri)
+            if (env.map_knowledge(*ri).cloudinfo())
+                _known_cloud_positions.insert(*ri);
+        _known_cloud_level = level_id::current();
+    }
+
+    for (auto it = _known_cloud_positions.begin();
+         it != _known_cloud_positions.end();)
+    {
+        const coord_def pos = *it;
+        map_cell &cell = env.map_knowledge(pos);
+        if (!cell.cloudinfo())
+        {
+            it = _known_cloud_positions.erase(it);
+            continue;
+        }
+        if (cell.update_cloud_state())
         {
-            if (env.map_knowledge[x][y].update_cloud_state())
-            {
 #ifdef USE_TILE
-                tile_draw_map_cell({x, y}, true);
+            tile_draw_map_cell(pos, true);
 #endif
 #ifdef USE_TILE_WEB
-                tiles.mark_for_redraw({x, y});
+            tiles.mark_for_redraw(pos);
 #endif
-            }
         }
+        ++it;
     }
 }
 
@@ -306,16 +383,18 @@ bool map_cell::update_cloud_state()
     if (visible())
         return false; // we're already up-to-date
 
+    const cloud_info* ci = cloudinfo();
+
     // player non-opaque clouds vanish instantly out of los
-    if (_cloud && _cloud->killer == KILL_YOU_MISSILE
-        && !is_opaque_cloud(_cloud->type))
+    if (ci && ci->killer == KILL_YOU_MISSILE
+        && !is_opaque_cloud(ci->type))
     {
         clear_cloud();
         return true;
     }
 
     // still winds KOs all clouds, even those out of LOS
-    if (_cloud && env.level_state & LSTATE_STILL_WINDS)
+    if (ci && env.level_state & LSTATE_STILL_WINDS)
     {
         clear_cloud();
         return true;
@@ -449,6 +528,10 @@ bool magic_mapping(int map_radius, int proportion, bool suppress_msg,
     int  num_altars        = 0;
     int  num_shops_portals = 0;
 
+    // Defer per-cell redraws; one consolidated pass happens when this
+    // goes out of scope.
+    map_bulk_update bulk;
+
     const FixedArray<uint8_t, GXM, GYM>& difficulty =
         _tile_difficulties(!deterministic);
 
@@ -533,9 +616,7 @@ bool magic_mapping(int map_radius, int proportion, bool suppress_msg,
                 set_terrain_seen(pos);
                 StashTrack.add_stash(pos);
                 show_update_at(pos);
-#ifdef USE_TILE
-                tile_draw_map_cell(pos);
-#endif
+                _defer_redraw(pos);
             }
             else
             {
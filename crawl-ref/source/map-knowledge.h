@@ -5,6 +5,17 @@
 #include "feature.h"
 #include "externs.h"
 
+// While an instance is live, the per-cell view/minimap/webtiles redraws
+// triggered by the set_terrain_* functions below are deferred and flushed
+// as one consolidated rectangle when the outermost instance goes out of
+// scope. Nestable.
+class map_bulk_update
+{
+public:
+    map_bulk_update();
+    ~map_bulk_update();
+};
+
 void set_terrain_mapped(const coord_def c);
 void set_terrain_seen(const coord_def c);
 
@@ -14,6 +25,7 @@ void clear_terrain_visibility();
 int count_detected_mons();
 
 void update_cloud_knowledge();
+void remember_cloud_knowledge(const coord_def &pos);
 
 bool magic_mapping(int map_radius, int proportion, bool suppress_msg,
                    bool force = false, bool deterministic = false,
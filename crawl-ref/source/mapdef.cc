@@ -2469,6 +2469,21 @@ void map_def::strip()
     feat_renames.clear();
 }
 
+// Compiles all of the map's Lua chunks to bytecode ahead of writing the
+// des cache, so that games loading the cache execute them without ever
+// recompiling the source. Compile errors are deliberately ignored here:
+// the chunk falls back to marshalling its source, and the error surfaces
+// as usual when the map is first considered for placement.
+void map_def::precompile_lua()
+{
+    prelude.precompile(dlua);
+    mapchunk.precompile(dlua);
+    main.precompile(dlua);
+    validate.precompile(dlua);
+    veto.precompile(dlua);
+    epilogue.precompile(dlua);
+}
+
 void map_def::load()
 {
     if (!index_only)
@@ -1072,6 +1072,9 @@ void map_markers::activate_markers_at(coord_def p)
 
 void map_markers::run_all(int time, map_marker_type type)
 {
+    if (type != MAT_ANY && typed_markers[type].empty())
+        return;
+
     for (size_t i = 0; i < dynamic_markers.size(); ++i)
     {
         if (type != MAT_ANY && dynamic_markers[i]->get_type() != type)
@@ -1093,13 +1096,21 @@ void map_markers::run_all(int time, map_marker_type type)
 
 void map_markers::add(map_marker *marker)
 {
-    markers.insert(dgn_pos_marker(marker->pos, marker));
+    link_marker(marker);
     if (marker->needs_activation())
         have_inactive_markers = true;
     if (marker->is_dynamic())
         dynamic_markers.push_back(marker);
 }
 
+// Link into the position multimap and the per-type list, without any of
+// the bookkeeping add() does; used when re-linking a moved marker.
+void map_markers::link_marker(map_marker *marker)
+{
+    markers.insert(dgn_pos_marker(marker->pos, marker));
+    link_typed(marker);
+}
+
 void map_markers::unlink_marker(const map_marker *marker)
 {
     auto els = markers.equal_range(marker->pos);
@@ -1111,6 +1122,27 @@ void map_markers::unlink_marker(const map_marker *marker)
             break;
         }
     }
+    unlink_typed(marker);
+}
+
+// The per-type lists mirror the multimap's iteration order (sorted by
+// position, insertion order among equal positions), so switching a
+// type-filtered query to them cannot reorder messages or RNG draws.
+void map_markers::link_typed(map_marker *marker)
+{
+    vector<map_marker*> &typed = typed_markers[marker->get_type()];
+    auto i = typed.begin();
+    while (i != typed.end() && !(marker->pos < (*i)->pos))
+        ++i;
+    typed.insert(i, marker);
+}
+
+void map_markers::unlink_typed(const map_marker *marker)
+{
+    vector<map_marker*> &typed = typed_markers[marker->get_type()];
+    auto i = std::find(typed.begin(), typed.end(), marker);
+    if (i != typed.end())
+        typed.erase(i);
 }
 
 void map_markers::check_empty()
@@ -1153,6 +1185,7 @@ void map_markers::remove_markers_at(const coord_def &c,
         if (type == MAT_ANY || todel->second->get_type() == type)
         {
             flag_for_deletion(todel->second);
+            unlink_typed(todel->second);
             markers.erase(todel);
         }
     }
@@ -1170,49 +1203,43 @@ map_marker *map_markers::find(const coord_def &c, map_marker_type type)
 
 map_marker *map_markers::find(map_marker_type type)
 {
-    for (const auto &entry : markers)
-        if (type == MAT_ANY || entry.second->get_type() == type)
-            return entry.second;
+    if (type != MAT_ANY)
+        return typed_markers[type].empty() ? nullptr : typed_markers[type][0];
 
-    return nullptr;
+    return markers.empty() ? nullptr : markers.begin()->second;
 }
 
 void map_markers::move(const coord_def &from, const coord_def &to)
 {
-    unwind_bool inactive(have_inactive_markers);
     auto els = markers.equal_range(from);
 
     list<map_marker*> tmarkers;
-    for (auto i = els.first; i != els.second;)
-    {
-        auto curr = i++;
-        tmarkers.push_back(curr->second);
-        markers.erase(curr);
-    }
+    for (auto i = els.first; i != els.second; ++i)
+        tmarkers.push_back(i->second);
 
     for (auto mark : tmarkers)
     {
+        unlink_marker(mark);
         mark->pos = to;
-        add(mark);
+        link_marker(mark);
     }
 }
 
 void map_markers::move_marker(map_marker *marker, const coord_def &to)
 {
-    unwind_bool inactive(have_inactive_markers);
     unlink_marker(marker);
     marker->pos = to;
-    add(marker);
+    link_marker(marker);
 }
 
 vector<map_marker*> map_markers::get_all(map_marker_type mat)
 {
+    if (mat != MAT_ANY)
+        return typed_markers[mat];
+
     vector<map_marker*> rmarkers;
     for (const auto &entry : markers)
-    {
-        if (mat == MAT_ANY || entry.second->get_type() == mat)
-            rmarkers.push_back(entry.second);
-    }
+        rmarkers.push_back(entry.second);
     return rmarkers;
 }
 
@@ -1245,6 +1272,9 @@ vector<map_marker*> map_markers::get_markers_at(const coord_def &c, map_marker_t
 vector<map_active_feature_marker*> map_markers::get_active_features(dungeon_feature_type feat, mid_t owner)
 {
     vector<map_active_feature_marker*> out;
+    if (typed_markers[MAT_ACTIVE_FEATURE].empty())
+        return out;
+
     for (map_marker* mark : dynamic_markers)
     {
         if (mark->get_type() != MAT_ACTIVE_FEATURE)
@@ -1263,6 +1293,9 @@ vector<map_active_feature_marker*> map_markers::get_active_features(dungeon_feat
 // Gets the most recently-added matching active feature marker at a given position.
 map_active_feature_marker* map_markers::get_active_feature_at(const coord_def& pos, dungeon_feature_type feat)
 {
+    if (typed_markers[MAT_ACTIVE_FEATURE].empty())
+        return nullptr;
+
     for (int i = (int)dynamic_markers.size() - 1; i >= 0; --i)
     {
         if (dynamic_markers[i]->pos != pos || dynamic_markers[i]->get_type() != MAT_ACTIVE_FEATURE)
@@ -1301,6 +1334,8 @@ void map_markers::clear()
         delete entry.second;
     markers.clear();
     dynamic_markers.clear();
+    for (auto &typed : typed_markers)
+        typed.clear();
     to_delete.clear();
     check_empty();
 }
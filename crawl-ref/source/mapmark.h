@@ -387,7 +387,10 @@ private:
     typedef pair<coord_def, map_marker *> dgn_pos_marker;
 
     void init_from(const map_markers &);
+    void link_marker(map_marker *);
     void unlink_marker(const map_marker *);
+    void link_typed(map_marker *);
+    void unlink_typed(const map_marker *);
     void flag_for_deletion(map_marker *);
     void delete_marker(map_marker *);
     void check_empty();
@@ -397,6 +400,11 @@ private:
     bool have_inactive_markers;
     vector<map_marker*> dynamic_markers;
 
+    // Per-type lists mirroring the position multimap, so type-filtered
+    // queries don't have to scan every marker on the level. Each list is
+    // kept in the multimap's iteration order.
+    vector<map_marker*> typed_markers[NUM_MAP_MARKER_TYPES];
+
     // A list of markers that were flagged for deletion since the last call of
     // run_all(),
     vector<map_marker*> to_delete;
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <unordered_map>
 #include <sys/param.h>
 #include <sys/types.h>
 #if defined(UNIX) || defined(TARGET_COMPILER_MINGW)
@@ -40,6 +41,14 @@
 #else
 # define WORD_LEN -(int8_t)sizeof(long)
 #endif
+// The des cache stores compiled bytecode, which LuaJIT and stock Lua don't
+// share, so fold the interpreter into the stamp: switching interpreters then
+// regenerates the cache instead of feeding it foreign bytecode.
+#ifdef USE_LUAJIT
+# define DES_CACHE_STAMP (int8_t)(WORD_LEN ^ 0x40)
+#else
+# define DES_CACHE_STAMP WORD_LEN
+#endif
 
 static map_section_type _write_vault(map_def &mdef,
                                      vault_placement &,
@@ -68,6 +77,15 @@ point_vector map_anchor_points;
 
 static map_vector vdefs;
 
+// Lookup indices over vdefs, rebuilt lazily after maps load (vdefs can
+// hold north of ten thousand maps, and name and tag queries used to walk
+// all of them). map_name_index maps a map's name to its vdefs position;
+// map_tag_index maps each tag to the ascending positions of the maps
+// carrying it.
+static unordered_map<string, unsigned> map_name_index;
+static map<string, vector<unsigned>> map_tag_index;
+static bool map_indices_dirty = true;
+
 // Parameter array that vault code can use.
 string_vector map_parameters;
 
@@ -464,6 +482,51 @@ static bool _map_safe_vault_place(const map_def &map,
         return false;
     }
 
+    // Precompute per-row bitmasks of columns where a square or one of its
+    // eight neighbours lies in an already placed vault: minivault
+    // placement runs this test for hundreds of candidate positions, and
+    // the bitmasks turn the nine grid probes per vault square below into
+    // a single bit test. Bit x of vault_adj[dy] corresponds to column x
+    // of the grid, for the vault row at c.y + dy.
+    const int mask_words = (GXM + 63) / 64;
+    uint64_t vault_adj[GYM][(GXM + 63) / 64];
+    if (!vault_can_overwrite_other_vaults)
+    {
+        uint64_t row[GYM + 2][(GXM + 63) / 64];
+        const int xlo = max(c.x - 1, 0);
+        const int xhi = min(c.x + size.x, GXM - 1);
+        for (int dy = 0; dy < size.y + 2; ++dy)
+        {
+            const int y = c.y - 1 + dy;
+            for (int w = 0; w < mask_words; ++w)
+                row[dy][w] = 0;
+            if (y < 0 || y >= GYM)
+                continue;
+            for (int x = xlo; x <= xhi; ++x)
+                if (env.level_map_mask(coord_def(x, y)) & MMT_VAULT)
+                    row[dy][x >> 6] |= uint64_t(1) << (x & 63);
+            // Smear each row one column left and right.
+            uint64_t raw[(GXM + 63) / 64];
+            for (int w = 0; w < mask_words; ++w)
+                raw[w] = row[dy][w];
+            for (int w = 0; w < mask_words; ++w)
+            {
+                const uint64_t left = raw[w] << 1
+                    | (w > 0 ? raw[w - 1] >> 63 : 0);
+                const uint64_t right = raw[w] >> 1
+                    | (w + 1 < mask_words ? raw[w + 1] << 63 : 0);
+                row[dy][w] |= left | right;
+            }
+        }
+        // ... and each vault row picks up its neighbour rows.
+        for (int dy = 0; dy < size.y; ++dy)
+            for (int w = 0; w < mask_words; ++w)
+            {
+                vault_adj[dy][w] = row[dy][w] | row[dy + 1][w]
+                                   | row[dy + 2][w];
+            }
+    }
+
     const vector<string> &lines = map.map.get_lines();
     for (rectangle_iterator ri(c, c + size - 1); ri; ++ri)
     {
@@ -479,13 +542,11 @@ static bool _map_safe_vault_place(const map_def &map,
 
         if (!vault_can_overwrite_other_vaults)
         {
-            // Also check adjacent squares for collisions, because being next
-            // to another vault may block off one of this vault's exits.
-            for (adjacent_iterator ai(cp); ai; ++ai)
-            {
-                if (map_bounds(*ai) && (env.level_map_mask(*ai) & MMT_VAULT))
-                    return false;
-            }
+            // A collision on an adjacent square also rejects, because
+            // being next to another vault may block off one of this
+            // vault's exits.
+            if (vault_adj[dp.y][cp.x >> 6] & uint64_t(1) << (cp.x & 63))
+                return false;
         }
         else if (env.grid(cp) != DNGN_FLOOR || env.pgrid(cp) & FPROP_NO_TELE_INTO
                                        || _is_transporter_place(cp))
@@ -737,13 +798,43 @@ static bool _map_matches_species(const map_def &map)
            + lowercase_string(species::get_abbrev(you.species)));
 }
 
-const map_def *find_map_by_name(const string &name)
+static void _rebuild_map_indices()
 {
-    for (const map_def &mapdef : vdefs)
-        if (mapdef.name == name)
-            return &mapdef;
+    map_name_index.clear();
+    map_tag_index.clear();
+    for (unsigned i = 0, size = vdefs.size(); i < size; ++i)
+    {
+        // Like the linear scan this replaces, the first map with a given
+        // name wins.
+        map_name_index.emplace(vdefs[i].name, i);
+        for (const string &tag : vdefs[i].get_tags_unsorted())
+            map_tag_index[tag].push_back(i);
+    }
+    map_indices_dirty = false;
+}
+
+static void _check_map_indices()
+{
+    if (map_indices_dirty)
+        _rebuild_map_indices();
+}
 
-    return nullptr;
+// The ascending vdefs positions of all maps carrying the given tag.
+// Narrowing a tag query to these candidates never changes its result;
+// callers still apply their full predicate to each candidate.
+static const vector<unsigned> &_maps_with_tag(const string &tag)
+{
+    static const vector<unsigned> no_maps;
+    _check_map_indices();
+    const auto it = map_tag_index.find(tag);
+    return it == map_tag_index.end() ? no_maps : it->second;
+}
+
+const map_def *find_map_by_name(const string &name)
+{
+    _check_map_indices();
+    const auto it = map_name_index.find(name);
+    return it == map_name_index.end() ? nullptr : &vdefs[it->second];
 }
 
 // Discards Lua code loaded by all maps to reduce memory use. If any stripped
@@ -771,9 +862,15 @@ mapref_vector find_maps_for_tag(const string &tag,
     mapref_vector maps;
     level_id place = level_id::current();
     unordered_set<string> tag_set = parse_tags(tag);
+    // has_all_tags() of an empty set is always false.
+    if (tag_set.empty())
+        return maps;
 
-    for (const map_def &mapdef : vdefs)
+    // Every parsed tag must match, so maps carrying the first one are the
+    // only candidates.
+    for (const unsigned i : _maps_with_tag(*tag_set.begin()))
     {
+        const map_def &mapdef = vdefs[i];
         if (mapdef.has_all_tags(tag_set.begin(), tag_set.end())
             && !mapdef.has_tag("dummy")
             && (!check_depth || _debug_ignore_depth
@@ -1003,9 +1100,23 @@ static vault_indices _eligible_maps_for_selector(const map_selector &sel)
 
     if (sel.valid())
     {
-        for (unsigned i = 0, size = vdefs.size(); i < size; ++i)
-            if (sel.accept(vdefs[i]))
-                eligible.push_back(i);
+        const unordered_set<string> tag_set = parse_tags(sel.tag);
+        if (!tag_set.empty())
+        {
+            // Tag selection demands every tag, so only maps carrying the
+            // first one can be accepted. The candidates are in vdefs
+            // order, like the full scan below, which matters: the callers'
+            // weighted rolls consume one random draw per candidate.
+            for (const unsigned i : _maps_with_tag(*tag_set.begin()))
+                if (sel.accept(vdefs[i]))
+                    eligible.push_back(i);
+        }
+        else
+        {
+            for (unsigned i = 0, size = vdefs.size(); i < size; ++i)
+                if (sel.accept(vdefs[i]))
+                    eligible.push_back(i);
+        }
     }
 
     return eligible;
@@ -1296,7 +1407,7 @@ static bool verify_file_version(const string &file, time_t mtime)
         fclose(fp);
         return major == TAG_MAJOR_VERSION
                && minor <= TAG_MINOR_VERSION
-               && word == WORD_LEN
+               && word == DES_CACHE_STAMP
                && t == mtime;
     }
     catch (const short_read_exception&)
@@ -1328,7 +1439,7 @@ static bool _load_map_index(const string& cache, const string &base,
         int8_t word = unmarshallByte(inf);
         int64_t t = unmarshallSigned(inf);
         if (major != TAG_MAJOR_VERSION || minor > TAG_MINOR_VERSION
-            || word != WORD_LEN || t != mtime)
+            || word != DES_CACHE_STAMP || t != mtime)
         {
             return false;
         }
@@ -1356,7 +1467,7 @@ static bool _load_map_index(const string& cache, const string &base,
     int8_t word = unmarshallByte(inf);
     int64_t t = unmarshallSigned(inf);
     if (major != TAG_MAJOR_VERSION || minor > TAG_MINOR_VERSION
-        || word != WORD_LEN || t != mtime)
+        || word != DES_CACHE_STAMP || t != mtime)
     {
         return false;
     }
@@ -1383,6 +1494,7 @@ static bool _load_map_index(const string& cache, const string &base,
     }
     fclose(fp);
 
+    map_indices_dirty = true;
     return true;
 }
 
@@ -1419,7 +1531,7 @@ static void _write_map_prelude(const string &filebase, time_t mtime)
     FILE *fp = fopen_u(luafile.c_str(), "wb");
     writer outf(luafile, fp);
     write_save_version(outf, save_version::current());
-    marshallByte(outf, WORD_LEN);
+    marshallByte(outf, DES_CACHE_STAMP);
     marshallSigned(outf, mtime);
     lc_global_prelude.write(outf);
     fclose(fp);
@@ -1435,7 +1547,7 @@ static void _write_map_full(const string &filebase, size_t vs, size_t ve,
 
     writer outf(cfile, fp);
     write_save_version(outf, save_version::current());
-    marshallByte(outf, WORD_LEN);
+    marshallByte(outf, DES_CACHE_STAMP);
     marshallSigned(outf, mtime);
     for (size_t i = vs; i < ve; ++i)
         vdefs[i].write_full(outf);
@@ -1452,7 +1564,7 @@ static void _write_map_index(const string &filebase, size_t vs, size_t ve,
 
     writer outf(cfile, fp);
     write_save_version(outf, save_version::current());
-    marshallByte(outf, WORD_LEN);
+    marshallByte(outf, DES_CACHE_STAMP);
     marshallSigned(outf, mtime);
     marshallShort(outf, ve > vs? ve - vs : 0);
     for (size_t i = vs; i < ve; ++i)
@@ -1475,6 +1587,11 @@ static void _write_map_cache(const string &filename, size_t vs, size_t ve,
 
     file_lock deslock(descache_base + ".lk", "wb");
 
+    // Compile the Lua down to bytecode first, so both the index (map
+    // preludes) and the full cache carry precompiled chunks.
+    for (size_t i = vs; i < ve; ++i)
+        vdefs[i].precompile_lua();
+
     _write_map_prelude(descache_base, mtime);
     _write_map_full(descache_base, vs, ve, mtime);
     _write_map_index(descache_base, vs, ve, mtime);
@@ -1553,6 +1670,7 @@ void reread_maps()
 
     // BOOM!
     vdefs.clear();
+    map_indices_dirty = true;
     map_files_read.clear();
     read_maps();
 }
@@ -1572,6 +1690,7 @@ void add_parsed_map(const map_def &md)
 
     map.fixup();
     vdefs.push_back(map);
+    map_indices_dirty = true;
 }
 
 void run_map_global_preludes()
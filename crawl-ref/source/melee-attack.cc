@@ -1641,6 +1641,18 @@ bool melee_attack::run_monster_attack_set()
                 break;
         }
 
+        // Most monsters have fewer than MAX_NUM_ATTACKS real attacks; don't
+        // pay for a full melee_attack (to-hit calculation and all) just to
+        // find out a slot is empty. Probing with base_flavour avoids any
+        // randomisation, and slot rewrites (hydra heads, vampire thrall
+        // bites, ...) happen inside mons_attack_spec() itself, so an empty
+        // answer here is final. AT_WEAP_ONLY still takes the full path.
+        if (mons_attack_spec(*mon, attack_num, true).type == AT_NONE)
+        {
+            --effective_attack_num;
+            continue;
+        }
+
         melee_attack melee_attk(attacker, defender, attack_num,
                                 effective_attack_num);
 
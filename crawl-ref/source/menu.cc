@@ -179,6 +179,15 @@ protected:
     struct MenuItemInfo {
         int x, y, row, column;
         formatted_string text;
+        // formatting memo: what `text` was parsed from, so update_item
+        // can skip the reparse when an entry is unchanged
+        string src_text;
+        int colour = -1;
+        // cached measurements, invalidated whenever `text` is rebuilt
+        int text_width = -1;
+        int wrap_width = -1;
+        int wrapped_height = -1;
+        int wrap_sx = 0;
 #ifdef USE_TILE_LOCAL
         vector<tile_def> tiles;
 #endif
@@ -200,7 +209,7 @@ protected:
     void pack_buffers();
 
     bool m_buffers_dirty = false;
-    bool m_draw_tiles;
+    bool m_draw_tiles = false;
     FontWrapper *m_font_entry;
     ShapeBuffer m_shape_buf;
     LineBuffer m_line_buf, m_div_line_buf;
@@ -230,6 +239,7 @@ void UIMenu::update_items()
 
 #ifdef USE_TILE_LOCAL
     // update m_draw_tiles
+    const bool old_draw_tiles = m_draw_tiles;
     m_draw_tiles = false;
     for (const auto& entry : item_info)
         if (!entry.heading && !entry.tiles.empty())
@@ -237,6 +247,10 @@ void UIMenu::update_items()
             m_draw_tiles = Options.tile_menu_icons;
             break;
         }
+    // the text indent baked into the cached wrap measurements just changed
+    if (old_draw_tiles != m_draw_tiles)
+        for (auto& entry : item_info)
+            entry.wrap_width = -1;
 #endif
 }
 
@@ -353,9 +367,19 @@ void UIMenu::update_item(int index)
     item_info.resize(m_menu->items.size());
 
     auto& entry = item_info[index];
+    // Parsing and (in do_layout) measuring entries is the expensive part
+    // of a menu update, so skip it when nothing changed: wholesale
+    // update_items passes hit this for every entry but the ones that
+    // actually differ.
+    if (entry.colour == colour && entry.src_text == text)
+        return;
+    entry.src_text = std::move(text);
+    entry.colour = colour;
     entry.text.clear();
     entry.text.textcolour(colour);
-    entry.text += formatted_string::parse_string(text);
+    entry.text += formatted_string::parse_string(entry.src_text);
+    entry.text_width = -1;
+    entry.wrap_width = -1;
     entry.heading = me->level == MEL_TITLE || me->level == MEL_SUBTITLE;
 #ifdef USE_TILE_LOCAL
     entry.tiles.clear();
@@ -418,7 +442,9 @@ void UIMenu::do_layout(int mw, int num_columns, bool just_checking)
             row_height = 0;
         }
 
-        const int text_width = m_font_entry->string_width(entry.text);
+        if (entry.text_width < 0)
+            entry.text_width = m_font_entry->string_width(entry.text);
+        const int text_width = entry.text_width;
 
         if (!just_checking)
             entry.y = height;
@@ -436,8 +462,13 @@ void UIMenu::do_layout(int mw, int num_columns, bool just_checking)
             // wrap titles to two lines if they don't fit
             if (m_draw_tiles && text_width > mw)
             {
-                formatted_string split = m_font_entry->split(entry.text, mw, UINT_MAX);
-                row_height = max(row_height, (int)m_font_entry->string_height(split));
+                if (entry.wrap_width != mw)
+                {
+                    formatted_string split = m_font_entry->split(entry.text, mw, UINT_MAX);
+                    entry.wrap_width = mw;
+                    entry.wrapped_height = m_font_entry->string_height(split);
+                }
+                row_height = max(row_height, entry.wrapped_height);
             }
             column = num_columns-1;
         }
@@ -450,16 +481,20 @@ void UIMenu::do_layout(int mw, int num_columns, bool just_checking)
             int item_height = max(text_height, !entry.tiles.empty() ? 32 : 0);
 
             // Split menu entries that don't fit into a single line into two lines.
-            if (!m_menu->is_set(MF_NO_WRAP_ROWS))
+            // Splitting and measuring is costly, so the result is cached per
+            // entry until the text or the available width changes.
+            if (!m_menu->is_set(MF_NO_WRAP_ROWS)
+                && text_width > max_column_width-entry.x-pad_right)
             {
-                if ((text_width > max_column_width-entry.x-pad_right))
+                if (entry.wrap_width != max_column_width)
                 {
                     formatted_string text;
+                    int wrap_sx = text_sx;
                     // TODO: refactor to use _get_text_preface
                     if (_has_hotkey_prefix(entry.text.tostring()))
                     {
                         formatted_string header = entry.text.chop(5);
-                        text_sx += m_font_entry->string_width(header);
+                        wrap_sx += m_font_entry->string_width(header);
                         text = entry.text;
                         // remove hotkeys. As Enne said above, this is a monstrosity.
                         for (int k = 0; k < 5; k++)
@@ -468,12 +503,15 @@ void UIMenu::do_layout(int mw, int num_columns, bool just_checking)
                     else
                         text += entry.text;
 
-                    int w = max_column_width - text_sx - pad_right;
+                    int w = max_column_width - wrap_sx - pad_right;
                     formatted_string split = m_font_entry->split(text, w, UINT_MAX);
                     int string_height = m_font_entry->string_height(split);
-                    string_height = min(string_height, text_height*2);
-                    item_height = max(item_height, string_height);
+                    entry.wrap_width = max_column_width;
+                    entry.wrapped_height = min(string_height, text_height*2);
+                    entry.wrap_sx = wrap_sx;
                 }
+                text_sx = entry.wrap_sx;
+                item_height = max(item_height, entry.wrapped_height);
             }
 
             column_width = max(column_width, text_sx + text_width + pad_right);
@@ -509,7 +547,9 @@ void UIMenu::do_layout(int mw, int num_columns, bool just_checking)
         if (column == 0)
             row++;
 
-        const int text_width = static_cast<int>(entry.text.width());
+        if (entry.text_width < 0)
+            entry.text_width = static_cast<int>(entry.text.width());
+        const int text_width = entry.text_width;
 
         entry.x = 0;
         entry.y = row;
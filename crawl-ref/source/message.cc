@@ -389,6 +389,10 @@ class message_window
     int temp_line;     // starting point of temporary messages
     int input_line;    // last line-after-input
     vector<formatted_string> lines;
+    // what each on-screen row last had written to it, so show() can skip
+    // rows that are already current; emptied whenever something else has
+    // written over our screen area
+    vector<formatted_string> shown_lines;
     prefix_type prompt; // current prefix prompt
 
     int height() const
@@ -592,8 +596,10 @@ public:
         input_line -= n;
     }
 
-    // write to screen (without refresh)
-    void show()
+    // write to screen (without refresh). Only rows that changed since the
+    // last show() are written, unless force is set (for callers repainting
+    // after a clrscr or other external write to our screen area).
+    void show(bool force = false)
     {
         // skip if there is no layout yet
         if (width() <= 0)
@@ -608,8 +614,21 @@ public:
         //  lines if this has happened.
         const int diff = max(int(lines.size()) - height(), 0);
 
+        if ((int)shown_lines.size() != height())
+        {
+            shown_lines.clear();
+            shown_lines.resize(height());
+            force = true;
+        }
+
         for (size_t i = diff; i < lines.size(); ++i)
-            out_line(lines[i], i - diff);
+        {
+            if (force || !(shown_lines[i - diff] == lines[i]))
+            {
+                out_line(lines[i], i - diff);
+                shown_lines[i - diff] = lines[i];
+            }
+        }
         place_cursor();
 #ifdef USE_TILE
         tiles.set_need_redraw();
@@ -662,6 +681,9 @@ public:
     void got_input()
     {
         input_line = next_line;
+        // the line reader echoes input into our screen area behind our
+        // back; don't trust the diff until everything is rewritten
+        shown_lines.clear();
     }
 
     void new_cmdturn(bool new_turn)
@@ -732,6 +754,10 @@ public:
 
             readkey_more(user);
         }
+
+        // the prompt was written straight to the screen; make the next
+        // show() rewrite everything over it
+        shown_lines.clear();
     }
 };
 
@@ -739,7 +765,8 @@ message_window msgwin;
 
 void display_message_window()
 {
-    msgwin.show();
+    // called when repainting the whole screen, so can't skip anything
+    msgwin.show(true);
 }
 
 void clear_message_window()
@@ -782,7 +809,10 @@ public:
 
     void add(const message_line& msg)
     {
+#ifdef USE_SOUND
+        // grab this up front, before merge() can condense msg away
         string orig_full_text = msg.full_text();
+#endif
 
         if (!(msg.channel != MSGCH_PROMPT && prev_msg.merge(msg)))
         {
@@ -0,0 +1,305 @@
+/**
+ * @file
+ * @brief dbm wrapper over a memory-mapped hash file
+**/
+
+#include "AppHdr.h"
+
+#include "mmapdb.h"
+
+#include <cstring>
+#include <fcntl.h>
+#if defined(UNIX) || defined(TARGET_COMPILER_MINGW)
+#include <unistd.h>
+#endif
+#ifdef UNIX
+#include <sys/mman.h>
+#endif
+
+#include <vector>
+
+#include "syscalls.h"
+
+#ifdef USE_MMAP_DBM
+
+using std::vector;
+
+// File layout (integers are host-endian: like the dbm files this
+// replaces, it's a local cache that is regenerated whenever stale):
+//
+//   8 bytes   magic
+//   uint32    number of hash buckets (a power of two)
+//   uint32    number of entries
+//   uint32[]  bucket table: absolute file offset of an entry, 0 if empty
+//   entries   uint32 key length, uint32 value length, key bytes, value
+//             bytes, densely packed in key order
+//
+// Lookups linearly probe the bucket table on an FNV-1a hash. The table is
+// built at no more than half load, so probe runs stay short and an empty
+// bucket always terminates a miss.
+#define MMAP_DB_MAGIC "CRAWLDB\x01"
+#define MMAP_DB_HEADER_SIZE 16
+
+static uint32_t _hash_key(const char *key, size_t len)
+{
+    uint32_t h = 0x811c9dc5;
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= (unsigned char)key[i];
+        h *= 0x01000193;
+    }
+    return h;
+}
+
+MMapDBM::MMapDBM(const string &db, bool _readonly)
+    : dbfile(db), readonly(_readonly), base(nullptr), length(0),
+      nbuckets(0), nentries(0), cursor(0), cursor_index(0), pending()
+{
+    if (dbfile.find(".db") != dbfile.length() - 3)
+        dbfile += ".db";
+}
+
+MMapDBM::~MMapDBM()
+{
+    close();
+}
+
+bool MMapDBM::open()
+{
+    if (readonly)
+        return map_file();
+    // Writes are buffered in full and laid out on close.
+    return true;
+}
+
+void MMapDBM::close()
+{
+    if (!readonly && !pending.empty())
+    {
+        write_file();
+        pending.clear();
+    }
+    unmap_file();
+}
+
+bool MMapDBM::map_file()
+{
+    FILE *fp = fopen_u(dbfile.c_str(), "rb");
+    if (!fp)
+        return false;
+    fseek(fp, 0, SEEK_END);
+    const long size = ftell(fp);
+    if (size < MMAP_DB_HEADER_SIZE)
+    {
+        fclose(fp);
+        return false;
+    }
+    length = size;
+#ifdef UNIX
+    void *p = mmap(nullptr, length, PROT_READ, MAP_SHARED, fileno(fp), 0);
+    fclose(fp);
+    if (p == MAP_FAILED)
+    {
+        base = nullptr;
+        return false;
+    }
+    base = static_cast<const char *>(p);
+#else
+    // No mmap; read the file in one go instead. Lookups work the same,
+    // the copy just isn't shared between processes.
+    rewind(fp);
+    char *buf = new char[length];
+    const bool read_ok = fread(buf, 1, length, fp) == length;
+    fclose(fp);
+    if (!read_ok)
+    {
+        delete[] buf;
+        return false;
+    }
+    base = buf;
+#endif
+
+    if (memcmp(base, MMAP_DB_MAGIC, 8))
+    {
+        unmap_file();
+        return false;
+    }
+    memcpy(&nbuckets, base + 8, 4);
+    memcpy(&nentries, base + 12, 4);
+    if (!nbuckets || (nbuckets & (nbuckets - 1))
+        || MMAP_DB_HEADER_SIZE + (size_t)nbuckets * 4 > length)
+    {
+        unmap_file();
+        return false;
+    }
+    return true;
+}
+
+void MMapDBM::unmap_file()
+{
+    if (!base)
+        return;
+#ifdef UNIX
+    munmap(const_cast<char *>(base), length);
+#else
+    delete[] base;
+#endif
+    base = nullptr;
+    length = 0;
+    nbuckets = nentries = 0;
+}
+
+// Bounds-check and decode the entry at the given file offset. Returns a
+// pointer to the key bytes, or nullptr if the offset is out of range
+// (corrupt file; the caller treats this as a missing entry and the stale
+// db check regenerates the file).
+const char *MMapDBM::entry_at(size_t offset,
+                              uint32_t *keylen, uint32_t *vallen) const
+{
+    if (offset < MMAP_DB_HEADER_SIZE || offset + 8 > length)
+        return nullptr;
+    memcpy(keylen, base + offset, 4);
+    memcpy(vallen, base + offset + 4, 4);
+    if (*keylen + (size_t)*vallen > length - offset - 8)
+        return nullptr;
+    return base + offset + 8;
+}
+
+mmap_datum MMapDBM::fetch(const string &key) const
+{
+    if (!base)
+        return mmap_datum();
+
+    const uint32_t mask = nbuckets - 1;
+    uint32_t idx = _hash_key(key.c_str(), key.length()) & mask;
+    for (uint32_t probes = 0; probes < nbuckets; probes++)
+    {
+        uint32_t offset;
+        memcpy(&offset, base + MMAP_DB_HEADER_SIZE + (size_t)idx * 4, 4);
+        if (!offset)
+            return mmap_datum();
+
+        uint32_t keylen, vallen;
+        const char *kp = entry_at(offset, &keylen, &vallen);
+        if (!kp)
+            return mmap_datum();
+        if (keylen == key.length() && !memcmp(kp, key.c_str(), keylen))
+            return mmap_datum(kp + keylen, vallen);
+
+        idx = (idx + 1) & mask;
+    }
+    return mmap_datum();
+}
+
+mmap_datum MMapDBM::firstkey()
+{
+    cursor = MMAP_DB_HEADER_SIZE + (size_t)nbuckets * 4;
+    cursor_index = 0;
+    return nextkey();
+}
+
+mmap_datum MMapDBM::nextkey()
+{
+    if (!base || cursor_index >= nentries)
+        return mmap_datum();
+
+    uint32_t keylen, vallen;
+    const char *kp = entry_at(cursor, &keylen, &vallen);
+    if (!kp)
+        return mmap_datum();
+    cursor += 8 + (size_t)keylen + vallen;
+    cursor_index++;
+    return mmap_datum(kp, keylen);
+}
+
+int MMapDBM::insert(const string &key, const string &value)
+{
+    if (readonly)
+        return 1;
+    pending[key] = value;
+    return 0;
+}
+
+bool MMapDBM::write_file()
+{
+    uint32_t buckets = 8;
+    while (buckets < pending.size() * 2)
+        buckets *= 2;
+    const uint32_t mask = buckets - 1;
+    const size_t entries_start = MMAP_DB_HEADER_SIZE + (size_t)buckets * 4;
+
+    vector<uint32_t> table(buckets, 0);
+    string entries;
+    for (const auto &kv : pending)
+    {
+        uint32_t idx = _hash_key(kv.first.c_str(), kv.first.length()) & mask;
+        while (table[idx])
+            idx = (idx + 1) & mask;
+        table[idx] = (uint32_t)(entries_start + entries.size());
+
+        const uint32_t keylen = kv.first.length();
+        const uint32_t vallen = kv.second.length();
+        entries.append((const char *)&keylen, 4);
+        entries.append((const char *)&vallen, 4);
+        entries += kv.first;
+        entries += kv.second;
+    }
+
+    FILE *fp = fopen_u(dbfile.c_str(), "wb");
+    if (!fp)
+        return false;
+    const uint32_t nent = pending.size();
+    bool ok = fwrite(MMAP_DB_MAGIC, 1, 8, fp) == 8
+              && fwrite(&buckets, 4, 1, fp) == 1
+              && fwrite(&nent, 4, 1, fp) == 1
+              && fwrite(&table[0], 4, buckets, fp) == buckets
+              && fwrite(entries.data(), 1, entries.size(), fp)
+                 == entries.size();
+    if (fclose(fp))
+        ok = false;
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+MMapDBM *dbm_open(const char *filename, int mode, int)
+{
+    MMapDBM *n = new MMapDBM(filename, mode == O_RDONLY);
+    if (!n->open())
+    {
+        delete n;
+        return nullptr;
+    }
+
+    return n;
+}
+
+int dbm_close(MMapDBM *db)
+{
+    delete db;
+    return 0;
+}
+
+mmap_datum dbm_fetch(MMapDBM *db, const mmap_datum &key)
+{
+    return db->fetch(string(key.dptr, key.dsize));
+}
+
+mmap_datum dbm_firstkey(MMapDBM *db)
+{
+    return db->firstkey();
+}
+
+mmap_datum dbm_nextkey(MMapDBM *db)
+{
+    return db->nextkey();
+}
+
+int dbm_store(MMapDBM *db, const mmap_datum &key,
+              const mmap_datum &value, int)
+{
+    return db->insert(string(key.dptr, key.dsize),
+                      string(value.dptr, value.dsize));
+}
+
+#endif // USE_MMAP_DBM
@@ -0,0 +1,88 @@
+/**
+ * @file
+ * @brief dbm wrapper over a memory-mapped hash file
+**/
+
+#pragma once
+
+#ifdef USE_MMAP_DBM
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+using std::map;
+using std::string;
+
+// A string dbm interface over an immutable hash file. Writes accumulate
+// in memory and the whole file is laid out in one pass on close; reads
+// come zero-copy out of a shared read-only mapping, so all crawl
+// processes on a host share one copy of the data in the page cache.
+
+struct mmap_datum
+{
+    mmap_datum() : dptr(nullptr), dsize(0) { }
+    mmap_datum(const char *p, size_t s) : dptr(p), dsize(s) { }
+
+    string to_str() const { return string(dptr, dsize); }
+
+    const char *dptr; // Points into the mapping; valid while the db is open.
+    size_t dsize;
+};
+
+#define DBM_REPLACE 1
+
+class MMapDBM
+{
+public:
+    MMapDBM(const string &db, bool readonly);
+    ~MMapDBM();
+
+    bool open();
+    void close();
+
+    mmap_datum fetch(const string &key) const;
+    mmap_datum firstkey();
+    mmap_datum nextkey();
+
+    int insert(const string &key, const string &value);
+
+private:
+    bool map_file();
+    void unmap_file();
+    bool write_file();
+    const char *entry_at(size_t offset,
+                         uint32_t *keylen, uint32_t *vallen) const;
+
+private:
+    string dbfile;
+    bool readonly;
+
+    // Read side.
+    const char *base;
+    size_t length;
+    uint32_t nbuckets;
+    uint32_t nentries;
+    // Sequential iteration state for firstkey/nextkey.
+    size_t cursor;
+    uint32_t cursor_index;
+
+    // Write side: the hash layout needs every entry up front, so inserts
+    // accumulate here and write_file() runs on close.
+    map<string, string> pending;
+};
+
+MMapDBM *dbm_open(const char *filename, int open_mode, int permissions);
+int   dbm_close(MMapDBM *db);
+
+mmap_datum dbm_fetch(MMapDBM *db, const mmap_datum &key);
+mmap_datum dbm_firstkey(MMapDBM *db);
+mmap_datum dbm_nextkey(MMapDBM *db);
+int dbm_store(MMapDBM *db, const mmap_datum &key,
+              const mmap_datum &value, int overwrite);
+
+typedef mmap_datum datum;
+typedef MMapDBM DBM;
+
+#endif
@@ -72,6 +72,7 @@
 #include "traps.h"
 #include "viewchar.h"
 #include "view.h"
+#include "zone-profile.h"
 
 static bool _handle_pickup(monster* mons);
 static bool _monster_move(monster* mons, coord_def& delta);
@@ -2248,6 +2249,49 @@ void handle_monster_move(monster* mons)
         return;
     }
 
+    // Dormant fast path: a plain sleeping monster takes no action below,
+    // it only refreshes its sleep bookkeeping and burns action energy.
+    // Waking is event-driven (noise, damage and the player's stealth
+    // checks all fire behaviour_event), so skip the full decision
+    // pipeline and settle all banked energy in one go instead of once
+    // per queue cycle. Sleepwalkers stumble about, netted monsters
+    // struggle, slime creatures can split in their sleep and kraken
+    // tentacles wave on, so all of those take the long road.
+    if (mons->asleep()
+        && !mons->caught()
+        && !mons->has_ench(ENCH_CONFUSION)
+        && !mons_is_tentacle_head(mons_base_type(*mons))
+        && mons->type != MONS_SLIME_CREATURE
+        && mons->type != MONS_SLYMDRA)
+    {
+        // The state upkeep handle_behaviour's BEH_SLEEP case would do.
+        mons->target = mons->pos();
+        mons->firing_pos = mons->pos();
+        mons->foe = MHITNOT;
+
+        do
+            mons->speed_increment -= non_move_energy;
+        while (non_move_energy > 0 && mons->has_action_energy());
+        return;
+    }
+
+    // Off-level catchup replays up to ten turns of AI per re-entered
+    // level so awake monsters can close on the player's last position.
+    // Firewood can neither move nor act on that, so plant-heavy vaults
+    // pay the full decision pipeline per plant per replayed turn for
+    // nothing; settle their energy in one batch instead. Ballistomycetes
+    // are excluded since their activity cycle runs on their turns.
+    if (you.doing_monster_catchup
+        && mons->is_firewood()
+        && mons->type != MONS_BALLISTOMYCETE
+        && !mons->has_ench(ENCH_CONFUSION))
+    {
+        do
+            mons->speed_increment -= non_move_energy;
+        while (non_move_energy > 0 && mons->has_action_energy());
+        return;
+    }
+
     handle_behaviour(mons);
 
     // handle_behaviour() could make the monster leave the level.
@@ -2684,14 +2728,21 @@ void clear_monster_flags()
 {
     // Clear any summoning flags so that lower indiced monsters get their
     // actions in the next round. Also clear one-turn deep sleep flag.
-    // Finally, track the highest index of monster still alive, for
-    // monster_iterator optimisation purposes.
+    // Finally, track the highest index of monster still alive and rebuild
+    // the dense live-slot index, for monster_iterator optimisation purposes.
+    //
+    // Every slot that became defined since the last rebuild went through
+    // get_free_monster(), which registers it in live_mon_slots, so pruning
+    // the old index is equivalent to scanning the whole array.
     env.max_mon_index = 0;
-    for (int i = 0; i < MAX_MONSTERS; ++i)
+    vector<int> old_slots;
+    old_slots.swap(env.live_mon_slots);
+    for (int i : old_slots)
     {
         if (env.mons[i].defined())
         {
             env.max_mon_index = i;
+            env.live_mon_slots.push_back(i);
             env.mons[i].flags &= ~MF_JUST_SUMMONED & ~MF_JUST_SLEPT;
         }
     }
@@ -2754,6 +2805,7 @@ void print_mons_left_view_messages()
  */
 void handle_monsters(bool with_noise)
 {
+    PERF_ZONE("handle_monsters");
     for (monster_iterator mi; mi; ++mi)
     {
         _pre_monster_move(**mi);
@@ -4,6 +4,7 @@
 
 #include "act-iter.h"
 #include "coord.h"
+#include "coordit.h"
 #include "fprop.h"
 #include "monster.h"
 #include "mon-ench.h"
@@ -82,12 +83,14 @@ static const vector<mon_aura_data> aura_map =
             { return targ.mid == source.summoner;}, nullptr, true},
 };
 
-static mon_aura_data _get_aura_for(const monster& mon)
+// Return by reference: aura entries hold strings and std::functions,
+// and these lookups run for every aura monster every tick.
+static const mon_aura_data& _get_aura_for(const monster& mon)
 {
     const monster_type mtype = (mon.type == MONS_BOUND_SOUL ? mon.base_monster
                                                             : mon.type);
 
-    for (mon_aura_data aura : aura_map)
+    for (const mon_aura_data& aura : aura_map)
     {
         if (aura.mon_source == mtype)
             return aura;
@@ -96,9 +99,9 @@ static mon_aura_data _get_aura_for(const monster& mon)
     die("no aura found for %s", mon.name(DESC_THE).c_str());
 }
 
-static mon_aura_data _get_aura_from_key(string player_key)
+static const mon_aura_data& _get_aura_from_key(const string& player_key)
 {
-    for (mon_aura_data aura : aura_map)
+    for (const mon_aura_data& aura : aura_map)
     {
         if (aura.player_key == player_key)
             return aura;
@@ -126,7 +129,7 @@ bool mons_has_aura_of_type(const monster& mon, enchant_type type)
     const monster_type mtype = (mon.type == MONS_BOUND_SOUL ? mon.base_monster
                                                             : mon.type);
 
-    for (mon_aura_data aura : aura_map)
+    for (const mon_aura_data& aura : aura_map)
     {
         if (aura.ench_type == type && aura.mon_source == mtype)
             return true;
@@ -143,7 +146,7 @@ bool mons_has_aura_of_type(const monster& mon, duration_type type)
     const monster_type mtype = (mon.type == MONS_BOUND_SOUL ? mon.base_monster
                                                             : mon.type);
 
-    for (mon_aura_data aura : aura_map)
+    for (const mon_aura_data& aura : aura_map)
     {
         if (aura.dur_type == type && aura.mon_source == mtype)
             return true;
@@ -186,12 +189,35 @@ static bool _aura_could_affect(const mon_aura_data& aura, const monster& source,
     return true;
 }
 
+static void _apply_aura_ench(const mon_aura_data& aura, const monster& source,
+                             monster& victim)
+{
+    // Check if the target has a pre-existing version of this enchantment
+    // with a longer duration.
+    if (victim.has_ench(aura.ench_type))
+    {
+        mon_enchant en = victim.get_ench(aura.ench_type);
+        if (en.duration > aura.base_duration)
+            return;
+    }
+
+    mon_enchant new_ench(aura.ench_type, &source, aura.base_duration, 0,
+                         aura.is_hostile ? AURA_HOSTILE : AURA_FRIENDLY);
+
+    // Override an existing enchant rather than just add to it
+    // (which would stack durations).
+    if (victim.has_ench(aura.ench_type))
+        victim.update_ench(new_ench);
+    else
+        victim.add_ench(new_ench);
+}
+
 void mons_update_aura(const monster& mon)
 {
     if (!mons_has_aura(mon))
         return;
 
-    const mon_aura_data aura = _get_aura_for(mon);
+    const mon_aura_data& aura = _get_aura_for(mon);
 
     // Hostile auras are suppressed by the source being in a sanctuary
     if (aura.is_hostile && is_sanctuary(mon.pos()))
@@ -199,28 +225,23 @@ void mons_update_aura(const monster& mon)
 
     if (aura.ench_type != ENCH_NONE)
     {
-        for (monster_near_iterator mi(mon.pos(), LOS_NO_TRANS); mi; ++mi)
+        if (aura.adjacent_only)
+        {
+            // No reason to walk the source's whole LOS for an aura that
+            // reaches one cell.
+            for (adjacent_iterator ai(mon.pos()); ai; ++ai)
+            {
+                monster* targ = monster_at(*ai);
+                if (targ && targ->alive() && _aura_could_affect(aura, mon, *targ))
+                    _apply_aura_ench(aura, mon, *targ);
+            }
+        }
+        else
         {
-            if (_aura_could_affect(aura, mon, **mi))
+            for (monster_near_iterator mi(mon.pos(), LOS_NO_TRANS); mi; ++mi)
             {
-                // Check if the target has a pre-existing version of this enchantment
-                // with a longer duration.
-                if (mi->has_ench(aura.ench_type))
-                {
-                    mon_enchant en = mi->get_ench(aura.ench_type);
-                    if (en.duration > aura.base_duration)
-                        continue;
-                }
-
-                mon_enchant new_ench(aura.ench_type, &mon, aura.base_duration, 0,
-                                     aura.is_hostile ? AURA_HOSTILE : AURA_FRIENDLY);
-
-                // Override an existing enchant rather than just add to it
-                // (which would stack durations).
-                if (mi->has_ench(aura.ench_type))
-                    mi->update_ench(new_ench);
-                else
-                    mi->add_ench(new_ench);
+                if (_aura_could_affect(aura, mon, **mi))
+                    _apply_aura_ench(aura, mon, **mi);
             }
         }
     }
@@ -268,7 +289,7 @@ bool aura_is_active_on_player(string player_key)
     if (!you.props.exists(player_key))
         return false;
 
-    mon_aura_data aura = _get_aura_from_key(player_key);
+    const mon_aura_data& aura = _get_aura_from_key(player_key);
     for (monster_near_iterator mi(you.pos(), LOS_NO_TRANS); mi; ++mi)
     {
         if (!mons_has_aura_of_type(**mi, aura.dur_type))
@@ -4985,6 +4985,19 @@ static mon_spell_slot _find_spell_prospect(const monster &mons,
  * @param ignore_good_idea      Whether to be almost completely indiscriminate
  *                              with beam spells. XXX: refactor this out?
  */
+// Memoized tracer verdicts, keyed by caster and spell; see
+// _should_cast_spell(). A verdict can change whenever any actor moves
+// (or dies) or the terrain does, so the whole cache is dropped as soon
+// as either mark advances.
+struct tracer_verdict
+{
+    coord_def target;
+    bool good;
+};
+static map<pair<mid_t, spell_type>, tracer_verdict> _tracer_verdicts;
+static unsigned _tracer_terrain_mark = 0;
+static unsigned _tracer_actor_mark = 0;
+
 static bool _should_cast_spell(const monster &mons, spell_type spell,
                                bolt &beem, bool ignore_good_idea)
 {
@@ -4992,10 +5005,41 @@ static bool _should_cast_spell(const monster &mons, spell_type spell,
     if (get_spell_flags(spell) & spflag::needs_tracer)
     {
         const bool explode = spell_is_direct_explosion(spell);
+
+        // The selection passes above this can ask about the same spell
+        // several times per decision (emergency, prospect and caution
+        // passes), and in a stand-off nothing changes between turns
+        // either; reuse the last verdict while the level state is
+        // provably the same. Ru's redirection deliberately skews
+        // verdicts, so don't mix it into the cache.
+        if (_tracer_terrain_mark != terrain_change_mark()
+            || _tracer_actor_mark != actor_position_mark())
+        {
+            _tracer_verdicts.clear();
+            _tracer_terrain_mark = terrain_change_mark();
+            _tracer_actor_mark = actor_position_mark();
+        }
+
+        const pair<mid_t, spell_type> key(mons.mid, spell);
+        if (!ignore_good_idea)
+        {
+            const auto cached = _tracer_verdicts.find(key);
+            if (cached != _tracer_verdicts.end()
+                && cached->second.target == beem.target)
+            {
+                // Leave the beam configured as a fired tracer would.
+                setup_tracer_bolt(&mons, beem);
+                return cached->second.good;
+            }
+        }
+
         targeting_tracer tracer;
         fire_tracer(&mons, tracer, beem, explode);
         // Good idea?
-        return mons_should_fire(beem, tracer, ignore_good_idea);
+        const bool good = mons_should_fire(beem, tracer, ignore_good_idea);
+        if (!ignore_good_idea)
+            _tracer_verdicts[key] = { beem.target, good };
+        return good;
     }
 
     // Spells with custom marionette logic get to bypass certain normal checks
@@ -222,6 +222,8 @@ bool monster::add_ench(const mon_enchant &ench, bool stack_duration)
     if (ench.ench == ENCH_PARALYSIS)
         stop_directly_constricting_all();
 
+    bump_actor_ench_mark();
+
     return true;
 }
 
@@ -403,6 +405,7 @@ bool monster::del_ench(enchant_type ench, bool quiet, bool effect)
     ench_cache.set(et, false);
     if (effect)
         remove_enchantment_effect(me, quiet);
+    bump_actor_ench_mark();
     return true;
 }
 
@@ -1972,8 +1975,8 @@ void monster::apply_enchantments()
 
     // The ordering in enchant_type makes sure that "super-enchantments"
     // like berserk time out before their parts.
-    for (int i = 0; i < NUM_ENCHANTMENTS; ++i)
-        if (ec[i] && has_ench(static_cast<enchant_type>(i)))
+    for (int i = ec.first_set(); i < NUM_ENCHANTMENTS; i = ec.next_set(i))
+        if (has_ench(static_cast<enchant_type>(i)))
             apply_enchantment(enchantments.find(static_cast<enchant_type>(i))->second);
 }
 
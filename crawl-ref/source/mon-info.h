@@ -371,6 +371,15 @@ struct monster_info : public monster_info_base
     /* only real equipment is visible, miscellany is for mimic items */
     unique_ptr<item_def> inv[MSLOT_LAST_VISIBLE_SLOT + 1];
 
+#ifdef USE_TILE
+    // Memoized result of tileidx_monster (a tileidx_t): monster_info
+    // objects are rebuilt whenever the monster they reflect changes, so
+    // the tile stack only needs deriving once per rebuild rather than
+    // once per frame. Not marshalled, and deliberately reset on copy.
+    mutable uint64_t tile_memo = 0;
+    mutable bool tile_memo_set = false;
+#endif
+
     struct
     {
         species_type species;
@@ -79,6 +79,85 @@ bool target_is_unreachable(monster* mon)
            || mon->travel_target == MTRAV_KNOWN_UNREACHABLE;
 }
 
+// Connected regions of non-solid terrain, used to reject unreachable
+// targets before any pathfinding starts. Doors count as connections and so
+// do deep water and lava, so region boundaries are walls only: a negative
+// answer means no amount of walking, swimming or flying gets there, while a
+// positive answer just means pathfinding has a chance. The labels are
+// rebuilt lazily when the terrain changes; a full relabelling costs no more
+// than a single level-wide pathfind.
+static short _region_grid[GXM][GYM];
+static level_id _region_level;
+static unsigned _region_terrain_mark = 0;
+static bool _region_grid_valid = false;
+
+static bool _region_passable(const coord_def &p)
+{
+    const dungeon_feature_type feat = env.grid(p);
+    return !feat_is_solid(feat) || feat_is_closed_door(feat);
+}
+
+static void _relabel_regions()
+{
+    memset(_region_grid, 0, sizeof(_region_grid));
+
+    short next_region = 0;
+    vector<coord_def> frontier;
+    for (rectangle_iterator ri(1); ri; ++ri)
+    {
+        if (_region_grid[ri->x][ri->y] || !_region_passable(*ri))
+            continue;
+
+        ++next_region;
+        _region_grid[ri->x][ri->y] = next_region;
+        frontier.push_back(*ri);
+        while (!frontier.empty())
+        {
+            const coord_def c = frontier.back();
+            frontier.pop_back();
+            for (adjacent_iterator ai(c); ai; ++ai)
+            {
+                if (in_bounds(*ai) && !_region_grid[ai->x][ai->y]
+                    && _region_passable(*ai))
+                {
+                    _region_grid[ai->x][ai->y] = next_region;
+                    frontier.push_back(*ai);
+                }
+            }
+        }
+    }
+
+    _region_level = level_id::current();
+    _region_terrain_mark = terrain_change_mark();
+    _region_grid_valid = true;
+}
+
+// Can mon conceivably reach targ? False only if the two positions lie in
+// different terrain regions and mon can't make its own holes in walls; a
+// cheap necessary condition to check before pathfinding towards targ.
+bool mons_can_reach_region(const monster* mon, const coord_def &targ)
+{
+    if (mon->can_burrow() || mon->can_pass_through_feat(DNGN_ROCK_WALL))
+        return true;
+
+    if (!_region_grid_valid
+        || _region_level != level_id::current()
+        || _region_terrain_mark != terrain_change_mark())
+    {
+        _relabel_regions();
+    }
+
+    const short from = _region_grid[mon->pos().x][mon->pos().y];
+    const short to   = _region_grid[targ.x][targ.y];
+
+    // Either endpoint inside a wall (a submerged or trapped creature, or a
+    // target to be approached rather than entered): no verdict.
+    if (!from || !to)
+        return true;
+
+    return from == to;
+}
+
 //#define DEBUG_PATHFIND
 
 // Check whether there's an unobstructed path to our foe,
@@ -189,11 +268,40 @@ bool try_pathfind(monster* mon)
         return false;
     }
 
+    // A target in a different terrain region can't be reached however large
+    // the search range; don't bother searching. Ranged monsters search
+    // anyway, since find_fallback() may find a line of fire short of the
+    // target.
+    if (threat_range_lof == 1 && threat_range_no_lof == 1
+        && !mons_can_reach_region(mon, targpos))
+    {
+        _set_no_path_found(mon);
+        return false;
+    }
+
 #ifdef DEBUG_PATHFIND
     mprf("Need a path for %s from (%d, %d) to (%d, %d), max. dist = %d",
          mon->name(DESC_PLAIN).c_str(), mon->pos().x, mon->pos().y,
          targpos.x, targpos.y, range);
 #endif
+    // Packs chasing a shared foe can usually descend a flow field computed
+    // once from the foe's position instead of each running their own search.
+    // Monsters the field can't serve (or reach) fall through to the usual
+    // per-monster search below.
+    if (monster_pathfind *field = mons_flow_field(mon, targpos, range))
+    {
+        if (field->flow_reaches(mon->pos()))
+        {
+            mon->travel_path = field->flow_waypoints(mon);
+            if (!mon->travel_path.empty())
+            {
+                mon->target = mon->travel_path[0];
+                mon->travel_target = MTRAV_FOE;
+                return true;
+            }
+        }
+    }
+
     monster_pathfind mp;
     mp.set_range(range);
 
@@ -732,6 +840,9 @@ static bool _band_wander_target(monster * mon)
     int leader_dist = grid_distance(mon->pos(), band_leader->pos());
     if (leader_dist > dist_thresh)
     {
+        if (!mons_can_reach_region(mon, band_leader->pos()))
+            return true;
+
         monster_pathfind mp;
         mp.set_range(1000);
 
@@ -790,6 +901,9 @@ static bool _leader_wander_target(monster * mon)
             && (grid_distance(mi->pos(), mon->pos()) > LOS_DEFAULT_RANGE
                || !mon->see_cell(mi->pos())))
         {
+            if (!mons_can_reach_region(mon, mi->pos()))
+                continue;
+
             monster_pathfind mp;
             mp.set_range(1000);
 
@@ -1014,6 +1128,10 @@ bool mons_path_to_nearest_level_exit(monster* mon)
     // we find.
     for (unsigned int i = 0; i < _level_exit_cache.size(); ++i)
     {
+        // Skip exits sealed off from us entirely.
+        if (!mons_can_reach_region(mon, _level_exit_cache[i].pos))
+            continue;
+
         monster_pathfind mp;
         // Set a short range to reduce pathological searches for nearby, but
         // otherwise unreachable, exits.
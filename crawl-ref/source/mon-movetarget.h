@@ -10,6 +10,7 @@ using std::vector;
 class monster;
 
 bool target_is_unreachable(monster* mon);
+bool mons_can_reach_region(const monster* mon, const coord_def &targ);
 bool try_pathfind(monster* mon);
 void check_wander_target(monster* mon, bool isPacified = false);
 void set_random_target(monster* mon);
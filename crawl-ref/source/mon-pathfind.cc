@@ -150,6 +150,62 @@ void monster_pathfind::fill_traversability(const monster* mon, int _range,
     start_pathfind();
 }
 
+// Flood the whole tracking range outwards from dest, so that prev[] forms a
+// "flow field" which any monster moving like mon can descend towards dest.
+// This is the same fill mode fill_traversability() uses, just rooted at the
+// shared target rather than at the monster.
+void monster_pathfind::init_flow_field(const monster* mon, coord_def dest,
+                                       int _range)
+{
+    mons   = mon;
+    start  = dest;
+    target = coord_def();
+    pos    = start;
+    allow_diagonals   = true;
+    traverse_unmapped = false;
+    // Callers never share fields between monsters that keep to the player's
+    // sight; see mons_flow_field().
+    traverse_in_sight = false;
+    fill_range = true;
+    traverse_no_actors = false;
+    set_range(_range);
+    start_pathfind();
+}
+
+// Whether the last flow field flood reached p at all.
+bool monster_pathfind::flow_reaches(const coord_def& p) const
+{
+    return dist[p.x][p.y] != INFINITE_DISTANCE;
+}
+
+// Read the path from mon's position down a flow field rooted at start (see
+// init_flow_field()) and compress it into waypoints. prev[] always points
+// back towards the search origin, which here is the shared target, so unlike
+// backtrack() no reversal is needed.
+vector<coord_def> monster_pathfind::flow_waypoints(const monster* mon)
+{
+    // Compute waypoints against the asking monster, not the (possibly since
+    // deceased) monster the field was flooded for.
+    mons = mon;
+
+    ASSERT(flow_reaches(mon->pos()));
+
+    vector<coord_def> path;
+    pos = mon->pos();
+    path.push_back(pos);
+    while (pos != start)
+    {
+        pos = pos + Compass[prev[pos.x][pos.y]];
+        ASSERT_IN_BOUNDS(pos);
+        path.push_back(pos);
+
+        if (pos.origin())
+            break;
+    }
+
+    return waypoints_from_path(path);
+}
+
 bool monster_pathfind::start_pathfind(bool msg)
 {
     // NOTE: We never do any traversable() check for the target square.
@@ -386,8 +442,12 @@ vector<coord_def> monster_pathfind::backtrack()
 // avoid plants and other monsters in the way.
 vector<coord_def> monster_pathfind::calc_waypoints()
 {
-    vector<coord_def> path = backtrack();
+    return waypoints_from_path(backtrack());
+}
 
+vector<coord_def> monster_pathfind::waypoints_from_path(
+    const vector<coord_def>& path)
+{
     // If no path found, nothing to be done.
     if (path.empty())
         return path;
@@ -607,3 +667,86 @@ bool monster_pathfind::find_fallback(int need_lof_range, int ignore_lof_range)
 
     return false;
 }
+
+/////////////////////////////////////////////////////////////////////////////
+// Shared flow fields.
+//
+// A pack chasing a common foe would otherwise run one full search per member
+// per turn, all of them nearly identical. Instead we flood once from the
+// target (init_flow_field()) and let every monster whose movement is
+// interchangeable with the flooding monster's descend the same field. The
+// cache key has to cover everything traversable() and mons_travel_cost()
+// consult about the monster itself: type and base type (habitat, doors, the
+// thorn hunter special case), attitude (trap costs) and flight (floundering).
+// Fields are only valid for the turn they were flooded on.
+
+struct flow_field_entry
+{
+    monster_pathfind field;
+    monster_type mtype;
+    monster_type base_type;
+    bool friendly;
+    bool airborne;
+    coord_def targ;
+    int range;
+    int turn;
+};
+
+static const int NUM_FLOW_FIELDS = 3;
+
+// The entries are large (two full-map grids plus the search hash), so they
+// are allocated on first use and recycled round robin.
+static flow_field_entry* _flow_fields[NUM_FLOW_FIELDS];
+static int _flow_field_clock = 0;
+
+// Returns a flow field rooted at targ that mon may descend, flooding one if
+// no cached field fits, or nullptr if mon cannot share a field at all.
+monster_pathfind* mons_flow_field(const monster* mon, const coord_def& targ,
+                                  int range)
+{
+    // init_pathfind() refuses stationary monsters; so do we.
+    if (mon->is_stationary())
+        return nullptr;
+
+    // Friendly summons restrict their paths to the player's sight, which
+    // depends on where each of them happens to stand; they can't share.
+    if (!crawl_state.game_is_arena()
+        && mon->friendly() && mon->is_summoned()
+        && you.see_cell_no_trans(mon->pos()))
+    {
+        return nullptr;
+    }
+
+    const monster_type mtype     = mon->type;
+    const monster_type base_type = mons_base_type(*mon);
+    const bool friendly          = mon->friendly();
+    const bool airborne          = mon->airborne();
+
+    for (int i = 0; i < NUM_FLOW_FIELDS; i++)
+    {
+        flow_field_entry* entry = _flow_fields[i];
+        if (entry && entry->turn == you.num_turns
+            && entry->mtype == mtype && entry->base_type == base_type
+            && entry->friendly == friendly && entry->airborne == airborne
+            && entry->targ == targ && entry->range == range)
+        {
+            return &entry->field;
+        }
+    }
+
+    flow_field_entry*& entry = _flow_fields[_flow_field_clock];
+    _flow_field_clock = (_flow_field_clock + 1) % NUM_FLOW_FIELDS;
+    if (!entry)
+        entry = new flow_field_entry();
+
+    entry->mtype     = mtype;
+    entry->base_type = base_type;
+    entry->friendly  = friendly;
+    entry->airborne  = airborne;
+    entry->targ      = targ;
+    entry->range     = range;
+    entry->turn      = you.num_turns;
+    entry->field.init_flow_field(mon, targ, range);
+
+    return &entry->field;
+}
@@ -13,6 +13,11 @@ class monster;
 
 int mons_tracking_range(const monster* mon);
 
+class monster_pathfind;
+
+monster_pathfind* mons_flow_field(const monster* mon, const coord_def& targ,
+                                  int range);
+
 class monster_pathfind
 {
 public:
@@ -30,6 +35,9 @@ public:
                        bool msg = false);
     void fill_traversability(const monster* mon, int range,
                              bool no_actors = false);
+    void init_flow_field(const monster* mon, coord_def dest, int range);
+    bool flow_reaches(const coord_def& p) const;
+    vector<coord_def> flow_waypoints(const monster* mon);
     bool start_pathfind(bool msg = false);
     bool find_fallback(int need_lof_range, int ignore_lof_range);
     vector<coord_def> backtrack();
@@ -48,6 +56,7 @@ protected:
     void add_new_pos(coord_def pos, int total);
     void update_pos(coord_def pos, int total);
     bool get_best_position();
+    vector<coord_def> waypoints_from_path(const vector<coord_def>& path);
 
     // The monster trying to find a path.
     const monster* mons;
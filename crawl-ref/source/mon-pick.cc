@@ -65,19 +65,80 @@ monster_type pick_monster_by_hash(branch_type branch, uint32_t hash)
     return population[branch][hash % population[branch].size()].value;
 }
 
+// Cumulative weight tables for the branch populations, built lazily per
+// (branch, depth) pair. Depth ranges and distribution curves are resolved
+// when the table is built, so the common case of a pick is one RNG draw
+// and a binary search instead of a full scan of the population list.
+struct pop_cumul
+{
+    pop_cumul() : total(0), built(false) {}
+
+    vector<pair<int, monster_type>> cumul; // running weight total, entry
+    int total;
+    bool built;
+};
+
+static const pop_cumul &_population_cumul(branch_type branch, int depth)
+{
+    static map<pair<int, int>, pop_cumul> cache;
+    pop_cumul &tab = cache[make_pair(static_cast<int>(branch), depth)];
+    if (tab.built)
+        return tab;
+
+    monster_picker scorer;
+    for (const pop_entry &pop : population[branch])
+    {
+        if (depth < pop.minr || depth > pop.maxr)
+            continue;
+        const int rar = scorer.rarity_at(pop, depth);
+        ASSERT(rar > 0);
+        tab.total += rar;
+        tab.cumul.emplace_back(tab.total, pop.value);
+    }
+    tab.built = true;
+    return tab;
+}
+
+monster_type monster_picker::pick_from_branch(branch_type branch, int depth,
+                                              monster_type none,
+                                              mon_pick_vetoer vetoer)
+{
+    _veto = vetoer;
+
+    const pop_cumul &tab = _population_cumul(branch, depth);
+    if (!tab.total)
+        return none;
+
+    const int roll = random2(tab.total);
+    auto it = upper_bound(tab.cumul.begin(), tab.cumul.end(), roll,
+                          [](int r, const pair<int, monster_type> &e)
+                          { return r < e.first; });
+    ASSERT(it != tab.cumul.end());
+    if (!veto(it->second))
+        return it->second;
+
+    // The pick was vetoed: redo it with the exact scan, which skips every
+    // vetoed entry and renormalises. Falling back (rather than redrawing
+    // from the table) keeps the distribution identical to a pure scan:
+    // with total weight W = W' + V split into non-vetoed and vetoed parts,
+    // P(m) = w_m/W + (V/W) * (w_m/W') = w_m/W'.
+    return pick(population[branch], depth, none);
+}
+
 monster_type pick_monster(level_id place, mon_pick_vetoer veto)
 {
 #ifdef ASSERTS
     if (!place.is_valid())
         die("trying to pick a monster from %s", place.describe().c_str());
 #endif
-    return pick_monster_from(population[place.branch], place.depth, veto);
+    monster_picker picker = monster_picker();
+    return picker.pick_from_branch(place.branch, place.depth, MONS_0, veto);
 }
 
 monster_type pick_monster(level_id place, monster_picker &picker, mon_pick_vetoer veto)
 {
     ASSERT(place.is_valid());
-    return picker.pick_with_veto(population[place.branch], place.depth, MONS_0, veto);
+    return picker.pick_from_branch(place.branch, place.depth, MONS_0, veto);
 }
 
 monster_type pick_monster_from(const vector<pop_entry>& fpop, int depth,
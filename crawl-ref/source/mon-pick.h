@@ -45,6 +45,12 @@ public:
     monster_type pick_with_veto(const vector<pop_entry>& weights, int level,
                                 monster_type none,
                                 mon_pick_vetoer vetoer = nullptr);
+    // As pick_with_veto on the branch's population list, but served from a
+    // precomputed cumulative weight table; only the selected candidate is
+    // tested against the veto, with an exact rescan as the fallback.
+    monster_type pick_from_branch(branch_type branch, int depth,
+                                  monster_type none,
+                                  mon_pick_vetoer vetoer = nullptr);
 
     virtual bool veto(monster_type mon) override;
 
@@ -438,8 +438,12 @@ bool iood_act(monster& mon, bool no_trail)
 {
     ASSERT(mons_is_projectile(mon.type));
 
-    float x = mon.props[IOOD_X];
-    float y = mon.props[IOOD_Y];
+    // The orb's ray state is carried in props so that it survives saves,
+    // and advancing it is a single addition per step. Look the position
+    // fields up once and step them in place instead of paying a hash
+    // lookup for every read and store below.
+    float &x = mon.props[IOOD_X].get_float();
+    float &y = mon.props[IOOD_Y].get_float();
     float vx = mon.props[IOOD_VX];
     float vy = mon.props[IOOD_VY];
 
@@ -481,7 +485,8 @@ bool iood_act(monster& mon, bool no_trail)
         // (from 1 to 2) would be a guaranteed escape. This may be
         // realistic (strafing!), but since the game has no non-cheesy
         // means of waiting a small fraction of a turn, we don't want it.
-        const int old_t_pos = mon.props[IOOD_TPOS].get_short();
+        short &t_pos = mon.props[IOOD_TPOS].get_short();
+        const int old_t_pos = t_pos;
         const coord_def rpos(static_cast<int>(round(x)), static_cast<int>(round(y)));
         if (old_t_pos && old_t_pos != (256 * target.x + target.y)
             && (rpos - target).rdist() <= 1
@@ -491,7 +496,7 @@ bool iood_act(monster& mon, bool no_trail)
             vx = dx;
             vy = dy;
         }
-        mon.props[IOOD_TPOS].get_short() = 256 * target.x + target.y;
+        t_pos = 256 * target.x + target.y;
 
         if (!_in_front(vx, vy, dx, dy, 0.3f)) // ~17 degrees
         {
@@ -518,14 +523,13 @@ move_again:
     x += vx;
     y += vy;
 
-    mon.props[IOOD_X] = x;
-    mon.props[IOOD_Y] = y;
-    mon.props[IOOD_DIST].get_int()++;
+    int &dist = mon.props[IOOD_DIST].get_int();
+    dist++;
 
     // Make globe of annihilation tile grow based on distance travelled
 #ifdef USE_TILE
     if (mon.type == MONS_GLOBE_OF_ANNIHILATION)
-        mon.props[TILE_NUM_KEY].get_short() = mon.props[IOOD_DIST].get_int();
+        mon.props[TILE_NUM_KEY].get_short() = dist;
 #endif
 
     const coord_def pos(static_cast<int>(round(x)), static_cast<int>(round(y)));
@@ -587,10 +591,10 @@ move_again:
                  && mon.type == MONS_ORB_OF_DESTRUCTION)
         {
             // Weak orbs just fizzle instead of exploding.
-            if (mons->props[IOOD_DIST].get_int() < 2
-                || mon.props[IOOD_DIST].get_int() < 2)
+            const int other_dist = mons->props[IOOD_DIST].get_int();
+            if (other_dist < 2 || dist < 2)
             {
-                if (mons->props[IOOD_DIST].get_int() < 2)
+                if (other_dist < 2)
                 {
                     if (you.see_cell(pos))
                         mpr("The orb fizzles.");
@@ -598,7 +602,7 @@ move_again:
                 }
 
                 // Return, if the acting orb fizzled.
-                if (mon.props[IOOD_DIST].get_int() < 2)
+                if (dist < 2)
                 {
                     if (you.see_cell(pos))
                         mpr("The orb fizzles.");
@@ -699,15 +703,17 @@ move_again:
             return true;
     }
 
+    const float fx = x, fy = y;
     if (!mon.move_to(pos))
     {
         _iood_stop(mon);
         return true;
     }
 
-    // move_to() just trashed the coords, set them again
-    mon.props[IOOD_X] = x;
-    mon.props[IOOD_Y] = y;
+    // move_to() just trashed the coords (monster::set_position() nudges
+    // them by the displacement), set them again
+    x = fx;
+    y = fy;
 
     return false;
 }
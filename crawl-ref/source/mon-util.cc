@@ -76,7 +76,14 @@
 #include "unicode.h"
 #include "unwind.h"
 
-static FixedVector < int, NUM_MONSTERS > mon_entry;
+// Maps monster_type directly to its mondata[] entry, so that
+// get_monster_data() is a single indexed load.
+static FixedVector < monsterentry*, NUM_MONSTERS > mon_entry;
+
+// The class bitfields, broken out flat per monster_type so that
+// mons_class_flag() is one load and one AND with no monsterentry
+// dereference.
+static FixedVector < monclass_flags_t, NUM_MONSTERS > mon_class_flags;
 
 struct mon_display
 {
@@ -200,17 +207,20 @@ monster_type get_monster_by_name(string name, bool substring)
 void init_monsters()
 {
     // First, fill static array with dummy values. {dlb}
-    mon_entry.init(-1);
+    mon_entry.init(nullptr);
 
-    // Next, fill static array with location of entry in mondata[]. {dlb}:
+    // Next, fill static array with the entry's location in mondata[]. {dlb}:
     for (unsigned int i = 0; i < MONDATASIZE; ++i)
-        mon_entry[mondata[i].mc] = i;
+        mon_entry[mondata[i].mc] = &mondata[i];
 
     // Finally, monsters yet with dummy entries point to TTTSNB(tm). {dlb}:
-    for (int &entry : mon_entry)
-        if (entry == -1)
+    for (monsterentry *&entry : mon_entry)
+        if (entry == nullptr)
             entry = mon_entry[MONS_PROGRAM_BUG];
 
+    for (int mc = 0; mc < NUM_MONSTERS; ++mc)
+        mon_class_flags[mc] = mon_entry[mc]->bitfields;
+
     init_monster_symbols();
 }
 
@@ -378,8 +388,8 @@ monster* monster_at(const coord_def &pos)
 /// Are any of the bits set?
 bool mons_class_flag(monster_type mc, monclass_flags_t bits)
 {
-    const monsterentry * const me = get_monster_data(mc);
-    return me && (me->bitfields & bits);
+    return mc >= 0 && mc < NUM_MONSTERS
+           && bool(mon_class_flags[mc] & bits);
 }
 
 int monster::wearing(object_class_type obj_type, int sub_type,
@@ -2585,6 +2595,21 @@ bool mon_type_has_spells(const monster_type mon_type)
     return _get_mc_spellbook(mon_type) != MST_NO_SPELLS;
 }
 
+// mspell_list is ordered by book for readability, not by enum value, so
+// finding a book is a linear scan; monsters are placed (and monster_infos
+// snapshotted) often enough that it's worth an index. Built once on first
+// use; the underlying table is immutable static data.
+static const mon_spellbook *_spellbook_for(mon_spellbook_type book)
+{
+    static map<mon_spellbook_type, const mon_spellbook*> index;
+    if (index.empty())
+        for (const mon_spellbook &spbook : mspell_list)
+            index[spbook.type] = &spbook;
+
+    auto it = index.find(book);
+    return it == index.end() ? nullptr : it->second;
+}
+
 mon_spellbook_type get_spellbook(const monster_info &mon)
 {
     // special case for vault monsters: if they have a custom book,
@@ -2609,12 +2634,7 @@ vector<mon_spell_slot> get_unique_spells(const monster_info &mi,
     COMPILE_CHECK(ARRAYSZ(mspell_list) == NUM_MSTYPES - 1);
 
     const mon_spellbook_type book = get_spellbook(mi);
-
-    // TODO: should we build an index to speed this reverse lookup?
-    unsigned int msidx;
-    for (msidx = 0; msidx < ARRAYSZ(mspell_list); ++msidx)
-        if (mspell_list[msidx].type == book)
-            break;
+    const mon_spellbook *spbook = _spellbook_for(book);
 
     if (mons_genus(mi.type) == MONS_DRACONIAN)
     {
@@ -2633,10 +2653,10 @@ vector<mon_spell_slot> get_unique_spells(const monster_info &mi,
         return slots;
 
     if (book != MST_GHOST)
-        ASSERT(msidx < ARRAYSZ(mspell_list));
+        ASSERT(spbook);
     for (const mon_spell_slot &slot : (book == MST_GHOST
                                        ? mi.spells
-                                       : mspell_list[msidx].spells))
+                                       : spbook->spells))
     {
         if (flags != MON_SPELL_NO_FLAGS && !(slot.flags & flags))
             continue;
@@ -2701,13 +2721,11 @@ void mons_load_spells(monster& mon)
     dprf(DIAG_MONPLACE, "%s: loading spellbook #%d",
          mon.name(DESC_PLAIN, true).c_str(), static_cast<int>(book));
 
-    for (const mon_spellbook &spbook : mspell_list)
-        if (spbook.type == book)
-        {
-            mon.spells.insert(mon.spells.end(),
-                                spbook.spells.begin(), spbook.spells.end());
-            break;
-        }
+    if (const mon_spellbook *spbook = _spellbook_for(book))
+    {
+        mon.spells.insert(mon.spells.end(),
+                            spbook->spells.begin(), spbook->spells.end());
+    }
 }
 
 // Never hand out DARKGREY as a monster colour, even if it is randomly
@@ -2825,7 +2843,7 @@ void define_monster(monster& mons, bool friendly)
     {
         ghost_demon ghost;
         ghost.init_pandemonium_lord(friendly);
-        mons.set_ghost(ghost);
+        mons.set_ghost(std::move(ghost));
         mons.ghost_demon_init();
         mons.bind_melee_flags();
         break;
@@ -2845,7 +2863,7 @@ void define_monster(monster& mons, bool friendly)
                     : 50;
 
         ghost.init_orc_apostle(type, pow);
-        mons.set_ghost(ghost);
+        mons.set_ghost(std::move(ghost));
         mons.ghost_demon_init();
 
         mons.props[MON_GENDER_KEY] = random_choose(GENDER_MALE,
@@ -2892,7 +2910,7 @@ void define_monster(monster& mons, bool friendly)
                 ghost.species = SP_HUMAN;
             mons.props[MIRRORED_GHOST_KEY] = true;
         }
-        mons.set_ghost(ghost);
+        mons.set_ghost(std::move(ghost));
         mons.ghost_init(!mons.props.exists(FAKE_MON_KEY));
         break;
     }
@@ -2902,7 +2920,7 @@ void define_monster(monster& mons, bool friendly)
     {
         ghost_demon ghost;
         ghost.init_ugly_thing(mcls == MONS_VERY_UGLY_THING);
-        mons.set_ghost(ghost);
+        mons.set_ghost(std::move(ghost));
         mons.uglything_init();
         break;
     }
@@ -2916,7 +2934,7 @@ void define_monster(monster& mons, bool friendly)
     {
         ghost_demon ghost;
         ghost.barebones_init();
-        mons.set_ghost(ghost);
+        mons.set_ghost(std::move(ghost));
         break;
     }
 
@@ -3135,7 +3153,7 @@ static bool _give_apostle_proper_name(monster& mon, apostle_type type)
 monsterentry *get_monster_data(monster_type mc)
 {
     if (mc >= 0 && mc < NUM_MONSTERS)
-        return &mondata[mon_entry[mc]];
+        return mon_entry[mc];
     else
         return nullptr;
 }
@@ -5183,6 +5201,7 @@ void reset_all_monsters()
     }
 
     env.mid_cache.clear();
+    env.live_mon_slots.clear();
 }
 
 bool mons_is_recallable(const actor* caller, const monster& targ)
@@ -82,13 +82,14 @@
 #include "xom.h"
 
 monster::monster()
-    : hit_points(0), max_hit_points(0), exp(0),
-      speed(0), speed_increment(0), target(), firing_pos(),
-      patrol_point(), travel_target(MTRAV_NONE), inv(NON_ITEM), spells(),
+    : hit_points(0), max_hit_points(0),
+      speed(0), speed_increment(0),
       attitude(ATT_HOSTILE), behaviour(BEH_WANDER), foe(MHITYOU),
-      enchantments(), flags(), xp_tracking(XP_NON_VAULT),
+      flags(), target(), foe_memory(0), exp(0), firing_pos(),
+      patrol_point(), travel_target(MTRAV_NONE), inv(NON_ITEM), spells(),
+      enchantments(), xp_tracking(XP_NON_VAULT),
       base_monster(MONS_NO_MONSTER), number(0), colour(COLOUR_INHERIT),
-      foe_memory(0), god(GOD_NO_GOD), ghost(),
+      god(GOD_NO_GOD), ghost(),
       client_id(0), hit_dice(0)
 
 {
@@ -162,6 +163,7 @@ void monster::reset()
     mons_remove_from_grid(*this);
     target.reset();
     position.reset();
+    bump_actor_position_mark();
     firing_pos.reset();
     patrol_point.reset();
     travel_target = MTRAV_NONE;
@@ -4477,6 +4479,16 @@ void monster::set_ghost(const ghost_demon &g)
         mname = ghost->name;
 }
 
+// As above, but steals the record's spell and attack vectors instead of
+// copying them; for freshly built ghost_demons that aren't used again.
+void monster::set_ghost(ghost_demon &&g)
+{
+    ghost.reset(new ghost_demon(std::move(g)));
+
+    if (!ghost->name.empty())
+        mname = ghost->name;
+}
+
 void monster::set_new_monster_id()
 {
     mid = ++you.last_mid;
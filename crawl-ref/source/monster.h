@@ -58,29 +58,36 @@ public:
     void reset();
 
 public:
-    // Possibly some of these should be moved into the hash table
-    string mname;
-
+    // The per-turn-hot fields come first: the turn loop's skip checks
+    // (alive(), energy gating, behaviour dispatch) read these for every
+    // monster slot every tick, and keeping them in the object's leading
+    // cache lines means those walks don't drag the cold strings and
+    // vectors below through cache as well.
     int hit_points;
     int max_hit_points;
-    int exp;
     int speed;
     int speed_increment;
-
+    mon_attitude_type attitude;
+    beh_type behaviour;
+    unsigned short foe;
+    int8_t ench_countdown;
+    monster_flags_t flags;             // bitfield of boolean flags
+    FixedBitVector<NUM_ENCHANTMENTS> ench_cache;
     coord_def target;
+    int foe_memory;                    // how long to 'remember' foe x,y
+                                       // once they go out of sight.
+
+    // Possibly some of these should be moved into the hash table
+    string mname;
+
+    int exp;
     coord_def firing_pos;
     coord_def patrol_point;
     mutable montravel_target_type travel_target;
     vector<coord_def> travel_path;
     FixedVector<short, NUM_MONSTER_SLOTS> inv;
     monster_spells spells;
-    mon_attitude_type attitude;
-    beh_type behaviour;
-    unsigned short foe;
-    int8_t ench_countdown;
     mon_enchant_list enchantments;
-    FixedBitVector<NUM_ENCHANTMENTS> ench_cache;
-    monster_flags_t flags;             // bitfield of boolean flags
     xp_tracking_type xp_tracking;
 
     monster_type  base_monster;        // zombie base monster, draconian colour
@@ -105,9 +112,6 @@ public:
     int           colour;
     mid_t         summoner;
 
-    int foe_memory;                    // how long to 'remember' foe x,y
-                                       // once they go out of sight.
-
     god_type god;                      // What god the monster worships, if
                                        // any.
 
@@ -243,6 +247,7 @@ public:
     void set_originating_map(const string &);
 
     void set_ghost(const ghost_demon &ghost);
+    void set_ghost(ghost_demon &&ghost);
     void ghost_init(bool need_pos = true);
     void ghost_demon_init();
     void uglything_init(bool only_mutate = false);
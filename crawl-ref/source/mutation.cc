@@ -38,6 +38,7 @@
 #include "mon-place.h"
 #include "notes.h"
 #include "output.h"
+#include "player.h"
 #include "player-stats.h"
 #include "religion.h"
 #include "skills.h"
@@ -469,19 +470,34 @@ int player::get_temp_mutation_level(mutation_type mut) const
  *
  * @return A mutation level; 0 if the mutation doesn't exist or is suppressed.
  */
+// Effective mutation levels are asked for constantly - resist checks,
+// item interactions and the HUD all query them within a single turn -
+// and the active_only path re-runs the form/anatomy compatibility
+// checks on every call. All of the inputs (the mutation arrays, form,
+// species and equipment) are covered by the derived-stats version
+// counter, so the answer is memoized per mutation against it. The base
+// levels themselves are already plain array reads.
+static struct mut_level_memo
+{
+    unsigned int version; // 0 is never current, so entries start invalid
+    int8_t level;
+} _mut_level_memo[NUM_MUTATIONS];
+
 int player::get_mutation_level(mutation_type mut, bool active_only) const
 {
     ASSERT_RANGE(mut, 0, NUM_MUTATIONS);
-    if (const int level = get_base_mutation_level(mut, true, true))
-    {
-        if (level == 0)
-            return 0;
 
-        if (!active_only || mut_is_compatible(mut))
-            return level;
-    }
+    if (!active_only)
+        return get_base_mutation_level(mut, true, true);
 
-    return 0;
+    mut_level_memo &memo = _mut_level_memo[mut];
+    if (memo.version != derived_stats_version())
+    {
+        const int level = get_base_mutation_level(mut, true, true);
+        memo.level = level > 0 && mut_is_compatible(mut) ? level : 0;
+        memo.version = derived_stats_version();
+    }
+    return memo.level;
 }
 
 /*
@@ -1917,6 +1933,7 @@ bool mutate(mutation_type which_mutation, const string &reason, bool failMsg,
                     you.attribute[ATTR_TEMP_MUT_KILLS] = 0;
             }
             you.mutation[mutat]--;
+            invalidate_derived_stats();
             mprf(MSGCH_MUTATION, "Your %s mutation feels more permanent.",
                                   mutation_name(mutat));
             take_note(Note(NOTE_PERM_MUTATION, mutat,
@@ -1961,6 +1978,7 @@ bool mutate(mutation_type which_mutation, const string &reason, bool failMsg,
         }
         else if (mutclass == MUTCLASS_INNATE)
             you.innate_mutation[mutat]++;
+        invalidate_derived_stats();
 
         const int cur_base_level = you.get_base_mutation_level(mutat);
 
@@ -2169,6 +2187,7 @@ bool _delete_single_mutation_level(mutation_type mutat,
     bool lose_msg = true;
 
     you.mutation[mutat]--;
+    invalidate_derived_stats();
 
     switch (mutat)
     {
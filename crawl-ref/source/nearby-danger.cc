@@ -12,6 +12,7 @@
 
 #include "abyss.h"
 #include "act-iter.h"
+#include "actor.h"
 #include "areas.h"
 #include "cloud.h"
 #include "clua.h"
@@ -236,8 +237,8 @@ vector<monster* > get_nearby_monsters(bool want_move,
         return false;                               \
     }}
 
-bool i_feel_safe(bool announce, bool want_move, bool just_monsters,
-                 bool check_dist, int range, string* reason)
+static bool _i_feel_safe(bool announce, bool want_move, bool just_monsters,
+                         bool check_dist, int range, string* reason)
 {
     if (!just_monsters)
     {
@@ -299,6 +300,49 @@ bool i_feel_safe(bool announce, bool want_move, bool just_monsters,
 }
 #undef UNSAFE_MSG
 
+// Safety verdicts memoized for the duration of one world state: rest
+// checks, travel interrupts and prompts all re-ask i_feel_safe() within a
+// single player action, and autoexplore asks per step. The memo is
+// dropped whenever game time, the terrain-change mark or the
+// actor-position mark advances, which covers monster moves, spawns and
+// deaths.
+static map<pair<int, int>, bool> _safety_memo;
+static int _safety_elapsed_time = -1;
+static unsigned _safety_terrain_mark = 0;
+static unsigned _safety_actor_mark = 0;
+
+bool i_feel_safe(bool announce, bool want_move, bool just_monsters,
+                 bool check_dist, int range, string* reason)
+{
+    // Announcements and reason strings are side effects the caller wants
+    // every time; only plain queries go through the memo.
+    if (announce || reason)
+        return _i_feel_safe(announce, want_move, just_monsters, check_dist,
+                            range, reason);
+
+    if (_safety_elapsed_time != you.elapsed_time
+        || _safety_terrain_mark != terrain_change_mark()
+        || _safety_actor_mark != actor_position_mark())
+    {
+        _safety_memo.clear();
+        _safety_elapsed_time = you.elapsed_time;
+        _safety_terrain_mark = terrain_change_mark();
+        _safety_actor_mark = actor_position_mark();
+    }
+
+    const pair<int, int> key(range, (want_move ? 1 : 0)
+                                    | (just_monsters ? 2 : 0)
+                                    | (check_dist ? 4 : 0));
+    const auto cached = _safety_memo.find(key);
+    if (cached != _safety_memo.end())
+        return cached->second;
+
+    const bool safe = _i_feel_safe(false, want_move, just_monsters,
+                                   check_dist, range, nullptr);
+    _safety_memo[key] = safe;
+    return safe;
+}
+
 bool can_rest_here(bool announce)
 {
     // XXX: consider doing a check for whether your regen is *ever* inhibited
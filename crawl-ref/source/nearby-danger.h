@@ -6,6 +6,7 @@
 #pragma once
 
 #include "coord.h"
+#include "coord-def.h" // COMPASS_DELTA
 #include "random.h" // shuffle_array
 
 #include <numeric> // iota
@@ -14,8 +15,6 @@
 
 using std::vector;
 
-extern const struct coord_def Compass[9];
-
 bool mons_is_irrelevant(const monster* mon);
 bool mons_is_always_safe(const monster *mon);
 bool mons_is_safe(const monster* mon, const bool want_move = false,
@@ -126,7 +125,7 @@ struct simple_connect
         for (int i=0; i < connect; i++)
         {
             position_node temp;
-            temp.pos = node.pos + Compass[compass_idx[i]];
+            temp.pos = node.pos + COMPASS_DELTA[compass_idx[i]];
             if (!in_bounds(temp.pos))
                 continue;
 
@@ -656,6 +656,7 @@ static void _setup_generic(const newgame_def& ng,
     init_companions();
 
     // Create the save file.
+    reset_level_cache();
     if (Options.no_save)
         you.save = new package();
     else
@@ -8,6 +8,7 @@
 #include "notes.h"
 
 #include <iomanip>
+#include <set>
 #include <sstream>
 #include <vector>
 
@@ -32,6 +33,22 @@
 vector<Note> note_list;
 int last_screen_turn = -1;
 
+// (god, rank) pairs already noted, so NOTE_PIETY_RANK noteworthiness
+// doesn't need to rescan the whole note list.
+static set<pair<int, int>> _piety_ranks_seen;
+
+// Marshalled bytes of the first _notes_marshalled entries of note_list.
+// Notes are append-only, so each save only has to marshal the notes taken
+// since the last one and splice the buffer in with a single write.
+static vector<unsigned char> _marshalled_notes;
+static size_t _notes_marshalled = 0;
+
+static void _register_note(const Note& note)
+{
+    if (note.type == NOTE_PIETY_RANK)
+        _piety_ranks_seen.insert(make_pair(note.first, note.second));
+}
+
 static bool _is_highest_skill(int skill)
 {
     for (int i = 0; i < NUM_SKILLS; ++i)
@@ -159,36 +176,26 @@ static bool _is_noteworthy(const Note& note)
     if (note.type == NOTE_DUNGEON_LEVEL_CHANGE)
         return _is_noteworthy_dlevel(note.place);
 
-    for (const Note &oldnote : note_list)
-    {
-        if (oldnote.type != note.type)
-            continue;
+    if (note.type == NOTE_PIETY_RANK)
+        return !_piety_ranks_seen.count(make_pair(note.first, note.second));
 
-        const Note& rnote(oldnote);
-        switch (note.type)
+    if (note.type == NOTE_HP_CHANGE)
+    {
+        // Not if we have a recent warning
+        // unless we've lost half our HP since then.
+        // Notes are taken in turn order, so stop scanning at the first one
+        // old enough not to count as recent.
+        for (auto it = note_list.rbegin(); it != note_list.rend(); ++it)
         {
-        case NOTE_PIETY_RANK:
-            if (rnote.first == note.first && rnote.second == note.second)
+            if (note.turn - it->turn >= 5)
+                break;
+            if (it->type == NOTE_HP_CHANGE && note.first * 2 >= it->first)
                 return false;
-            break;
-
-        case NOTE_HP_CHANGE:
-            // Not if we have a recent warning
-            // unless we've lost half our HP since then.
-            if (note.turn - rnote.turn < 5
-                && note.first * 2 >= rnote.first)
-            {
-                return false;
-            }
-            break;
-
-        default:
-            mpr("Buggy note passed: unknown note type");
-            // Return now, rather than give a "Buggy note passed" message
-            // for each note of the matching type in the note list.
-            return true;
         }
+        return true;
     }
+
+    mpr("Buggy note passed: unknown note type");
     return true;
 }
 
@@ -552,6 +559,7 @@ void take_note(const Note& note, bool force)
     if (notes_active && (force || _is_noteworthy(note)))
     {
         note_list.push_back(note);
+        _register_note(note);
         note.check_milestone();
     }
 }
@@ -561,12 +569,36 @@ void activate_notes(bool active)
     notes_active = active;
 }
 
+void clear_notes()
+{
+    note_list.clear();
+    _piety_ranks_seen.clear();
+    _marshalled_notes.clear();
+    _notes_marshalled = 0;
+}
+
 void save_notes(writer& outf)
 {
     marshallInt(outf, NOTES_VERSION_NUMBER);
     marshallInt(outf, note_list.size());
-    for (const Note &note : note_list)
-        note.save(outf);
+
+    // Shouldn't happen (notes are only removed by clear_notes()), but
+    // don't trust a stale buffer if the list has shrunk under us.
+    if (_notes_marshalled > note_list.size())
+    {
+        _marshalled_notes.clear();
+        _notes_marshalled = 0;
+    }
+
+    {
+        writer cache(&_marshalled_notes);
+        for (size_t i = _notes_marshalled; i < note_list.size(); ++i)
+            note_list[i].save(cache);
+        _notes_marshalled = note_list.size();
+    }
+
+    if (!_marshalled_notes.empty())
+        outf.write(&_marshalled_notes[0], _marshalled_notes.size());
 }
 
 void load_notes(reader& inf)
@@ -580,6 +612,7 @@ void load_notes(reader& inf)
         Note new_note;
         new_note.load(inf);
         note_list.push_back(new_note);
+        _register_note(new_note);
     }
 }
 
@@ -102,6 +102,7 @@ struct Note
 extern vector<Note> note_list;
 void activate_notes(bool active);
 bool notes_are_active();
+void clear_notes();
 void take_note(const Note& note, bool force = false);
 void save_notes(writer&);
 void load_notes(reader&);
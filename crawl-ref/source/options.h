@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <functional>
@@ -393,9 +394,11 @@ protected:
     set<string> included;  // Files we've included already.
 
     vector<GameOption*> option_behaviour;
-    map<string, GameOption*> options_by_name;
+    // Hashed so that per-line option dispatch in read_option_line is a
+    // single hash lookup rather than an ordered-map walk.
+    unordered_map<string, GameOption*> options_by_name;
     virtual const vector<GameOption*> build_options_list();
-    map<string, GameOption*> build_options_map(const vector<GameOption*> &opts);
+    unordered_map<string, GameOption*> build_options_map(const vector<GameOption*> &opts);
 
     string unalias(const string &key) const;
     string expand_vars(const string &field) const;
@@ -456,6 +459,8 @@ public:
     string game_seed; // string version of the rc option
     uint64_t    seed_from_rc;
     level_gen_type pregen_dungeon;
+    bool        pregen_whole_branches; // extend triggered pregen passes to
+                                       // the end of the target branch
 
 #ifdef DGL_SIMPLE_MESSAGING
     bool        messaging;      // Check for messages.
@@ -553,6 +558,8 @@ public:
     int         food_snacking_frequency; // how often walking on food makes one eat
     int         fountain_line_frequency; // how often walking on fountains causes commentary
     bool        reduce_animations;   // if true, don't show interim steps for animations
+    int         animation_budget_ms; // cap on total animation delay per turn;
+                                     // 0 means no cap
     bool        drop_disables_autopickup;   // if true, automatically remove drops from autopickup
 
     vector<text_pattern> unusual_monster_items; // which monster items to
@@ -562,6 +569,8 @@ public:
 
     int         hp_warning;      // percentage hp for danger warning
     int         magic_point_warning;    // percentage mp for danger warning
+    int         slow_turn_budget_ms; // write a slow-turn report when a turn
+                                     // exceeds this; 0 disables the watchdog
     bool        clear_messages;   // clear messages each turn
     bool        show_more;        // Show message-full more prompts.
     bool        small_more;       // Show one-char more prompts.
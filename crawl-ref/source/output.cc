@@ -616,6 +616,47 @@ void reset_hud()
     Noise_Bar.reset();
 }
 
+// ----------------------------------------------------------------------
+// HUD field signatures
+//
+// The you.redraw_* flags are coarse: poison, for instance, raises the HP
+// and status light flags every turn whether or not the rendered text
+// changed. Each cacheable field therefore remembers a signature of what
+// it last drew and skips the terminal writes (and the webtiles repaint
+// they trigger) when the signature is unchanged. The noise bar is
+// deliberately excluded: it relies on being redrawn every turn once it
+// has started decaying (see _print_stats_noise).
+// ----------------------------------------------------------------------
+
+enum hud_field
+{
+    HUD_FIELD_HP,
+    HUD_FIELD_MP,
+    HUD_FIELD_WEAPON,
+    HUD_FIELD_QUIVER,
+    HUD_FIELD_LIGHTS,
+    NUM_HUD_FIELDS,
+};
+
+static string _hud_field_sig[NUM_HUD_FIELDS];
+
+// Record the new signature; true if it matched what was last drawn.
+static bool _hud_field_unchanged(hud_field field, const string &sig)
+{
+    if (_hud_field_sig[field] == sig)
+        return true;
+    _hud_field_sig[field] = sig;
+    return false;
+}
+
+// Called whenever the whole stat area is redrawn from scratch; a
+// signature match immediately after that would leave the field blank.
+static void _clear_hud_field_cache()
+{
+    for (int i = 0; i < NUM_HUD_FIELDS; ++i)
+        _hud_field_sig[i].clear();
+}
+
 // ----------------------------------------------------------------------
 // Status display
 // ----------------------------------------------------------------------
@@ -912,6 +953,19 @@ static void _print_stats_mp(int x, int y)
                 mp_colour = entry.second;
     }
 
+    string sig = make_stringf("M%d/%d/%d/%d/%d",
+                              you.magic_points, you.max_magic_points,
+                              mp_colour, (int)boosted,
+                              (int)player_drained());
+#if TAG_MAJOR_VERSION == 34
+    sig += make_stringf("/%d", get_real_mp(false));
+#endif
+    if (_hud_field_unchanged(HUD_FIELD_MP, sig) && !MP_Bar.wants_redraw())
+    {
+        you.redraw_magic_points = false;
+        return;
+    }
+
     textcolour(HUD_CAPTION_COLOUR);
     CPRINTF(player_drained() ? "MP: " : "Magic:  ");
     textcolour(mp_colour);
@@ -975,6 +1029,17 @@ static void _print_stats_hp(int x, int y)
                 hp_colour = entry.second;
     }
 
+    const string sig = make_stringf("H%d/%d/%d/%d/%d/%d/%d",
+                                    you.hp, you.hp_max, max_max_hp,
+                                    hp_colour, (int)boosted,
+                                    (int)player_drained(),
+                                    poison_survival());
+    if (_hud_field_unchanged(HUD_FIELD_HP, sig) && !HP_Bar.wants_redraw())
+    {
+        you.redraw_hit_points = false;
+        return;
+    }
+
     // 01234567890123456789
     // Health: xxx/yyy (zzz)
     CGOTOXY(x, y, GOTO_STAT);
@@ -1205,10 +1270,36 @@ static void _print_stats_wp(int y)
         return;
     }
 
-    CGOTOXY(1, y, GOTO_STAT);
-
     const item_def *weapon = you.weapon();
     const item_def *offhand = you.offhand_weapon();
+
+    // Everything the line renders: slot letters, colours and (possibly
+    // corrosion-adjusted) names, or the unarmed attack for empty hands.
+    string sig = "W";
+    for (const item_def *wpn : { weapon, offhand })
+    {
+        if (wpn)
+        {
+            sig += make_stringf("%c/%d/%s|", wpn->slot,
+                                _wpn_name_colour(*wpn),
+                                _wpn_name_corroded(*wpn).c_str());
+        }
+    }
+    if (!weapon && !offhand)
+    {
+        sig += make_stringf("-/%d/%s",
+                            you.corrosion_amount() ? RED
+                                                   : get_form()->uc_colour,
+                            you.unarmed_attack_name().c_str());
+    }
+    if (_hud_field_unchanged(HUD_FIELD_WEAPON, sig))
+    {
+        you.wield_change = false;
+        return;
+    }
+
+    CGOTOXY(1, y, GOTO_STAT);
+
     if (weapon && offhand)
     {
         _print_weapon_name(*weapon, crawl_view.hudsz.x/2-1);
@@ -1233,6 +1324,11 @@ static void _print_stats_qv(int y)
     }
 
     formatted_string qdesc = quiver::get_secondary_action()->quiver_description();
+    if (_hud_field_unchanged(HUD_FIELD_QUIVER, "Q" + qdesc.to_colour_string()))
+    {
+        you.redraw_quiver = false;
+        return;
+    }
 #ifdef USE_TILE_LOCAL
     const int max_width = crawl_view.hudsz.x - (_is_using_small_layout() ? 0 : 4);
 #else
@@ -1252,11 +1348,11 @@ struct status_light
 
 static void _add_status_light_to_out(int i, vector<status_light>& out)
 {
-    status_info inf;
+    const status_info *inf = cached_status_info(i);
 
-    if (fill_status_info(i, inf) && !inf.light_text.empty())
+    if (inf && !inf->light_text.empty())
     {
-        status_light sl(inf.light_colour, inf.light_text);
+        status_light sl(inf->light_colour, inf->light_text);
         out.push_back(sl);
     }
 }
@@ -1333,6 +1429,16 @@ static void _print_status_lights(int y)
     vector<status_light> lights;
     static int last_number_of_lights = 0;
     _get_status_lights(lights);
+
+    string sig = "L";
+    for (const status_light &light : lights)
+        sig += make_stringf("%d:%s|", light.colour, light.text.c_str());
+    if (_hud_field_unchanged(HUD_FIELD_LIGHTS, sig))
+    {
+        you.redraw_status_lights = false;
+        return;
+    }
+
     if (lights.empty() && last_number_of_lights == 0)
     {
         you.redraw_status_lights = false;
@@ -1557,7 +1663,7 @@ void print_stats()
     if (you.duration[DUR_POISONING])
     {
         you.redraw_hit_points = true;
-        you.redraw_status_lights = true;
+        invalidate_status_cache();
     }
 
     if (you.redraw_title)
@@ -1664,6 +1770,8 @@ void print_stats_level()
 
 void draw_border()
 {
+    _clear_hud_field_cache();
+
     textcolour(HUD_CAPTION_COLOUR);
 
     CGOTOXY(1,1, GOTO_CRT);
@@ -1870,7 +1978,7 @@ static void _print_next_monster_desc(const vector<monster_info>& mons,
         // One glyph for each monster.
         for (unsigned int i_mon = start; i_mon < end; i_mon++)
         {
-            monster_info mi = mons[i_mon];
+            const monster_info &mi = mons[i_mon];
             cglyph_t g = get_mons_glyph(mi);
             textcolour(g.col);
             CPRINTF("%s", stringize_glyph(g.ch).c_str());
@@ -1888,7 +1996,7 @@ static void _print_next_monster_desc(const vector<monster_info>& mons,
         {
             CPRINTF(" ");
 
-            monster_info mi = mons[start];
+            const monster_info &mi = mons[start];
 #ifdef TARGET_OS_WINDOWS
             textcolour(real_colour(dam_colour(mi) | COLFLAG_ITEM_HEAP, mi.pos));
 #else
@@ -1950,7 +2058,10 @@ int update_monster_pane()
     {
         save_cursor_pos save;
 
-        vector<monster_info> mons;
+        // Redrawn every frame; reuse the snapshot storage rather than
+        // reallocating a monster_info vector each time.
+        static vector<monster_info> mons;
+        mons.clear();
         get_monster_info(mons);
 
         // Count how many groups of monsters there are.
@@ -1980,8 +2091,8 @@ int update_monster_pane()
     #endif
 
         // Print the monsters!
-        string blank;
-        blank.resize(crawl_view.mlistsz.x, ' ');
+        static string blank;
+        blank.assign(crawl_view.mlistsz.x, ' ');
         int i_mons = 0;
         for (int i_print = 0; i_print < max_print; ++i_print)
         {
@@ -25,6 +25,7 @@ Notes:
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <sstream>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -38,6 +39,14 @@ Notes:
 #include "errors.h"
 #include "syscalls.h"
 #include "libutil.h" // map_find
+#include "threads.h"
+
+// Deflate chunks on a small worker pool instead of the caller's thread.
+// The Windows side of threads.h implements condition variables with
+// PulseEvent, which can lose wakeups, so compression stays inline there.
+#ifndef TARGET_OS_WINDOWS
+#define SAVE_COMPRESS_POOL
+#endif
 
 // debugging defines
 #undef  FSCK_VERBOSE
@@ -81,16 +90,128 @@ typedef pair<plen_t, plen_t> bm_p;
 typedef map<plen_t, bm_p> bm_t;
 typedef map<plen_t, plen_t> fb_t;
 
+// One chunk handed off for background compression. Workers touch only the
+// job's own buffers; all package state stays on the owning thread.
+struct compress_job
+{
+    string name;
+    vector<unsigned char> raw;
+    vector<unsigned char> comp;
+    bool done;
+};
+
+struct compress_pool
+{
+    mutex_t mutex;
+    cond_t work_cv;             // signalled when a job is queued
+    cond_t done_cv;             // signalled when a job finishes
+    std::deque<compress_job*> todo;
+    vector<compress_job*> jobs; // submission order, for in-order apply
+    vector<thread_t> threads;
+    bool shutdown;
+
+    // Serializes all access to the package's tables and file descriptor
+    // between the owning thread and a background commit. Recursive
+    // (mutex_init), so internal calls may re-lock freely.
+    mutex_t state_mutex;
+    thread_t commit_thread;
+    bool commit_active;
+};
+
+// Scoped lock on a package's state mutex; a no-op when there's no pool
+// (Windows builds, where everything stays on one thread).
+class pkg_lock
+{
+public:
+    pkg_lock(compress_pool *p) : pool(p)
+    {
+        if (pool)
+            mutex_lock(pool->state_mutex);
+    }
+    ~pkg_lock()
+    {
+        if (pool)
+            mutex_unlock(pool->state_mutex);
+    }
+private:
+    compress_pool *pool;
+};
+
+#define NUM_COMPRESS_WORKERS 2
+
+// One-shot deflate of a whole buffer. Deflate output depends only on the
+// input bytes and settings, not on how they were streamed in, so this
+// produces exactly the bytes the old inline path did -- which keeps
+// comparisons against previously written chunks valid.
+static void _deflate_buffer(const vector<unsigned char> &raw,
+                            vector<unsigned char> &comp)
+{
+#ifdef USE_ZLIB
+    z_stream zs;
+    zs.data_type = Z_BINARY;
+    zs.zalloc    = 0;
+    zs.zfree     = 0;
+    zs.opaque    = Z_NULL;
+    if (deflateInit(&zs, Z_DEFAULT_COMPRESSION))
+        fail("save file compression failed during init: %s", zs.msg);
+    zs.next_in  = raw.empty() ? (Bytef*)0 : (Bytef*)&raw[0];
+    zs.avail_in = raw.size();
+    Bytef buf[32768];
+    int res;
+    do
+    {
+        zs.next_out  = buf;
+        zs.avail_out = sizeof(buf);
+        res = deflate(&zs, Z_FINISH);
+        if (res != Z_STREAM_END && res != Z_OK && res != Z_BUF_ERROR)
+            fail("save file compression failed: %s", zs.msg);
+        comp.insert(comp.end(), buf, (unsigned char*)zs.next_out);
+    } while (res != Z_STREAM_END);
+    if (deflateEnd(&zs) != Z_OK)
+        fail("save file compression failed during clean-up: %s", zs.msg);
+#else
+    comp = raw;
+#endif
+}
+
+#ifdef SAVE_COMPRESS_POOL
+static void *_compress_worker(void *arg)
+{
+    compress_pool *pool = static_cast<compress_pool*>(arg);
+    mutex_lock(pool->mutex);
+    while (true)
+    {
+        while (pool->todo.empty() && !pool->shutdown)
+            cond_wait(pool->work_cv, pool->mutex);
+        if (pool->todo.empty())
+            break;
+        compress_job *job = pool->todo.front();
+        pool->todo.pop_front();
+        mutex_unlock(pool->mutex);
+
+        _deflate_buffer(job->raw, job->comp);
+
+        mutex_lock(pool->mutex);
+        job->done = true;
+        cond_wake(pool->done_cv);
+    }
+    mutex_unlock(pool->mutex);
+    return nullptr;
+}
+#endif
+
 package::package(const char* file, bool writeable, bool empty)
-  : n_users(0), dirty(false), aborted(false)
+  : n_users(0), dirty(false), aborted(false),
 #ifdef DO_FSYNC
-    , tmp(false)
+    tmp(false),
 #endif
+    pool(nullptr)
 {
     dprintf("package: initializing file=\"%s\" rw=%d\n", file, writeable);
     ASSERT(writeable || !empty);
     filename = file;
     rw = writeable;
+    init_pool();
 
     if (empty)
     {
@@ -132,13 +253,15 @@ package::package(const char* file, bool writeable, bool empty)
 }
 
 package::package()
-  : rw(true), n_users(0), dirty(false), aborted(false)
+  : rw(true), n_users(0), dirty(false), aborted(false),
 #ifdef DO_FSYNC
-    , tmp(true)
+    tmp(true),
 #endif
+    pool(nullptr)
 {
     dprintf("package: initializing tmp file\n");
     filename = "[tmp]";
+    init_pool();
 
     char file[7] = "XXXXXX";
     fd = mkstemp(file);
@@ -208,6 +331,7 @@ void package::load_traces()
 package::~package()
 {
     dprintf("package: finalizing\n");
+    join_commit();
     ASSERT(!n_users || CrawlIsCrashing); // not merely aborted, there are
         // live pointers to us. With normal stack unwinding, destructors
         // will make sure this never happens and this assert is good for
@@ -220,6 +344,7 @@ package::~package()
         if (ftruncate(fd, file_len))
             sysfail("failed to update save file");
     }
+    stop_pool();
 
     // all errors here should be cached write errors
     if (fd != -1)
@@ -234,6 +359,8 @@ package::~package()
 void package::commit()
 {
     ASSERT(rw);
+    pkg_lock lock(pool);
+    flush_chunks();
     if (!dirty)
         return;
     ASSERT(!aborted);
@@ -286,6 +413,8 @@ chunk_writer* package::writer(const string &name)
 
 chunk_reader* package::reader(const string &name)
 {
+    pkg_lock lock(pool);
+    flush_chunks();
     if (plen_t *ch = map_find(directory, name))
         return new chunk_reader(this, *ch);
     return 0;
@@ -384,10 +513,151 @@ void package::free_chunk(const string &name)
 
 void package::delete_chunk(const string &name)
 {
+    pkg_lock lock(pool);
+    flush_chunks();
     free_chunk(name);
     directory.erase(name);
 }
 
+void package::init_pool()
+{
+#ifdef SAVE_COMPRESS_POOL
+    pool = new compress_pool;
+    mutex_init(pool->mutex);
+    cond_init(pool->work_cv);
+    cond_init(pool->done_cv);
+    mutex_init(pool->state_mutex);
+    pool->shutdown = false;
+    pool->commit_active = false;
+#endif
+}
+
+// Hand a chunk's raw bytes to the worker pool, starting it on first use.
+// If no workers can be started, compress and write on the spot.
+void package::submit_chunk(const string &name, vector<unsigned char> &&raw)
+{
+#ifdef SAVE_COMPRESS_POOL
+    pkg_lock lock(pool);
+    if (pool->threads.empty() && !pool->shutdown)
+    {
+        for (int i = 0; i < NUM_COMPRESS_WORKERS; i++)
+        {
+            thread_t th;
+            if (!thread_create_joinable(&th, _compress_worker, pool))
+                pool->threads.push_back(th);
+        }
+    }
+    if (!pool->threads.empty())
+    {
+        compress_job *job = new compress_job;
+        job->name = name;
+        job->raw = std::move(raw);
+        job->done = false;
+        mutex_lock(pool->mutex);
+        pool->jobs.push_back(job);
+        pool->todo.push_back(job);
+        cond_wake(pool->work_cv);
+        mutex_unlock(pool->mutex);
+        return;
+    }
+#endif
+    vector<unsigned char> comp;
+    _deflate_buffer(raw, comp);
+    write_chunk_bytes(name, comp);
+}
+
+// Apply all outstanding background jobs, in submission order, on the
+// caller's thread. Every entry point that observes the directory or the
+// block tables goes through here first, so the rest of the package never
+// sees a half-applied state, and commit()'s fsync ordering is untouched.
+void package::flush_chunks()
+{
+#ifdef SAVE_COMPRESS_POOL
+    if (!pool)
+        return;
+    pkg_lock lock(pool);
+    if (pool->jobs.empty())
+        return;
+
+    mutex_lock(pool->mutex);
+    for (compress_job *job : pool->jobs)
+    {
+        while (!job->done)
+            cond_wait(pool->done_cv, pool->mutex);
+        mutex_unlock(pool->mutex);
+        if (!aborted)
+            write_chunk_bytes(job->name, job->comp);
+        delete job;
+        mutex_lock(pool->mutex);
+    }
+    pool->jobs.clear();
+    mutex_unlock(pool->mutex);
+#endif
+}
+
+void package::stop_pool()
+{
+#ifdef SAVE_COMPRESS_POOL
+    if (!pool)
+        return;
+
+    // Anything still queued here belongs to an aborted save; it gets
+    // compressed by the exiting workers and thrown away unwritten.
+    mutex_lock(pool->mutex);
+    pool->shutdown = true;
+    for (size_t i = 0; i < pool->threads.size(); i++)
+        cond_wake(pool->work_cv);
+    mutex_unlock(pool->mutex);
+    for (thread_t &th : pool->threads)
+        thread_join(th);
+    for (compress_job *job : pool->jobs)
+        delete job;
+    mutex_destroy(pool->mutex);
+    mutex_destroy(pool->state_mutex);
+    cond_destroy(pool->work_cv);
+    cond_destroy(pool->done_cv);
+    delete pool;
+    pool = nullptr;
+#endif
+}
+
+void package::commit_async()
+{
+    ASSERT(rw);
+#ifdef SAVE_COMPRESS_POOL
+    join_commit();
+    if (!thread_create_joinable(&pool->commit_thread, commit_thread_fn, this))
+    {
+        pool->commit_active = true;
+        return;
+    }
+#endif
+    commit();
+}
+
+void package::join_commit()
+{
+#ifdef SAVE_COMPRESS_POOL
+    if (pool && pool->commit_active)
+    {
+        thread_join(pool->commit_thread);
+        pool->commit_active = false;
+    }
+#endif
+}
+
+void *package::commit_thread_fn(void *arg)
+{
+    package *pkg = static_cast<package*>(arg);
+    pkg_lock lock(pkg->pool);
+    // The owning thread may have aborted the save while this thread was
+    // waiting for the state mutex; everything since the last commit is
+    // dropped in that case.
+    if (!pkg->aborted)
+        pkg->commit();
+    return nullptr;
+}
+
 plen_t package::write_directory()
 {
     delete_chunk("");
@@ -564,11 +834,15 @@ void package::read_directory(plen_t start, uint8_t version)
 
 bool package::has_chunk(const string &name)
 {
+    pkg_lock lock(pool);
+    flush_chunks();
     return !name.empty() && directory.count(name);
 }
 
 vector<string> package::list_chunks()
 {
+    pkg_lock lock(pool);
+    flush_chunks();
     vector<string> list;
     list.reserve(directory.size());
     for (const auto &entry : directory)
@@ -616,6 +890,7 @@ void package::trace_chunk(plen_t start)
 
 void package::abort()
 {
+    pkg_lock lock(pool);
     // Disable any further operations, allow a shutdown. All errors past
     // this point are ignored (assuming we already failed). All writes since
     // the last commit() are lost.
@@ -633,6 +908,8 @@ void package::unlink()
 // the amount of free space not at the end of file
 plen_t package::get_slack()
 {
+    pkg_lock lock(pool);
+    flush_chunks();
     load_traces();
 
     plen_t slack = 0;
@@ -643,6 +920,8 @@ plen_t package::get_slack()
 
 plen_t package::get_chunk_fragmentation(const string &name)
 {
+    pkg_lock lock(pool);
+    flush_chunks();
     load_traces();
     ASSERT(directory.count(name)); // not has_chunk(), "" is valid
     plen_t frags = 0;
@@ -659,6 +938,8 @@ plen_t package::get_chunk_fragmentation(const string &name)
 
 plen_t package::get_chunk_compressed_length(const string &name)
 {
+    pkg_lock lock(pool);
+    flush_chunks();
     load_traces();
     ASSERT(directory.count(name)); // not has_chunk(), "" is valid
     plen_t len = 0;
@@ -673,8 +954,97 @@ plen_t package::get_chunk_compressed_length(const string &name)
     return len;
 }
 
+// Compares accumulated chunk contents against the chunk of the same name
+// already present in the save, if any. Compressed bytes are compared:
+// deflate is deterministic, so identical input produces identical streams.
+bool package::chunk_matches(const string &name, const vector<unsigned char> &data)
+{
+    auto ci = directory.find(name);
+    if (ci == directory.end() || !ci->second || data.empty())
+        return false;
+
+    chunk_reader rd(this, ci->second);
+    unsigned char buf[32768];
+    plen_t checked = 0;
+    while (checked < data.size())
+    {
+        plen_t want = data.size() - checked;
+        if (want > sizeof(buf))
+            want = sizeof(buf);
+        if (rd.raw_read(buf, want) != want)
+            return false;
+        if (memcmp(buf, &data[checked], want))
+            return false;
+        checked += want;
+    }
+    // identical so far; the old chunk must not have trailing data
+    return !rd.raw_read(buf, 1);
+}
+
+// Writes a chunk's complete compressed byte stream as a block chain and
+// links it into the directory -- unless the same bytes are already in the
+// save, in which case the committed chain is left alone and nothing is
+// written: frequent full saves rewrite plenty of chunks (stashes, kills,
+// travel cache, ...) that haven't changed since the last save.
+void package::write_chunk_bytes(const string &name,
+                                const vector<unsigned char> &data)
+{
+    ASSERT(!aborted);
+
+    if (chunk_matches(name, data))
+    {
+        dprintf("chunk(%s): unchanged, skipping\n", name.c_str());
+        return;
+    }
+
+    // Plan the whole block chain first, then put down each block -- header
+    // and payload together -- with a single vectored write. Writing as we
+    // allocate would cost two seeks and two write calls per block, and the
+    // header would have to be revisited once the block's length is known.
+    struct chain_link
+    {
+        plen_t at;
+        plen_t len;
+    };
+    vector<chain_link> chain;
+    plen_t cur_block = 0, block_len = 0;
+    plen_t len = data.size();
+    while (len > 0)
+    {
+        plen_t space = extend_block(cur_block, block_len, len);
+        if (!space)
+        {
+            cur_block = alloc_block(space = len);
+            ASSERT(space > 0);
+            block_len = 0;
+            chain.push_back(chain_link());
+            chain.back().at = cur_block;
+        }
+        block_len += space;
+        chain.back().len = block_len;
+        len -= space;
+    }
+
+    const unsigned char *p = data.empty() ? nullptr : &data[0];
+    for (size_t i = 0; i < chain.size(); i++)
+    {
+        const plen_t next = i + 1 < chain.size() ? chain[i + 1].at : 0;
+        block_header head;
+        head.len = htole(chain[i].len);
+        head.next = htole(next);
+
+        if (chain[i].at + sizeof(block_header) + chain[i].len > file_len)
+            corrupted("save file corrupted -- invalid offset");
+        if (!write_2v(fd, chain[i].at, &head, sizeof(head), p, chain[i].len))
+            sysfail("write error while saving");
+        block_map[chain[i].at] = bm_p(chain[i].len, next);
+        p += chain[i].len;
+    }
+
+    finish_chunk(name, chain.empty() ? 0 : chain[0].at);
+}
+
 chunk_writer::chunk_writer(package *parent, const string &_name)
-    : first_block(0), cur_block(0), block_len(0)
 {
     ASSERT(parent);
     ASSERT(!parent->aborted);
@@ -685,19 +1055,33 @@ chunk_writer::chunk_writer(package *parent, const string &_name)
 
     dprintf("chunk_writer(%s): starting\n", _name.c_str());
     pkg = parent;
+    pkg_lock lock(pkg->pool);
     pkg->n_users++;
     name = _name;
 
+    // Regular chunks collect raw bytes and get deflated on the worker
+    // pool; the directory chunk is written inside commit() and has to
+    // complete synchronously.
+#ifdef SAVE_COMPRESS_POOL
+    deferred = !_name.empty();
+#else
+    deferred = false;
+#endif
+
 #ifdef USE_ZLIB
-    zs.data_type = Z_BINARY;
-    zs.zalloc    = 0;
-    zs.zfree     = 0;
-    zs.opaque    = Z_NULL;
-    if (deflateInit(&zs, Z_DEFAULT_COMPRESSION))
-        fail("save file compression failed during init: %s", zs.msg);
 #define ZB_SIZE 32768
-    zs.next_out  = z_buffer = (Bytef*)malloc(ZB_SIZE);
-    zs.avail_out = ZB_SIZE;
+    z_buffer = nullptr;
+    if (!deferred)
+    {
+        zs.data_type = Z_BINARY;
+        zs.zalloc    = 0;
+        zs.zfree     = 0;
+        zs.opaque    = Z_NULL;
+        if (deflateInit(&zs, Z_DEFAULT_COMPRESSION))
+            fail("save file compression failed during init: %s", zs.msg);
+        zs.next_out  = z_buffer = (Bytef*)malloc(ZB_SIZE);
+        zs.avail_out = ZB_SIZE;
+    }
 #endif
 }
 
@@ -705,18 +1089,28 @@ chunk_writer::~chunk_writer()
 {
     dprintf("chunk_writer(%s): closing\n", name.c_str());
 
+    pkg_lock lock(pkg->pool);
     ASSERT(pkg->n_users > 0);
     pkg->n_users--;
     if (pkg->aborted)
     {
 #ifdef USE_ZLIB
-        // ignore errors, they're not relevant anymore
-        deflateEnd(&zs);
-        free(z_buffer);
+        if (!deferred)
+        {
+            // ignore errors, they're not relevant anymore
+            deflateEnd(&zs);
+            free(z_buffer);
+        }
 #endif
         return;
     }
 
+    if (deferred)
+    {
+        pkg->submit_chunk(name, std::move(comp_buf));
+        return;
+    }
+
 #ifdef USE_ZLIB
     zs.avail_in = 0;
     int res;
@@ -725,7 +1119,7 @@ chunk_writer::~chunk_writer()
         res = deflate(&zs, Z_FINISH);
         if (res != Z_STREAM_END && res != Z_OK && res != Z_BUF_ERROR)
             fail("save file compression failed: %s", zs.msg);
-        raw_write(z_buffer, zs.next_out - z_buffer);
+        comp_buf.insert(comp_buf.end(), z_buffer, (unsigned char*)zs.next_out);
         zs.next_out = z_buffer;
         zs.avail_out = ZB_SIZE;
     } while (res != Z_STREAM_END);
@@ -733,48 +1127,7 @@ chunk_writer::~chunk_writer()
         fail("save file compression failed during clean-up: %s", zs.msg);
     free(z_buffer);
 #endif
-    if (cur_block)
-        finish_block(0);
-    pkg->finish_chunk(name, first_block);
-}
-
-void chunk_writer::raw_write(const void *data, plen_t len)
-{
-    while (len > 0)
-    {
-        plen_t space = pkg->extend_block(cur_block, block_len, len);
-        if (!space)
-        {
-            plen_t next_block = pkg->alloc_block(space = len);
-            ASSERT(space > 0);
-            if (cur_block)
-                finish_block(next_block);
-            cur_block = next_block;
-            if (!first_block)
-                first_block = next_block;
-            block_len = 0;
-        }
-
-        pkg->seek(cur_block + block_len + sizeof(block_header));
-        if (::write(pkg->fd, data, space) != (ssize_t)space)
-            sysfail("write error while saving");
-        data = (char*)data + space;
-        block_len += space;
-        len -= space;
-    }
-}
-
-void chunk_writer::finish_block(plen_t next)
-{
-    block_header head;
-    head.len = htole(block_len);
-    head.next = htole(next);
-
-    pkg->seek(cur_block);
-    if (::write(pkg->fd, &head, sizeof(head)) != sizeof(head))
-        sysfail("write error while saving");
-
-    pkg->block_map[cur_block] = bm_p(block_len, next);
+    pkg->write_chunk_bytes(name, comp_buf);
 }
 
 void chunk_writer::write(const void *data, plen_t len)
@@ -782,6 +1135,13 @@ void chunk_writer::write(const void *data, plen_t len)
     ASSERT(data);
     ASSERT(!pkg->aborted);
 
+    const unsigned char *cdata = static_cast<const unsigned char*>(data);
+    if (deferred)
+    {
+        comp_buf.insert(comp_buf.end(), cdata, cdata + len);
+        return;
+    }
+
 #ifdef USE_ZLIB
     zs.next_in  = (Bytef*)data;
     zs.avail_in = len;
@@ -789,7 +1149,8 @@ void chunk_writer::write(const void *data, plen_t len)
     {
         if (!zs.avail_out)
         {
-            raw_write(z_buffer, zs.next_out - z_buffer);
+            comp_buf.insert(comp_buf.end(), z_buffer,
+                            (unsigned char*)zs.next_out);
             zs.next_out  = z_buffer;
             zs.avail_out = ZB_SIZE;
         }
@@ -798,13 +1159,14 @@ void chunk_writer::write(const void *data, plen_t len)
             fail("save file compression failed: %s", zs.msg);
     }
 #else
-    raw_write(data, len);
+    comp_buf.insert(comp_buf.end(), cdata, cdata + len);
 #endif
 }
 
 void chunk_reader::init(plen_t start)
 {
     ASSERT(!pkg->aborted);
+    pkg_lock lock(pkg->pool);
     pkg->n_users++;
     pkg->reader_count[start]++;
     first_block = next_block = start;
@@ -851,6 +1213,7 @@ chunk_reader::~chunk_reader()
     if (inflateEnd(&zs) != Z_OK)
         fail("save file decompression failed during clean-up: %s", zs.msg);
 #endif
+    pkg_lock lock(pkg->pool);
     ASSERT(pkg->reader_count[first_block] > 0);
     if (!--pkg->reader_count[first_block])
         pkg->reader_count.erase(first_block);
@@ -860,6 +1223,9 @@ chunk_reader::~chunk_reader()
 
 plen_t chunk_reader::raw_read(void *data, plen_t len)
 {
+    // Seek/read pairs on the shared descriptor must not interleave with a
+    // background commit's writes.
+    pkg_lock lock(pkg->pool);
     void *buf = data;
     while (len)
     {
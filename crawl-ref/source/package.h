@@ -26,21 +26,22 @@ using std::vector;
 typedef uint32_t plen_t;
 
 class package;
+struct compress_pool;
 
 class chunk_writer
 {
 private:
     package *pkg;
     string name;
-    plen_t first_block;
-    plen_t cur_block;
-    plen_t block_len;
+    // Deferred writers don't compress at all: the raw bytes are handed to
+    // the package's worker pool on destruction and deflated off-thread.
+    bool deferred;
 #ifdef USE_ZLIB
     z_stream zs;
     Bytef *z_buffer;
 #endif
-    void raw_write(const void *data, plen_t len);
-    void finish_block(plen_t next);
+    // The chunk's complete byte stream: raw if deferred, compressed if not.
+    vector<unsigned char> comp_buf;
 public:
     chunk_writer(package *parent, const string &_name);
     ~chunk_writer();
@@ -68,6 +69,7 @@ public:
     plen_t read(void *data, plen_t len);
     void read_all(vector<char> &data);
     friend class package;
+    friend class chunk_writer; // raw access, to compare against new contents
 };
 
 class package
@@ -79,6 +81,9 @@ public:
     chunk_writer* writer(const string &name);
     chunk_reader* reader(const string &name);
     void commit();
+    // As commit(), but performed on a background thread where supported;
+    // for checkpoint saves that shouldn't block the player.
+    void commit_async();
     void delete_chunk(const string &name);
     bool has_chunk(const string &name);
     vector<string> list_chunks();
@@ -108,8 +113,18 @@ private:
     map<plen_t, pair<plen_t, plen_t> > block_map;
     set<plen_t> new_chunks;
     map<plen_t, uint32_t> reader_count;
+    compress_pool *pool;
+    void init_pool();
+    void join_commit();
+    static void *commit_thread_fn(void *arg);
     plen_t extend_block(plen_t at, plen_t size, plen_t by);
     plen_t alloc_block(plen_t &size);
+    void submit_chunk(const string &name, vector<unsigned char> &&raw);
+    void flush_chunks();
+    void stop_pool();
+    bool chunk_matches(const string &name, const vector<unsigned char> &data);
+    void write_chunk_bytes(const string &name,
+                           const vector<unsigned char> &data);
     void finish_chunk(const string &name, plen_t at);
     void free_chunk(const string &name);
     plen_t write_directory();
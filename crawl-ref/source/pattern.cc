@@ -13,6 +13,8 @@
     #include <regex.h>
 #endif
 
+#include <cctype>
+
 #include "pattern.h"
 #include "stringutil.h"
 
@@ -32,12 +34,6 @@ static void *_compile_pattern(const char *pattern, bool icase)
                         nullptr);
 }
 
-static void _free_compiled_pattern(void *cp)
-{
-    if (cp)
-        pcre_free(cp);
-}
-
 static bool _pattern_match(void *compiled_pattern, const char *text, int length)
 {
     int ovector[42];
@@ -86,16 +82,6 @@ static void *_compile_pattern(const char *pattern, bool icase)
     return re;
 }
 
-static void _free_compiled_pattern(void *cp)
-{
-    if (cp)
-    {
-        regex_t *re = static_cast<regex_t *>(cp);
-        regfree(re);
-        delete re;
-    }
-}
-
 static bool _pattern_match(void *compiled_pattern, const char *text, int length)
 {
     UNUSED(length);
@@ -118,6 +104,82 @@ static pattern_match _pattern_match_location(void *compiled_pattern,
 ////////////////////////////////////////////////////////////////////
 #endif
 
+////////////////////////////////////////////////////////////////////
+// Compiled pattern cache
+//
+// text_pattern objects out of rc option lists are copied and recreated
+// freely, and copies used to recompile their regex on first use. Compiled
+// patterns now live in a session-wide cache keyed by pattern text and
+// case flag; instances hold a pointer into the cache, so each distinct
+// pattern is compiled (or rejected) exactly once per session. Patterns
+// without regex metacharacters skip compilation entirely and match with a
+// plain substring scan, which is byte-wise caseless exactly like the
+// regex engines are used here (no UTF-8 matching flags).
+
+struct cached_pattern
+{
+    void *compiled;  // engine automaton; nullptr for literals and failures
+    bool literal;
+    string needle;   // the literal text, pre-lowercased if caseless
+    bool valid;
+};
+
+static map<pair<string, bool>, cached_pattern> _pattern_cache;
+
+static bool _pattern_is_literal(const string &pattern)
+{
+    return pattern.find_first_of("\\^$.[]()*+?{}|") == string::npos;
+}
+
+static const cached_pattern *_get_cached_pattern(const string &pattern,
+                                                 bool icase)
+{
+    const auto key = make_pair(pattern, icase);
+    auto it = _pattern_cache.find(key);
+    if (it != _pattern_cache.end())
+        return &it->second;
+
+    cached_pattern &cp = _pattern_cache[key];
+    if (_pattern_is_literal(pattern))
+    {
+        cp.compiled = nullptr;
+        cp.literal = true;
+        cp.needle = icase ? lowercase_string(pattern) : pattern;
+        cp.valid = true;
+    }
+    else
+    {
+        cp.compiled = _compile_pattern(pattern.c_str(), icase);
+        cp.literal = false;
+        cp.valid = cp.compiled != nullptr;
+    }
+    return &cp;
+}
+
+// Byte-wise (caseless) substring scan; returns the match offset or -1.
+static int _literal_find(const char *text, int length,
+                         const string &needle, bool icase)
+{
+    const int nlen = needle.length();
+    if (!nlen)
+        return 0;
+    for (int i = 0; i + nlen <= length; i++)
+    {
+        int j = 0;
+        while (j < nlen)
+        {
+            const char c = icase ? (char)tolower((unsigned char)text[i + j])
+                                 : text[i + j];
+            if (c != needle[j])
+                break;
+            j++;
+        }
+        if (j == nlen)
+            return i;
+    }
+    return -1;
+}
+
 string pattern_match::annotate_string(const string &color) const
 {
     string ret(text);
@@ -133,8 +195,7 @@ string pattern_match::annotate_string(const string &color) const
 
 text_pattern::~text_pattern()
 {
-    if (compiled_pattern)
-        _free_compiled_pattern(compiled_pattern);
+    // The compiled pattern belongs to the session-wide cache.
 }
 
 const text_pattern &text_pattern::operator= (const text_pattern &tp)
@@ -142,8 +203,6 @@ const text_pattern &text_pattern::operator= (const text_pattern &tp)
     if (this == &tp)
         return tp;
 
-    if (compiled_pattern)
-        _free_compiled_pattern(compiled_pattern);
     pattern = tp.pattern;
     compiled_pattern = nullptr;
     isvalid      = tp.isvalid;
@@ -156,8 +215,6 @@ const text_pattern &text_pattern::operator= (const string &spattern)
     if (pattern == spattern)
         return *this;
 
-    if (compiled_pattern)
-        _free_compiled_pattern(compiled_pattern);
     pattern = spattern;
     compiled_pattern = nullptr;
     isvalid = true;
@@ -175,22 +232,44 @@ bool text_pattern::operator== (const text_pattern &tp) const
 
 bool text_pattern::compile() const
 {
-    return !empty()?
-        !!(compiled_pattern = _compile_pattern(pattern.c_str(), ignore_case))
-      : false;
+    if (empty())
+        return false;
+
+    const cached_pattern *cp = _get_cached_pattern(pattern, ignore_case);
+    compiled_pattern = const_cast<void *>(static_cast<const void *>(cp));
+    return cp->valid;
 }
 
 bool text_pattern::matches(const char *s, int length) const
 {
-    return valid() && _pattern_match(compiled_pattern, s, length);
+    if (!valid())
+        return false;
+
+    const cached_pattern *cp =
+        static_cast<const cached_pattern *>(compiled_pattern);
+    if (cp->literal)
+        return _literal_find(s, length, cp->needle, ignore_case) >= 0;
+    return _pattern_match(cp->compiled, s, length);
 }
 
 pattern_match text_pattern::match_location(const char *s, int length) const
 {
-    if (valid())
-        return _pattern_match_location(compiled_pattern, s, length);
-    else
+    if (!valid())
         return pattern_match::failed(string(s));
+
+    const cached_pattern *cp =
+        static_cast<const cached_pattern *>(compiled_pattern);
+    if (cp->literal)
+    {
+        const int pos = _literal_find(s, length, cp->needle, ignore_case);
+        if (pos >= 0)
+        {
+            return pattern_match::succeeded(string(s), pos,
+                                            pos + cp->needle.length());
+        }
+        return pattern_match::failed(string(s));
+    }
+    return _pattern_match_location(cp->compiled, s, length);
 }
 
 const plaintext_pattern &plaintext_pattern::operator= (const string &spattern)
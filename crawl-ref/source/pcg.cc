@@ -21,6 +21,11 @@
  *    https://github.com/imneme/bounded-rands/blob/master/bounded32.cpp
  * Original source is Copyright (c) 2018 Melissa E. O'Neill
  * Licensed under The MIT License
+ *
+ * The draw functions themselves (get_uint32, get_uint64,
+ * get_bounded_uint32) are defined inline in pcg.h so they can inline
+ * into random.cc's entry points; this file keeps construction and
+ * marshalling.
  */
 
 #include "AppHdr.h"
@@ -29,70 +34,6 @@
 
 namespace rng
 {
-    /**
-     * Generate a uniformly distributed 32-bit random number.
-     */
-    uint32_t PcgRNG::get_uint32()
-    {
-        count_++;
-        uint64_t oldstate = state_;
-        // Advance internal state. Use the 'official' multiplier. Don't change
-        // this without carefully consulting official sources, as not all
-        // multipliers are ok: see
-        // http://www.pcg-random.org/posts/critiquing-pcg-streams.html
-        state_ = oldstate * static_cast<uint64_t>(6364136223846793005ULL)
-                                                                + (inc_|1);
-        // Calculate output function (XSH RR), uses old state for max ILP
-        uint32_t xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
-        uint32_t rot = oldstate >> 59u;
-        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
-    }
-
-    uint64_t
-    PcgRNG::get_uint64()
-    {
-        return static_cast<uint64_t>(get_uint32()) << 32 | get_uint32();
-    }
-
-    /**
-     * Generate a uniformly distributed number, r, where 0 <= r < range.
-     * This uses a technique due to Daniel Lemire, with implementation and
-     * additional tweaks from Melissa O'Neil. It's designed to avoid /,% for
-     * small values of `range`.
-     *
-     * See:
-     *  http://www.pcg-random.org/posts/bounded-rands.html
-     *  https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
-     *  https://arxiv.org/abs/1805.10941 or https://dl.acm.org/citation.cfm?id=3230636
-     */
-    uint32_t PcgRNG::get_bounded_uint32(uint32_t range)
-    {
-        uint32_t x = get_uint32();
-        uint64_t m = uint64_t(x) * uint64_t(range);
-        uint32_t l = uint32_t(m);
-        if (l < range)
-        {
-            // TODO: will this generate warnings somewhere? the PCG c++
-            // implementation has a different version of this step that may be
-            // useful.
-            uint32_t t = -range;
-
-            if (t >= range)
-            {
-                t -= range;
-                if (t >= range)
-                    t %= range;
-            }
-            while (l < t)
-            {
-                x = get_uint32();
-                m = uint64_t(x) * uint64_t(range);
-                l = uint32_t(m);
-            }
-        }
-        return m >> 32;
-    }
-
     // Initialization values only.
     // don't generate unseeded versions of this. But if you must, go get the
     // constants from the official PCG implementation...
@@ -140,4 +81,73 @@ namespace rng
         store.push_back(static_cast<int64_t>(inc_));
         return store;
     }
+
+    /**
+     * Fill a buffer with `n` uniformly distributed 32-bit outputs.
+     *
+     * Produces exactly the sequence that `n` calls to get_uint32() would,
+     * and leaves the generator in the same state, so callers can mix batch
+     * and single draws freely without affecting determinism. The LCG
+     * advance is a serial multiply chain, so the batch is computed in four
+     * interleaved lanes - each lane steps by the fourth power of the
+     * multiplier - letting the multiplies and the output permutations of
+     * neighbouring draws overlap in the pipeline.
+     */
+    void PcgRNG::fill_uint32(uint32_t *out, size_t n)
+    {
+        static const uint64_t mult = 6364136223846793005ULL;
+        const uint64_t inc = inc_ | 1;
+        const uint64_t mult4 = mult * mult * mult * mult;
+        const uint64_t inc4 = (mult * mult * mult + mult * mult + mult + 1)
+                              * inc;
+
+        uint64_t s[4];
+        s[0] = state_;
+        s[1] = s[0] * mult + inc;
+        s[2] = s[1] * mult + inc;
+        s[3] = s[2] * mult + inc;
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            for (int lane = 0; lane < 4; lane++)
+            {
+                const uint64_t oldstate = s[lane];
+                s[lane] = oldstate * mult4 + inc4;
+                const uint32_t xorshifted =
+                    ((oldstate >> 18u) ^ oldstate) >> 27u;
+                const uint32_t rot = oldstate >> 59u;
+                out[i + lane] = (xorshifted >> rot)
+                                | (xorshifted << ((-rot) & 31));
+            }
+        }
+
+        // Lane 0 holds the state after every batch of four draws.
+        state_ = s[0];
+        count_ += i;
+
+        for (; i < n; i++)
+            out[i] = get_uint32();
+    }
+
+    /**
+     * Derive a deterministic child generator from this one.
+     *
+     * The child is seeded from the parent's current state and the caller's
+     * stream id, and runs on its own sequence increment, so its outputs are
+     * fully determined by (parent seed, parent draw count, stream_id);
+     * distinct ids give independent-looking streams and drawing from a
+     * child never advances the parent. This is the splitting discipline for
+     * running work in parallel without perturbing the main game RNG: derive
+     * one substream per work unit at a well-defined point, then let each
+     * unit draw only from its own substream.
+     */
+    PcgRNG PcgRNG::substream(uint64_t stream_id) const
+    {
+        // The seeding constructor truncates the top bit of the sequence;
+        // folding the id into the seed as well keeps children distinct
+        // even for ids that collide through that truncation.
+        return PcgRNG(state_ ^ (stream_id * 0x9E3779B97F4A7C15ULL),
+                      stream_id);
+    }
 }
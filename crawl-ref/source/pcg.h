@@ -1,4 +1,8 @@
 #pragma once
+
+#include <cstddef>
+#include <cstdint>
+
 class CrawlVector;
 
 namespace rng
@@ -11,9 +15,14 @@ namespace rng
         PcgRNG(uint64_t init_state);
         PcgRNG(const CrawlVector &v);
         CrawlVector to_vector();
+        // The draw functions are defined inline below: random-heavy code
+        // (attack resolution, monster energy rolls) makes enough calls per
+        // turn that the cross-TU call chain itself shows up in profiles.
         uint32_t get_uint32();
         uint32_t get_bounded_uint32(uint32_t bound);
         uint64_t get_uint64();
+        void fill_uint32(uint32_t *out, size_t n);
+        PcgRNG substream(uint64_t stream_id) const;
         uint32_t operator()() { return get_uint32(); }
         uint32_t operator()(uint32_t bound) { return get_bounded_uint32(bound); }
 
@@ -30,4 +39,67 @@ namespace rng
         uint64_t inc_;
         uint64_t count_;
     };
+
+    /**
+     * Generate a uniformly distributed 32-bit random number.
+     */
+    inline uint32_t PcgRNG::get_uint32()
+    {
+        count_++;
+        uint64_t oldstate = state_;
+        // Advance internal state. Use the 'official' multiplier. Don't change
+        // this without carefully consulting official sources, as not all
+        // multipliers are ok: see
+        // http://www.pcg-random.org/posts/critiquing-pcg-streams.html
+        state_ = oldstate * static_cast<uint64_t>(6364136223846793005ULL)
+                                                                + (inc_|1);
+        // Calculate output function (XSH RR), uses old state for max ILP
+        uint32_t xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
+        uint32_t rot = oldstate >> 59u;
+        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    }
+
+    inline uint64_t PcgRNG::get_uint64()
+    {
+        return static_cast<uint64_t>(get_uint32()) << 32 | get_uint32();
+    }
+
+    /**
+     * Generate a uniformly distributed number, r, where 0 <= r < range.
+     * This uses a technique due to Daniel Lemire, with implementation and
+     * additional tweaks from Melissa O'Neil. It's designed to avoid /,% for
+     * small values of `range`.
+     *
+     * See:
+     *  http://www.pcg-random.org/posts/bounded-rands.html
+     *  https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
+     *  https://arxiv.org/abs/1805.10941 or https://dl.acm.org/citation.cfm?id=3230636
+     */
+    inline uint32_t PcgRNG::get_bounded_uint32(uint32_t range)
+    {
+        uint32_t x = get_uint32();
+        uint64_t m = uint64_t(x) * uint64_t(range);
+        uint32_t l = uint32_t(m);
+        if (l < range)
+        {
+            // TODO: will this generate warnings somewhere? the PCG c++
+            // implementation has a different version of this step that may be
+            // useful.
+            uint32_t t = -range;
+
+            if (t >= range)
+            {
+                t -= range;
+                if (t >= range)
+                    t %= range;
+            }
+            while (l < t)
+            {
+                x = get_uint32();
+                m = uint64_t(x) * uint64_t(range);
+                l = uint32_t(m);
+            }
+        }
+        return m >> 32;
+    }
 }
@@ -332,6 +332,11 @@ player_equip_set::player_equip_set()
     artprop_cache.init(0);
     armour_egos.init(0);
     gizmo_egos.init(false);
+    weapon_brands.init(0);
+    armour_counts.init(0);
+    jewellery_counts.init(0);
+    jewellery_plus.init(0);
+    staff_counts.init(0);
     do_unrand_reacts = 0;
     do_unrand_death_effects = 0;
 }
@@ -342,6 +347,8 @@ int player_equip_set::wearing_ego(object_class_type obj_type, int ego) const
         return armour_egos[ego];
     else if (obj_type == OBJ_GIZMOS)
         return gizmo_egos[ego];
+    else if (obj_type == OBJ_WEAPONS)
+        return weapon_brands[ego];
 
     int total = 0;
     for (const player_equip_entry& entry : items)
@@ -372,6 +379,29 @@ int player_equip_set::wearing_ego(object_class_type obj_type, int ego) const
 int player_equip_set::wearing(object_class_type obj_type, int sub_type,
                               bool count_plus, bool check_attunement) const
 {
+    if (!check_attunement)
+    {
+        switch (obj_type)
+        {
+            case OBJ_ARMOUR:
+                if (!count_plus)
+                    return armour_counts[sub_type];
+                break;
+
+            case OBJ_JEWELLERY:
+                return count_plus ? jewellery_plus[sub_type]
+                                  : jewellery_counts[sub_type];
+
+            case OBJ_STAVES:
+                if (!count_plus)
+                    return staff_counts[sub_type];
+                break;
+
+            default:
+                break;
+        }
+    }
+
     int total = 0;
 
     for (const player_equip_entry& entry : items)
@@ -561,6 +591,11 @@ void player_equip_set::update()
     artprop_cache.init(0);
     armour_egos.init(0);
     gizmo_egos.init(false);
+    weapon_brands.init(0);
+    armour_counts.init(0);
+    jewellery_counts.init(0);
+    jewellery_plus.init(0);
+    staff_counts.init(0);
 
     artefact_properties_t artprops;
     for (const player_equip_entry& entry : items)
@@ -574,6 +609,29 @@ void player_equip_set::update()
 
         if (!entry.melded)
         {
+            switch (item.base_type)
+            {
+                case OBJ_WEAPONS:
+                    weapon_brands[get_weapon_brand(item)] += 1;
+                    break;
+
+                case OBJ_ARMOUR:
+                    armour_counts[item.sub_type] += 1;
+                    break;
+
+                case OBJ_JEWELLERY:
+                    jewellery_counts[item.sub_type] += 1;
+                    jewellery_plus[item.sub_type] += item.plus;
+                    break;
+
+                case OBJ_STAVES:
+                    staff_counts[item.sub_type] += 1;
+                    break;
+
+                default:
+                    break;
+            }
+
             if (item.base_type == OBJ_ARMOUR)
             {
                 armour_egos[get_armour_ego_type(item)] += 1;
@@ -1550,6 +1608,7 @@ void equip_item(equipment_slot slot, int item_slot, bool msg, bool skip_effects)
 
     you.equipment.add(item, slot);
     you.equipment.update();
+    invalidate_derived_stats();
 
     if (!skip_effects)
         equip_effect(item_slot, false, msg);
@@ -1596,6 +1655,7 @@ bool unequip_item(item_def& item, bool msg, bool skip_effects)
     const int item_slot = item.link;
     you.equipment.remove(item);
     you.equipment.update();
+    invalidate_derived_stats();
 
     if (!skip_effects)
         unequip_effect(item_slot, false, msg);
@@ -1636,6 +1696,10 @@ void equip_effect(int item_slot, bool unmeld, bool msg)
 {
     item_def& item = you.inv[item_slot];
 
+    // Melding and unmelding change effective equipment without passing
+    // through equip_item()/unequip_item().
+    invalidate_derived_stats();
+
     if (msg)
         _equip_use_warning(item);
 
@@ -1674,6 +1738,8 @@ void unequip_effect(int item_slot, bool meld, bool msg)
 {
     item_def& item = you.inv[item_slot];
 
+    invalidate_derived_stats();
+
     const interrupt_block block_meld_interrupts(meld);
 
     if (is_artefact(item))
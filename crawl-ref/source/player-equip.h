@@ -54,6 +54,20 @@ struct player_equip_set
     FixedVector<uint8_t, NUM_REAL_SPECIAL_ARMOURS> armour_egos;
     FixedVector<bool, NUM_GIZMOS> gizmo_egos;
 
+    // Cache of tally of brands on active weapons
+    FixedVector<uint8_t, NUM_SPECIAL_WEAPONS> weapon_brands;
+
+    // Per-subtype tallies of active equipment (plus summed jewellery
+    // enchantment), so that the wearing() queries issued by resist checks,
+    // attack resolution and the HUD are array reads instead of scans of
+    // the equipment list. Attunement-sensitive queries still scan, since
+    // attunement is flipped directly on entries without going through
+    // update().
+    FixedVector<uint8_t, NUM_ARMOURS> armour_counts;
+    FixedVector<uint8_t, NUM_JEWELLERY> jewellery_counts;
+    FixedVector<int, NUM_JEWELLERY> jewellery_plus;
+    FixedVector<uint8_t, NUM_STAVES> staff_counts;
+
     // Cache of which unrandarts are currently equipped, stored as a set of
     // bitflags corresponding to that unrand's ID. The corresponding bit will
     // be set in unrand_equipped whether the unrand is melded or not, but only
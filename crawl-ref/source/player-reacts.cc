@@ -98,6 +98,7 @@
 #include "travel.h"
 #include "view.h"
 #include "xom.h"
+#include "zone-profile.h"
 #include "zot.h" // bezotting
 
 /**
@@ -1288,6 +1289,7 @@ static void _do_eel_flavour_msg()
 
 void player_reacts()
 {
+    PERF_ZONE("player_reacts");
     // don't allow reactions while stair peeking in descent mode
     if (crawl_state.game_is_descent() && !env.properties.exists(DESCENT_STAIRS_KEY))
         return;
@@ -1401,6 +1403,9 @@ void player_reacts()
 
     incr_gem_clock();
     incr_zot_clock();
+
+    // Durations have just been decremented, some to expiry.
+    invalidate_derived_stats();
 }
 
 void extract_barbs(const char* endmsg)
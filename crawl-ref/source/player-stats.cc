@@ -419,6 +419,7 @@ static void _handle_stat_change(stat_type stat)
     }
 
     you.redraw_stats[stat] = true;
+    invalidate_derived_stats();
 }
 
 bool have_stat_zero()
@@ -1356,8 +1356,71 @@ int player::piety() const
     return max(0, min((int)raw_piety, MAX_PIETY - you.attribute[ATTR_OSTRACISM]));
 }
 
-// If temp is set to false, temporary sources or resistance won't be counted.
-int player_res_fire(bool allow_random, bool temp, bool items)
+// The resistance queries below are called many times per world tick -
+// attack resolution, monster AI and the status display all recompute
+// them - and each call walks equipment, mutations, durations and form
+// data from scratch. Those inputs only change at a handful of known
+// points, so the default-argument form of each query is memoized against
+// a version counter that the mutating code bumps; see
+// invalidate_derived_stats().
+enum derived_stat
+{
+    DSTAT_RES_FIRE,
+    DSTAT_RES_STEAM,
+    DSTAT_RES_COLD,
+    DSTAT_RES_CORR,
+    DSTAT_RES_ELEC,
+    DSTAT_RES_POISON,
+    NUM_DERIVED_STATS,
+};
+
+static struct derived_stat_memo
+{
+    unsigned int version; // 0 is never current, so entries start invalid
+    int value;
+} _derived_stat_memo[NUM_DERIVED_STATS];
+
+static unsigned int _derived_stats_version = 1;
+
+/**
+ * Invalidate the memoized resistance values.
+ *
+ * Called wherever the inputs the resist queries read are changed -
+ * equipment and melding, mutation gain/loss, durations, form changes -
+ * and once per world tick as a backstop for anything that writes those
+ * inputs directly.
+ */
+void invalidate_derived_stats()
+{
+    _derived_stats_version++;
+}
+
+unsigned int derived_stats_version()
+{
+    return _derived_stats_version;
+}
+
+static int _memoized_stat(derived_stat which, int (*compute)())
+{
+    derived_stat_memo &memo = _derived_stat_memo[which];
+    if (memo.version != _derived_stats_version)
+    {
+        memo.value = compute();
+        memo.version = _derived_stats_version;
+    }
+    return memo.value;
+}
+
+// The dragonskin cloak grants each draconic resistance half the time,
+// rolled per query, so results are only cacheable while it isn't worn
+// (or while the caller has asked for the unrandomised value).
+static bool _resist_is_cacheable(bool allow_random, bool temp, bool items)
+{
+    return temp && items
+           && (!allow_random || !you.unrand_equipped(UNRAND_DRAGONSKIN));
+}
+
+static int _player_res_fire_uncached(bool allow_random, bool temp, bool items)
 {
     int rf = 0;
 
@@ -1417,7 +1480,18 @@ int player_res_fire(bool allow_random, bool temp, bool items)
     return rf;
 }
 
-int player_res_steam(bool allow_random, bool temp, bool items)
+// If temp is set to false, temporary sources or resistance won't be counted.
+int player_res_fire(bool allow_random, bool temp, bool items)
+{
+    if (_resist_is_cacheable(allow_random, temp, items))
+    {
+        return _memoized_stat(DSTAT_RES_FIRE,
+            [] { return _player_res_fire_uncached(false, true, true); });
+    }
+    return _player_res_fire_uncached(allow_random, temp, items);
+}
+
+static int _player_res_steam_uncached(bool allow_random, bool temp, bool items)
 {
     int res = 0;
     const int rf = player_res_fire(allow_random, temp, items);
@@ -1441,7 +1515,17 @@ int player_res_steam(bool allow_random, bool temp, bool items)
     return res;
 }
 
-int player_res_cold(bool allow_random, bool temp, bool items)
+int player_res_steam(bool allow_random, bool temp, bool items)
+{
+    if (_resist_is_cacheable(allow_random, temp, items))
+    {
+        return _memoized_stat(DSTAT_RES_STEAM,
+            [] { return _player_res_steam_uncached(false, true, true); });
+    }
+    return _player_res_steam_uncached(allow_random, temp, items);
+}
+
+static int _player_res_cold_uncached(bool allow_random, bool temp, bool items)
 {
     int rc = 0;
 
@@ -1494,7 +1578,18 @@ int player_res_cold(bool allow_random, bool temp, bool items)
     return rc;
 }
 
-int player_res_corrosion(bool allow_random, bool temp, bool items)
+int player_res_cold(bool allow_random, bool temp, bool items)
+{
+    if (_resist_is_cacheable(allow_random, temp, items))
+    {
+        return _memoized_stat(DSTAT_RES_COLD,
+            [] { return _player_res_cold_uncached(false, true, true); });
+    }
+    return _player_res_cold_uncached(allow_random, temp, items);
+}
+
+static int _player_res_corrosion_uncached(bool allow_random, bool temp,
+                                          bool items)
 {
     if (temp && you.duration[DUR_RESISTANCE])
         return 1;
@@ -1529,7 +1624,18 @@ int player_res_corrosion(bool allow_random, bool temp, bool items)
     return 0;
 }
 
-int player_res_electricity(bool allow_random, bool temp, bool items)
+int player_res_corrosion(bool allow_random, bool temp, bool items)
+{
+    if (_resist_is_cacheable(allow_random, temp, items))
+    {
+        return _memoized_stat(DSTAT_RES_CORR,
+            [] { return _player_res_corrosion_uncached(false, true, true); });
+    }
+    return _player_res_corrosion_uncached(allow_random, temp, items);
+}
+
+static int _player_res_electricity_uncached(bool allow_random, bool temp,
+                                            bool items)
 {
     int re = 0;
 
@@ -1572,6 +1678,16 @@ int player_res_electricity(bool allow_random, bool temp, bool items)
     return re;
 }
 
+int player_res_electricity(bool allow_random, bool temp, bool items)
+{
+    if (_resist_is_cacheable(allow_random, temp, items))
+    {
+        return _memoized_stat(DSTAT_RES_ELEC,
+            [] { return _player_res_electricity_uncached(false, true, true); });
+    }
+    return _player_res_electricity_uncached(allow_random, temp, items);
+}
+
 // Kiku protects you from torment to a degree.
 bool player_kiku_res_torment()
 {
@@ -1580,8 +1696,8 @@ bool player_kiku_res_torment()
            && !(you_worship(GOD_KIKUBAAQUDGHA) && you.gift_timeout);
 }
 
-// If temp is set to false, temporary sources or resistance won't be counted.
-int player_res_poison(bool allow_random, bool temp, bool items, bool forms)
+static int _player_res_poison_uncached(bool allow_random, bool temp,
+                                       bool items, bool forms)
 {
     const int form_rp = forms ? cur_form(temp)->res_pois() : 0;
     if (you.is_nonliving(temp, forms)
@@ -1637,6 +1753,17 @@ int player_res_poison(bool allow_random, bool temp, bool items, bool forms)
     return rp;
 }
 
+// If temp is set to false, temporary sources or resistance won't be counted.
+int player_res_poison(bool allow_random, bool temp, bool items, bool forms)
+{
+    if (forms && _resist_is_cacheable(allow_random, temp, items))
+    {
+        return _memoized_stat(DSTAT_RES_POISON,
+            [] { return _player_res_poison_uncached(false, true, true, true); });
+    }
+    return _player_res_poison_uncached(allow_random, temp, items, forms);
+}
+
 int player_res_sticky_flame()
 {
     return you.is_insubstantial();
@@ -2404,6 +2531,8 @@ void forget_map(bool rot)
 #endif
     }
 
+    explore_frontier_invalidate();
+
     ash_detect_portals(is_map_persistent());
 #ifdef USE_TILE
     tiles.update_minimap_bounds();
@@ -5383,6 +5512,9 @@ player::player()
     chr_god_name.clear();
     chr_species_name.clear();
     chr_class_name.clear();
+    // Memoized values from a previous game in this session are no longer
+    // about this player.
+    invalidate_derived_stats();
     // Permanent data:
     your_name.clear();
     species          = SP_UNKNOWN;
@@ -8322,6 +8454,9 @@ void player::increase_duration(duration_type dur, int turns, int cap,
     duration[dur] += turns * BASELINE_DELAY;
     if (cap && duration[dur] > cap)
         duration[dur] = cap;
+
+    invalidate_derived_stats();
+    bump_actor_ench_mark();
 }
 
 void player::set_duration(duration_type dur, int turns,
@@ -1150,6 +1150,11 @@ bool player_kiku_res_torment();
 
 bool player_likes_water(bool permanently = false);
 
+void invalidate_derived_stats();
+// Current value of the derived-stats version counter, for caches outside
+// this file that invalidate on the same events.
+unsigned int derived_stats_version();
+
 int player_res_cold(bool allow_random = true, bool temp = true,
                     bool items = true);
 int player_res_electricity(bool allow_random = true, bool temp = true,
@@ -225,47 +225,32 @@ constexpr dice_def CONVENIENT_NONZERO_DAMAGE{42, 1};
 
 dice_def calc_dice(int num_dice, int max_damage, bool random = true);
 
-template<typename T>
-class power_deducer
-{
-public:
-    virtual T operator()(int pow, bool random = true) const = 0;
-    virtual ~power_deducer() {}
-};
-
-typedef power_deducer<int> tohit_deducer;
+// Power-to-to-hit and power-to-damage formulas for the zap and form data
+// tables. These are plain function templates rather than virtual classes
+// so the tables referencing them are constant-initialized static data -
+// no per-entry heap allocation at startup - and a query is a direct call
+// through the stored pointer with the formula baked in at compile time.
+typedef int tohit_deducer(int pow, bool random);
 
 template<int adder, int mult_num = 0, int mult_denom = 1>
-class tohit_calculator : public tohit_deducer
+int tohit_calculator(int pow, bool /*random*/)
 {
-public:
-    int operator()(int pow, bool /*random*/) const override
-    {
-        return adder + pow * mult_num / mult_denom;
-    }
-};
+    return adder + pow * mult_num / mult_denom;
+}
 
-typedef power_deducer<dice_def> dam_deducer;
+typedef dice_def dam_deducer(int pow, bool random);
 
 template<int numdice, int adder, int mult_num, int mult_denom>
-class dicedef_calculator : public dam_deducer
+dice_def dicedef_calculator(int pow, bool /*random*/)
 {
-public:
-    dice_def operator()(int pow, bool /*random*/) const override
-    {
-        return dice_def(numdice, adder + pow * mult_num / mult_denom);
-    }
-};
+    return dice_def(numdice, adder + pow * mult_num / mult_denom);
+}
 
 template<int numdice, int adder, int mult_num, int mult_denom>
-class calcdice_calculator : public dam_deducer
+dice_def calcdice_calculator(int pow, bool random)
 {
-public:
-    dice_def operator()(int pow, bool random) const override
-    {
-        return calc_dice(numdice, adder + pow * mult_num / mult_denom, random);
-    }
-};
+    return calc_dice(numdice, adder + pow * mult_num / mult_denom, random);
+}
 
 // I must be a random-access iterator.
 template <typename I>
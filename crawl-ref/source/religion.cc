@@ -62,6 +62,7 @@
 #include "output.h"
 #include "piety-info.h"
 #include "player-equip.h"
+#include "player.h"
 #include "player-stats.h"
 #include "prompt.h"
 #include "randbook.h"
@@ -675,6 +676,7 @@ void dec_penance(god_type god, int val)
         const bool had_umbra = have_passive(passive_t::umbra);
 
         you.penance[god] = 0;
+        invalidate_derived_stats();
 
         mark_milestone("god.mollify",
                        "mollified " + god_name(god) + ".");
@@ -761,6 +763,7 @@ void dec_penance(god_type god, int val)
     else
     {
         you.penance[god] -= val;
+        invalidate_derived_stats();
         return;
     }
 
@@ -1012,6 +1015,7 @@ static void _inc_penance(god_type god, int val)
         you.penance[god] = min((uint8_t)MAX_PENANCE, you.penance[god]);
     }
 
+    invalidate_derived_stats();
     set_penance_xp_timeout();
 }
 
@@ -1023,6 +1027,7 @@ static void _inc_penance(int val)
 static void _set_penance(god_type god, int val)
 {
     you.penance[god] = val;
+    invalidate_derived_stats();
 }
 
 static void _set_wrath_penance(god_type god)
@@ -2374,6 +2379,14 @@ static void _handle_piety_gain(int old_piety)
         const int new_rank = piety_rank();
         take_note(Note(NOTE_PIETY_RANK, you.religion, new_rank));
 
+        // A single gain can cross several ranks (gods joining mid-game,
+        // Xom's whims, wizmode). Collect the heavyweight settlement work
+        // and do it once after all ranks are processed, not per power.
+#ifdef USE_TILE_LOCAL
+        bool new_power = false;
+#endif
+        bool refresh_ash_id = false;
+
         for (int rank = piety_rank(old_piety) + 1; rank <= new_rank; ++rank)
         {
             // For messaging reasons, we want to get our ancestor before
@@ -2397,9 +2410,7 @@ static void _handle_piety_gain(int old_piety)
                 {
                     power.display(true, "You can now %s.");
     #ifdef USE_TILE_LOCAL
-                    tiles.layout_statcol();
-                    redraw_screen();
-                    update_screen();
+                    new_power = true;
     #endif
                     learned_something_new(HINT_NEW_ABILITY_GOD);
                 }
@@ -2422,7 +2433,7 @@ static void _handle_piety_gain(int old_piety)
                 you.duration[DUR_CONF] = 0;
             }
             if (rank >= rank_for_passive(passive_t::identify_items))
-                ash_id_inventory();
+                refresh_ash_id = true;
 
             // TODO: add one-time ability check in have_passive
             if (have_passive(passive_t::unlock_slime_vaults)
@@ -2475,6 +2486,17 @@ static void _handle_piety_gain(int old_piety)
                 perma_mutate(mut, 1, "Makhleb's blessing");
             }
         }
+
+#ifdef USE_TILE_LOCAL
+        if (new_power)
+        {
+            tiles.layout_statcol();
+            redraw_screen();
+            update_screen();
+        }
+#endif
+        if (refresh_ash_id)
+            ash_id_inventory();
     }
 
     // The player's symbol depends on Beogh piety.
@@ -2607,6 +2629,7 @@ bool gain_piety(int original_gain, int denominator, bool should_scale_piety)
     pgn = div_rand_round(pgn, denominator);
     while (pgn-- > 0)
         _gain_piety_point();
+    invalidate_derived_stats(); // resist passives can appear with rank
     // Note down the first time you hit 6* piety with a given god,
     // excepting Ignis, since it's not really meaningful there.
     if (you.raw_piety > you.piety_max[you.religion] && !you_worship(GOD_IGNIS))
@@ -2737,6 +2760,7 @@ void lose_piety(int pgn)
         you.raw_piety = 0;
     else
         you.raw_piety -= pgn;
+    invalidate_derived_stats();
 
     if (you.raw_piety > 0 && you.raw_piety <= 5)
         learned_something_new(HINT_GOD_DISPLEASED);
@@ -2889,6 +2913,7 @@ void excommunication(bool voluntary, god_type new_god)
     you.duration[DUR_RECITE] = 0;
     you.raw_piety = 0;
     you.piety_hysteresis = 0;
+    invalidate_derived_stats(); // divine resist passives just went away
 
     // so that the player isn't punished for "switching" between good gods via aX
     if (is_good_god(old_god) && voluntary)
@@ -3864,6 +3889,7 @@ void join_religion(god_type which_god)
 
     // Welcome to the fold!
     you.religion = static_cast<god_type>(which_god);
+    invalidate_derived_stats();
     set_god_ability_slots();    // remove old god's slots, reserve new god's
 
     // included in default force_more_message
@@ -4635,7 +4661,7 @@ int get_monster_tension(const monster& mons, god_type god)
     return exp;
 }
 
-int get_tension(god_type god)
+static int _get_tension_uncached(god_type god)
 {
     int total = 0;
 
@@ -4750,6 +4776,51 @@ int get_tension(god_type god)
     return max(tension_min, tension);
 }
 
+int get_tension(god_type god)
+{
+    // Tension walks every monster in LOS and is queried several times per
+    // turn by Xom effects, god wrath and the door-sealing AI, so memoize
+    // the result against the cheap marks covering its inputs. The what-if
+    // queries (e.g. tension with a door sealed) stay exact: terrain edits
+    // bump the terrain mark, and enchantment, duration or position
+    // changes bump the actor marks. The few player inputs not behind a
+    // mark (forms, directly-written durations) can go stale at most until
+    // the clock next advances.
+    static struct tension_memo
+    {
+        bool valid;
+        god_type god;
+        unsigned actor_mark, ench_mark, terrain_mark;
+        int elapsed, hp, hp_max, mp;
+        int tension;
+    } memo = { false, GOD_NO_GOD, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    if (memo.valid
+        && memo.god == god
+        && memo.actor_mark == actor_position_mark()
+        && memo.ench_mark == actor_ench_mark()
+        && memo.terrain_mark == terrain_change_mark()
+        && memo.elapsed == you.elapsed_time
+        && memo.hp == you.hp
+        && memo.hp_max == you.hp_max
+        && memo.mp == you.magic_points)
+    {
+        return memo.tension;
+    }
+
+    memo.god = god;
+    memo.actor_mark = actor_position_mark();
+    memo.ench_mark = actor_ench_mark();
+    memo.terrain_mark = terrain_change_mark();
+    memo.elapsed = you.elapsed_time;
+    memo.hp = you.hp;
+    memo.hp_max = you.hp_max;
+    memo.mp = you.magic_points;
+    memo.tension = _get_tension_uncached(god);
+    memo.valid = true;
+    return memo.tension;
+}
+
 int get_fuzzied_monster_difficulty(const monster& mons)
 {
     double factor = sqrt(exp_needed(you.experience_level) / 30.0);
@@ -11,6 +11,57 @@
 
 using namespace std;
 
+// Write-if-unchanged support: outputs are written to a temporary file and
+// only moved over the target when the bytes differ. Unchanged outputs keep
+// their old timestamps, so downstream consumers (tiledef compiles,
+// pngcrush) don't rerun for sheets whose contents didn't change.
+static bool _files_identical(const char *a, const char *b)
+{
+    FILE *fa = fopen(a, "rb");
+    if (!fa)
+        return false;
+    FILE *fb = fopen(b, "rb");
+    if (!fb)
+    {
+        fclose(fa);
+        return false;
+    }
+
+    bool same = true;
+    char buf_a[65536], buf_b[65536];
+    while (same)
+    {
+        size_t read_a = fread(buf_a, 1, sizeof(buf_a), fa);
+        size_t read_b = fread(buf_b, 1, sizeof(buf_b), fb);
+        if (read_a != read_b || memcmp(buf_a, buf_b, read_a) != 0)
+            same = false;
+        if (read_a < sizeof(buf_a))
+            break;
+    }
+
+    fclose(fa);
+    fclose(fb);
+    return same;
+}
+
+static bool _commit_output(const char *tmpfile, const char *filename)
+{
+    if (_files_identical(tmpfile, filename))
+    {
+        remove(tmpfile);
+        return true;
+    }
+
+    remove(filename);
+    if (rename(tmpfile, filename))
+    {
+        fprintf(stderr, "Error: couldn't rename '%s' to '%s'.\n",
+                tmpfile, filename);
+        return false;
+    }
+    return true;
+}
+
 tile_list_processor::tile_list_processor() :
     m_last_enum(0),
     m_rim(false),
@@ -1111,27 +1162,28 @@ bool tile_list_processor::write_data(bool image, bool code)
 
         if (image)
         {
-            char filename[1024];
+            char filename[1024], tmpfile[1040];
             snprintf(filename, sizeof(filename), "%s.png", lcname.c_str());
+            snprintf(tmpfile, sizeof(tmpfile), "%s.tmp", filename);
             if (m_abstract.empty())
             {
-                if (!m_page.write_image(filename))
+                if (!m_page.write_image(tmpfile))
                     return false;
             }
             else
             {
                 // Write an empty file.
-                char filename[1024];
-                snprintf(filename, sizeof(filename), "%s.png", lcname.c_str());
-                FILE *fp = fopen(filename, "w");
+                FILE *fp = fopen(tmpfile, "w");
                 if (!fp)
                 {
                     fprintf(stderr, "Error: couldn't open '%s' for write.\n",
-                            filename);
+                            tmpfile);
                     return false;
                 }
                 fclose(fp);
             }
+            if (!_commit_output(tmpfile, filename))
+                return false;
         }
     }
 
@@ -1142,13 +1194,14 @@ bool tile_list_processor::write_data(bool image, bool code)
 
     // Write "tiledef-%name.h"
     {
-        char filename[1024];
+        char filename[1024], tmpfile[1040];
         snprintf(filename, sizeof(filename), "tiledef-%s.h", lcname.c_str());
-        FILE *fp = fopen(filename, "w");
+        snprintf(tmpfile, sizeof(tmpfile), "%s.tmp", filename);
+        FILE *fp = fopen(tmpfile, "w");
 
         if (!fp)
         {
-            fprintf(stderr, "Error: couldn't open '%s' for write.\n", filename);
+            fprintf(stderr, "Error: couldn't open '%s' for write.\n", tmpfile);
             return false;
         }
 
@@ -1302,18 +1355,22 @@ bool tile_list_processor::write_data(bool image, bool code)
         }
 
         fclose(fp);
+
+        if (!_commit_output(tmpfile, filename))
+            return false;
     }
 
     // write "tiledef-%name.cc"
     if (m_abstract.empty())
     {
-        char filename[1024];
+        char filename[1024], tmpfile[1040];
         snprintf(filename, sizeof(filename), "tiledef-%s.cc", lcname.c_str());
-        FILE *fp = fopen(filename, "w");
+        snprintf(tmpfile, sizeof(tmpfile), "%s.tmp", filename);
+        FILE *fp = fopen(tmpfile, "w");
 
         if (!fp)
         {
-            fprintf(stderr, "Error: couldn't open '%s' for write.\n", filename);
+            fprintf(stderr, "Error: couldn't open '%s' for write.\n", tmpfile);
             return false;
         }
 
@@ -1568,6 +1625,9 @@ bool tile_list_processor::write_data(bool image, bool code)
             lcname.c_str(), lcname.c_str(), lcname.c_str(), lcname.c_str());
 
         fclose(fp);
+
+        if (!_commit_output(tmpfile, filename))
+            return false;
     }
     else
     {
@@ -1577,13 +1637,14 @@ bool tile_list_processor::write_data(bool image, bool code)
             return false;
         }
 
-        char filename[1024];
+        char filename[1024], tmpfile[1040];
         snprintf(filename, sizeof(filename), "tiledef-%s.cc", lcname.c_str());
-        FILE *fp = fopen(filename, "w");
+        snprintf(tmpfile, sizeof(tmpfile), "%s.tmp", filename);
+        FILE *fp = fopen(tmpfile, "w");
 
         if (!fp)
         {
-            fprintf(stderr, "Error: couldn't open '%s' for write.\n", filename);
+            fprintf(stderr, "Error: couldn't open '%s' for write.\n", tmpfile);
             return false;
         }
 
@@ -1667,18 +1728,22 @@ bool tile_list_processor::write_data(bool image, bool code)
         fprintf(fp, "}\n\n");
 
         fclose(fp);
+
+        if (!_commit_output(tmpfile, filename))
+            return false;
     }
 
     // write "tile-%name.html"
     if (!m_page.m_tiles.empty())
     {
-        char filename[1024];
+        char filename[1024], tmpfile[1040];
         snprintf(filename, sizeof(filename), "tile-%s.html", lcname.c_str());
-        FILE *fp = fopen(filename, "w");
+        snprintf(tmpfile, sizeof(tmpfile), "%s.tmp", filename);
+        FILE *fp = fopen(tmpfile, "w");
 
         if (!fp)
         {
-            fprintf(stderr, "Error: couldn't open '%s' for write.\n", filename);
+            fprintf(stderr, "Error: couldn't open '%s' for write.\n", tmpfile);
             return false;
         }
 
@@ -1745,6 +1810,9 @@ bool tile_list_processor::write_data(bool image, bool code)
         fprintf(fp, "</table></html>\n");
 
         fclose(fp);
+
+        if (!_commit_output(tmpfile, filename))
+            return false;
     }
 
     delete[] part_min;
@@ -1762,8 +1830,10 @@ bool tile_list_processor::write_data(bool image, bool code)
             return false;
         }
 
+        // The image stamp carries the fragment dependencies: the .png
+        // itself keeps its old timestamp when its contents don't change.
         if (!m_page.m_tiles.empty())
-            fprintf(fp, "%s.png: \\\n", lcname.c_str());
+            fprintf(fp, ".%s.img.stamp: \\\n", lcname.c_str());
 
         for (const auto& str : m_depends)
              fprintf(fp, "  %s \\\n", str.c_str());
@@ -1781,13 +1851,14 @@ bool tile_list_processor::write_data(bool image, bool code)
 
     // write "tileinfo-%name.js"
     {
-        char filename[1024];
+        char filename[1024], tmpfile[1040];
         snprintf(filename, sizeof(filename), "tileinfo-%s.js", lcname.c_str());
-        FILE *fp = fopen(filename, "w");
+        snprintf(tmpfile, sizeof(tmpfile), "%s.tmp", filename);
+        FILE *fp = fopen(tmpfile, "w");
 
         if (!fp)
         {
-            fprintf(stderr, "Error: couldn't open '%s' for write.\n", filename);
+            fprintf(stderr, "Error: couldn't open '%s' for write.\n", tmpfile);
             return false;
         }
 
@@ -1985,6 +2056,9 @@ bool tile_list_processor::write_data(bool image, bool code)
         fprintf(fp, "return exports;\n});\n");
 
         fclose(fp);
+
+        if (!_commit_output(tmpfile, filename))
+            return false;
     }
 
     return true;
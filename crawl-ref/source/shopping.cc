@@ -17,6 +17,7 @@
 #include "colour.h"
 #include "describe.h"
 #include "dgn-overview.h"
+#include "dungeon.h"
 #include "english.h"
 #include "env.h"
 #include "files.h"
@@ -1545,6 +1546,9 @@ void shop()
     shop_struct& shop = *shop_at(you.pos());
     const string shopname = shop_name(shop);
 
+    // Deferred-stock shops roll their inventory on first entry.
+    stock_deferred_shop(shop);
+
     // Quick out, if no inventory
     if (shop.stock.empty())
     {
@@ -64,12 +64,19 @@ struct shop_struct
     FixedVector<uint8_t, 3> keeper_name;
 
     vector<item_def> stock;
+    // Shops with a generic spec defer their item rolls to first entry;
+    // the seed pair captured at placement makes the deferred stock match
+    // what stocking at level build time would have produced.
+    bool                stocked;
+    uint64_t            stock_seed;
+    uint64_t            stock_seq;
 #if TAG_MAJOR_VERSION == 34
     uint8_t num; // used in a save compat hack
 #endif
 
     shop_struct () : pos(), greed(0), type(SHOP_UNASSIGNED), level(0),
-                     shop_name(""), shop_type_name(""), shop_suffix_name("") { }
+                     shop_name(""), shop_type_name(""), shop_suffix_name(""),
+                     stocked(true), stock_seed(0), stock_seq(0) { }
 
     bool defined() const { return type != SHOP_UNASSIGNED; }
 };
@@ -37,8 +37,14 @@
 #include "terrain.h"
 #include "view.h"
 #include "viewchar.h"
-
-static noise_grid _noise_grid;
+#include "zone-profile.h"
+
+// Double-buffered: noises heard while one grid is mid-propagation
+// (monsters yipping when woken) are registered into the other, so
+// propagation never has to copy the whole grid for reentrancy.
+static noise_grid _noise_grids[2];
+static int _live_noise_grid = 0;
+#define _noise_grid (_noise_grids[_live_noise_grid])
 static void _monster_apply_noise(monster *mons,
                                  const coord_def &apparent_source,
                                  int noise_intensity_millis);
@@ -749,16 +755,19 @@ void yell(const actor* target)
 
 void apply_noises()
 {
-    // [ds] This copying isn't awesome, but we cannot otherwise handle
-    // the case where one set of noises wakes up monsters who then let
-    // out yips of their own, modifying _noise_grid while it is in the
-    // middle of propagate_noise().
+    PERF_ZONE("apply_noises");
+    // [ds] We cannot propagate in place: one set of noises can wake
+    // up monsters who then let out yips of their own, modifying
+    // _noise_grid while it is in the middle of propagate_noise().
+    // Flip to the scratch grid for those new noises and propagate the
+    // old one, instead of copying the whole grid.
     if (_noise_grid.dirty())
     {
-        noise_grid copy = _noise_grid;
-        // Reset the main grid.
+        noise_grid &propagating = _noise_grid;
+        _live_noise_grid = !_live_noise_grid;
+        // Reset the (previously propagated) grid now taking new noises.
         _noise_grid.reset();
-        copy.propagate_noise();
+        propagating.propagate_noise();
     }
 }
 
@@ -943,7 +952,11 @@ void noise_grid::propagate_noise()
     dprf(DIAG_NOISE, "noise_grid: %u noises to apply",
          (unsigned int)noises.size());
 #endif
-    vector<coord_def> noise_perimeter[2];
+    // The two frontier rings of the travel-distance-ordered sweep;
+    // static so their capacity is reused across calls.
+    static vector<coord_def> noise_perimeter[2];
+    noise_perimeter[0].clear();
+    noise_perimeter[1].clear();
     int circ_index = 0;
 
     for (const noise_t &noise : noises)
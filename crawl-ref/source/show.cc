@@ -8,6 +8,7 @@
 #include "mpr.h"
 #include "show.h"
 
+#include "actor.h"
 #include "areas.h"
 #include "cloud.h"
 #include "coord.h"
@@ -314,6 +315,7 @@ static void _update_cloud(cloud_struct& cloud)
     cloud_info ci(cloud.type, get_cloud_colour(cloud), variety, 0, gp,
                   cloud.killer);
     env.map_knowledge(gp).set_cloud(ci);
+    remember_cloud_knowledge(gp);
 }
 
 static void _check_monster_pos(const monster* mons)
@@ -356,6 +358,26 @@ static int _hashed_rand(const monster* mons, uint32_t id, uint32_t die)
     return hash32(&data, sizeof(data)) % die;
 }
 
+// Building a monster_info runs a long tail of holiness, resist and
+// status queries, and show_init() rebuilds one for every visible monster
+// on every redraw. Cache the last info built per mid and reuse it while
+// the world state is provably unchanged: redraw bursts within one action
+// (animations, flashes, forced refreshes) are the common case. Changes
+// that move nobody — beam damage landing mid-animation, say — are caught
+// by the cheap per-monster fingerprint below.
+struct cached_monster_info
+{
+    monster_info mi;
+    int hit_points;
+    size_t num_enchantments;
+    monster_flags_t flags;
+    unsigned int number;
+};
+static map<mid_t, cached_monster_info> _minfo_cache;
+static int _minfo_elapsed_time = -1;
+static unsigned _minfo_terrain_mark = 0;
+static unsigned _minfo_actor_mark = 0;
+
 /**
  * Update map knowledge for monsters
  *
@@ -372,7 +394,36 @@ static void _update_monster(monster* mons)
     if (mons->visible_to(&you))
     {
         mons->ensure_has_client_id();
+
+        if (_minfo_elapsed_time != you.elapsed_time
+            || _minfo_terrain_mark != terrain_change_mark()
+            || _minfo_actor_mark != actor_position_mark())
+        {
+            _minfo_cache.clear();
+            _minfo_elapsed_time = you.elapsed_time;
+            _minfo_terrain_mark = terrain_change_mark();
+            _minfo_actor_mark = actor_position_mark();
+        }
+
+        auto cached = _minfo_cache.find(mons->mid);
+        if (cached != _minfo_cache.end()
+            && cached->second.hit_points == mons->hit_points
+            && cached->second.num_enchantments == mons->enchantments.size()
+            && cached->second.flags == mons->flags
+            && cached->second.number == mons->number)
+        {
+            cached->second.mi.pos = gp;
+            env.map_knowledge(gp).set_monster(cached->second.mi);
+            return;
+        }
+
         monster_info mi(mons);
+        cached_monster_info &entry = _minfo_cache[mons->mid];
+        entry.mi = mi;
+        entry.hit_points = mons->hit_points;
+        entry.num_enchantments = mons->enchantments.size();
+        entry.flags = mons->flags;
+        entry.number = mons->number;
         env.map_knowledge(gp).set_monster(mi);
         return;
     }
@@ -575,6 +575,55 @@ static cglyph_t _get_cell_glyph_with_class(const map_cell& cell,
     return g;
 }
 
+// Everything outside map_knowledge that can recolour glyphs without a
+// turn passing funnels through here (currently just exclusion changes).
+static uint32_t _glyph_epoch = 1;
+
+void bump_glyph_epoch()
+{
+    _glyph_epoch++;
+}
+
+static uint32_t _glyph_hash_mix(uint32_t hash, uint32_t val)
+{
+    // FNV-1a, folding in 32 bits at a time.
+    hash = (hash ^ (val & 0xff)) * 0x01000193;
+    hash = (hash ^ (val >> 8 & 0xff)) * 0x01000193;
+    hash = (hash ^ (val >> 16 & 0xff)) * 0x01000193;
+    hash = (hash ^ (val >> 24)) * 0x01000193;
+    return hash;
+}
+
+// Hash every input _get_cell_glyph_with_class reads for the simple cell
+// classes, plus the turn count and epoch to cover the slower-moving
+// global state (haloes and the like raise cell flags; the rest only
+// changes when a turn passes or the epoch is bumped).
+static uint32_t _cell_glyph_hash(const map_cell& cell, show_class cls,
+                                 int colour_mode)
+{
+    uint32_t hash = 0x811c9dc5;
+    hash = _glyph_hash_mix(hash, _glyph_epoch);
+    hash = _glyph_hash_mix(hash, you.num_turns);
+    hash = _glyph_hash_mix(hash, cls | (colour_mode + 1) << 8);
+    hash = _glyph_hash_mix(hash, cell.flags);
+    hash = _glyph_hash_mix(hash, cell.feat() | cell.feat_colour() << 16);
+    if (const cloud_info *cloud = cell.cloudinfo())
+    {
+        hash = _glyph_hash_mix(hash, cloud->type | cloud->colour << 8
+                                     | cloud->variety << 16);
+    }
+    if (const item_def *item = cell.item())
+    {
+        hash = _glyph_hash_mix(hash, item->base_type | item->sub_type << 8
+                                     | (item->plus & 0xffff) << 16);
+        hash = _glyph_hash_mix(hash, item->special);
+        hash = _glyph_hash_mix(hash, item->quantity | item->rnd << 24);
+        hash = _glyph_hash_mix(hash, (uint32_t)item->flags);
+        hash = _glyph_hash_mix(hash, (uint32_t)(item->flags >> 32));
+    }
+    return hash ? hash : 1;
+}
+
 cglyph_t get_cell_glyph(const coord_def& loc, bool only_stationary_monsters,
                         int colour_mode)
 {
@@ -583,7 +632,26 @@ cglyph_t get_cell_glyph(const coord_def& loc, bool only_stationary_monsters,
     const map_cell& cell = env.map_knowledge(loc);
     const show_class cell_show_class =
         get_cell_show_class(cell, only_stationary_monsters);
-    return _get_cell_glyph_with_class(cell, loc, cell_show_class, colour_mode);
+
+    // Monster and exposed-invisible cells aren't memoized: monster_info
+    // has far too many colour-relevant fields to hash profitably, and
+    // there are few such cells per frame anyway.
+    if (cell_show_class == SH_MONSTER || cell_show_class == SH_INVIS_EXPOSED)
+    {
+        return _get_cell_glyph_with_class(cell, loc, cell_show_class,
+                                          colour_mode);
+    }
+
+    const uint32_t hash = _cell_glyph_hash(cell, cell_show_class, colour_mode);
+    if (cell.glyph_key == hash)
+        return cglyph_t(cell.glyph_ch, cell.glyph_col);
+
+    const cglyph_t g = _get_cell_glyph_with_class(cell, loc, cell_show_class,
+                                                  colour_mode);
+    cell.glyph_key = hash;
+    cell.glyph_ch = g.ch;
+    cell.glyph_col = g.col;
+    return g;
 }
 
 char32_t get_feat_symbol(dungeon_feature_type feat)
@@ -147,7 +147,31 @@ struct species_skill_aptitude
 // Traditionally, Spellcasting and In/Evocations formed the exceptions here:
 // Spellcasting skill was more expensive with about 130%, the other two got
 // a discount with about 75%.
-static int _spec_skills[NUM_SPECIES][NUM_SKILLS];
+
+// Unpacks the generated aptitude list into a directly indexed table during
+// static initialisation, so that species_apt() is a plain array read with
+// no first-call setup pass. aptitudes.h is declared just above in this
+// translation unit, so its entries are initialised before this constructor
+// runs.
+struct species_apt_table
+{
+    int apt[NUM_SPECIES][NUM_SKILLS];
+
+    species_apt_table()
+    {
+        // Setup sentinel values to find errors more easily.
+        const int sentinel = -20; // this gives cost 3200
+        for (int sp = 0; sp < NUM_SPECIES; ++sp)
+            for (int sk = 0; sk < NUM_SKILLS; ++sk)
+                apt[sp][sk] = sentinel;
+        for (const species_skill_aptitude &ssa : species_skill_aptitudes)
+        {
+            ASSERT(apt[ssa.species][ssa.skill] == sentinel);
+            apt[ssa.species][ssa.skill] = ssa.aptitude;
+        }
+    }
+};
+static const species_apt_table _spec_skills;
 
 // The progress of skill_cost_level depends only on total experience points,
 // it's independent of species. We try to keep close to the old system
@@ -155,14 +179,27 @@ static int _spec_skills[NUM_SPECIES][NUM_SKILLS];
 // This means that for a species with 130 exp apt, skill_cost_level should be
 // the same as XL (unless the player has been drained).
 
+static const int MAX_SKILL_COST_LEVEL = 27;
+
 // 130 exp apt is midway between +0 and -1 now. -- elliptic
 unsigned int skill_cost_needed(int level)
 {
-    return exp_needed(level, 1) * 13;
+    // With a fixed aptitude of 1, exp_needed() reads no player state, so
+    // this depends only on `level`. calc_skill_cost_level() walks these
+    // breakpoints on every XP award (including monster-vs-monster
+    // trickle), so compute the table a single time.
+    static unsigned int breakpoints[MAX_SKILL_COST_LEVEL + 2];
+    static bool breakpoints_initialised = false;
+    if (!breakpoints_initialised)
+    {
+        for (int lev = 1; lev <= MAX_SKILL_COST_LEVEL + 1; ++lev)
+            breakpoints[lev] = exp_needed(lev, 1) * 13;
+        breakpoints_initialised = true;
+    }
+    ASSERT_RANGE(level, 1, MAX_SKILL_COST_LEVEL + 2);
+    return breakpoints[level];
 }
 
-static const int MAX_SKILL_COST_LEVEL = 27;
-
 // skill_cost_level makes skills more expensive for more experienced characters
 int calc_skill_cost(int skill_cost_level)
 {
@@ -439,6 +476,10 @@ int calc_skill_level_change(skill_type sk, int starting_level, int sk_points)
 
 void check_skill_level_change(skill_type sk, bool do_level_up)
 {
+    // Skill points feed fractional skill queries (spell failure and
+    // power among others), so any change here outdates memoized values.
+    invalidate_derived_stats();
+
     const int new_level = calc_skill_level_change(sk, you.skills[sk], you.skill_points[sk]);
 
     if (new_level != you.skills[sk])
@@ -2669,7 +2710,24 @@ int skill_bump(skill_type skill, int scale, bool allow_random)
 
 float apt_to_factor(int apt)
 {
-    return 1 / exp(log(2) * apt / APT_DOUBLE);
+    // Tabulate the transcendental math: this is called for every skill on
+    // every level-change check. The range covers every aptitude in
+    // aptitudes.h (including the species_apt() sentinel) with room for
+    // the MUT_UNSKILLED penalty; anything outside computes directly.
+    static const int APT_TABLE_MIN = -24;
+    static const int APT_TABLE_MAX = 12;
+    static float factors[APT_TABLE_MAX - APT_TABLE_MIN + 1];
+    static bool factors_initialised = false;
+    if (!factors_initialised)
+    {
+        for (int i = APT_TABLE_MIN; i <= APT_TABLE_MAX; ++i)
+            factors[i - APT_TABLE_MIN] = 1 / exp(log(2) * i / APT_DOUBLE);
+        factors_initialised = true;
+    }
+
+    if (apt < APT_TABLE_MIN || apt > APT_TABLE_MAX)
+        return 1 / exp(log(2) * apt / APT_DOUBLE);
+    return factors[apt - APT_TABLE_MIN];
 }
 
 static int _modulo_skill_cost(int modulo_level)
@@ -2708,26 +2766,10 @@ unsigned int skill_exp_needed(int lev, skill_type sk, species_type sp)
 
 int species_apt(skill_type skill, species_type species)
 {
-    static bool spec_skills_initialised = false;
-
     if (skill >= NUM_SKILLS)
         return UNUSABLE_SKILL;
-    if (!spec_skills_initialised)
-    {
-        // Setup sentinel values to find errors more easily.
-        const int sentinel = -20; // this gives cost 3200
-        for (int sp = 0; sp < NUM_SPECIES; ++sp)
-            for (int sk = 0; sk < NUM_SKILLS; ++sk)
-                _spec_skills[sp][sk] = sentinel;
-        for (const species_skill_aptitude &ssa : species_skill_aptitudes)
-        {
-            ASSERT(_spec_skills[ssa.species][ssa.skill] == sentinel);
-            _spec_skills[ssa.species][ssa.skill] = ssa.aptitude;
-        }
-        spec_skills_initialised = true;
-    }
 
-    return max(UNUSABLE_SKILL, _spec_skills[species][skill]
+    return max(UNUSABLE_SKILL, _spec_skills.apt[species][skill]
                                - you.get_mutation_level(MUT_UNSKILLED));
 }
 
@@ -2736,26 +2778,35 @@ float species_apt_factor(skill_type sk, species_type sp)
     return apt_to_factor(species_apt(sk, sp));
 }
 
-vector<skill_type> get_crosstrain_skills(skill_type sk)
+const vector<skill_type>& get_crosstrain_skills(skill_type sk)
 {
+    // Returned by reference so that callers on the XP award path (via
+    // get_crosstrain_points) don't allocate a vector per query.
+    static const vector<skill_type> none;
+    static const vector<skill_type> short_blades = { SK_SHORT_BLADES };
+    static const vector<skill_type> long_blades  = { SK_LONG_BLADES };
+    static const vector<skill_type> axes_staves  = { SK_AXES, SK_STAVES };
+    static const vector<skill_type> maces_polearms = { SK_POLEARMS,
+                                                       SK_MACES_FLAILS };
+
     // Gnolls do not have crosstraining.
     if (you.has_mutation(MUT_DISTRIBUTED_TRAINING))
-        return {};
+        return none;
 
     switch (sk)
     {
     case SK_SHORT_BLADES:
-        return { SK_LONG_BLADES };
+        return long_blades;
     case SK_LONG_BLADES:
-        return { SK_SHORT_BLADES };
+        return short_blades;
     case SK_AXES:
     case SK_STAVES:
-        return { SK_POLEARMS, SK_MACES_FLAILS };
+        return maces_polearms;
     case SK_MACES_FLAILS:
     case SK_POLEARMS:
-        return { SK_AXES, SK_STAVES };
+        return axes_staves;
     default:
-        return {};
+        return none;
     }
 }
 
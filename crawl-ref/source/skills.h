@@ -128,7 +128,7 @@ unsigned int skill_exp_needed(int lev, skill_type sk,
 skill_diff skill_level_to_diffs(skill_type skill, double amount,
     int scaled_training=100, bool base_only=true);
 
-vector<skill_type> get_crosstrain_skills(skill_type sk);
+const vector<skill_type>& get_crosstrain_skills(skill_type sk);
 int get_crosstrain_points(skill_type sk);
 
 void skill_menu(int flag = 0, int exp = 0);
@@ -176,74 +176,60 @@ namespace species
         return get_species_def(species).monster_species;
     }
 
-    // XX non-draconians, unify with skin names?
-    const char* scale_type(species_type species)
+    // Per-colour draconian attributes, indexed by
+    // species - SP_FIRST_NONBASE_DRACONIAN.
+    struct draconian_attributes
+    {
+        const char* scale_name;
+        monster_type dragon;
+        ability_type breath;
+    };
+
+    static const draconian_attributes _draconian_attributes[] =
+    {
+        { "fiery red", MONS_FIRE_DRAGON, ABIL_COMBUSTION_BREATH },
+        { "icy white", MONS_ICE_DRAGON, ABIL_GLACIAL_BREATH },
+        { "mossy green", MONS_SWAMP_DRAGON, ABIL_NOXIOUS_BREATH },
+        { "lurid yellow", MONS_ACID_DRAGON, ABIL_CAUSTIC_BREATH },
+        { "dull grey", MONS_IRON_DRAGON, ABIL_MUD_BREATH },
+        { "glossy black", MONS_STORM_DRAGON, ABIL_GALVANIC_BREATH },
+        { "rich purple", MONS_QUICKSILVER_DRAGON, ABIL_NULLIFYING_BREATH },
+#if TAG_MAJOR_VERSION == 34
+        { "", MONS_GOLDEN_DRAGON, ABIL_NON_ABILITY }, // mottled
+#endif
+        { "pale cyan-grey", MONS_STEAM_DRAGON, ABIL_STEAM_BREATH },
+        { "plain brown", MONS_GOLDEN_DRAGON, ABIL_NON_ABILITY },
+    };
+    COMPILE_CHECK(ARRAYSZ(_draconian_attributes)
+                  == SP_BASE_DRACONIAN - SP_FIRST_NONBASE_DRACONIAN + 1);
+
+    static const draconian_attributes* _dragon_attrs(species_type species)
     {
-        switch (species)
+        if (species < SP_FIRST_NONBASE_DRACONIAN
+            || species > SP_BASE_DRACONIAN)
         {
-            case SP_RED_DRACONIAN:
-                return "fiery red";
-            case SP_WHITE_DRACONIAN:
-                return "icy white";
-            case SP_GREEN_DRACONIAN:
-                return "mossy green";
-            case SP_YELLOW_DRACONIAN:
-                return "lurid yellow";
-            case SP_GREY_DRACONIAN:
-                return "dull grey";
-            case SP_BLACK_DRACONIAN:
-                return "glossy black";
-            case SP_PURPLE_DRACONIAN:
-                return "rich purple";
-            case SP_PALE_DRACONIAN:
-                return "pale cyan-grey";
-            case SP_BASE_DRACONIAN:
-                return "plain brown";
-            default:
-                return "";
+            return nullptr;
         }
+        return &_draconian_attributes[species - SP_FIRST_NONBASE_DRACONIAN];
+    }
+
+    // XX non-draconians, unify with skin names?
+    const char* scale_type(species_type species)
+    {
+        const draconian_attributes* attrs = _dragon_attrs(species);
+        return attrs ? attrs->scale_name : "";
     }
 
     monster_type dragon_form(species_type s)
     {
-        switch (s)
-        {
-        case SP_WHITE_DRACONIAN:
-            return MONS_ICE_DRAGON;
-        case SP_GREEN_DRACONIAN:
-            return MONS_SWAMP_DRAGON;
-        case SP_YELLOW_DRACONIAN:
-            return MONS_ACID_DRAGON;
-        case SP_GREY_DRACONIAN:
-            return MONS_IRON_DRAGON;
-        case SP_BLACK_DRACONIAN:
-            return MONS_STORM_DRAGON;
-        case SP_PURPLE_DRACONIAN:
-            return MONS_QUICKSILVER_DRAGON;
-        case SP_PALE_DRACONIAN:
-            return MONS_STEAM_DRAGON;
-        case SP_RED_DRACONIAN:
-            return MONS_FIRE_DRAGON;
-        default:
-            return MONS_GOLDEN_DRAGON;
-        }
+        const draconian_attributes* attrs = _dragon_attrs(s);
+        return attrs ? attrs->dragon : MONS_GOLDEN_DRAGON;
     }
 
     ability_type draconian_breath(species_type species)
     {
-        switch (species)
-        {
-        case SP_GREEN_DRACONIAN:   return ABIL_NOXIOUS_BREATH;
-        case SP_RED_DRACONIAN:     return ABIL_COMBUSTION_BREATH;
-        case SP_WHITE_DRACONIAN:   return ABIL_GLACIAL_BREATH;
-        case SP_YELLOW_DRACONIAN:  return ABIL_CAUSTIC_BREATH;
-        case SP_BLACK_DRACONIAN:   return ABIL_GALVANIC_BREATH;
-        case SP_PURPLE_DRACONIAN:  return ABIL_NULLIFYING_BREATH;
-        case SP_PALE_DRACONIAN:    return ABIL_STEAM_BREATH;
-        case SP_GREY_DRACONIAN:    return ABIL_MUD_BREATH;
-        case SP_BASE_DRACONIAN:
-        default: return ABIL_NON_ABILITY;
-        }
+        const draconian_attributes* attrs = _dragon_attrs(species);
+        return attrs ? attrs->breath : ABIL_NON_ABILITY;
     }
 
     /// Does the species have (real) mutation `mut`? Not for demonspawn.
@@ -772,6 +758,9 @@ void change_species_to(species_type sp)
     you.prevailing_wind = -1;
     update_four_winds(true);
 
+    // The innate mutation arrays were rewritten wholesale above.
+    invalidate_derived_stats();
+
     calc_hp();
     calc_mp();
 
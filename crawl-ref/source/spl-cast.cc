@@ -452,11 +452,8 @@ static int _skill_power(spell_type spell)
  * @return          A failure rate. This is *not* a percentage - for a human-
  *                  readable version, call _get_true_fail_rate().
  */
-int raw_spell_fail(spell_type spell, bool enkindled)
+static int _raw_spell_fail_uncached(spell_type spell, bool enkindled)
 {
-    if (spell == SPELL_NO_SPELL)
-        return 10000;
-
     enkindled = (enkindled || (you.duration[DUR_ENKINDLED])
                     && spell_can_be_enkindled(spell));
 
@@ -539,15 +536,36 @@ int raw_spell_fail(spell_type spell, bool enkindled)
     return min(max(chance2, 0), 100);
 }
 
+// Failure and power are recomputed per spell per render of the spell
+// menu, the quiver line and the Z prompt, and each computation walks
+// armour, mutations and skill state. All of those inputs are covered by
+// the derived-stats version counter (see invalidate_derived_stats()),
+// so memoize against it the same way the resist queries do.
+static struct spell_calc_memo
+{
+    unsigned int fail_version[2]; // indexed by enkindled
+    int fail[2];
+    unsigned int power_version;
+    int power;
+} _spell_calc_memo[NUM_SPELLS];
 
-/*
- * Calculate spell power.
- *
- * @param spell         the spell to check
- *
- * @return the resulting spell power.
- */
-int calc_spell_power(spell_type spell)
+int raw_spell_fail(spell_type spell, bool enkindled)
+{
+    if (spell == SPELL_NO_SPELL)
+        return 10000;
+
+    ASSERT_RANGE(spell, 0, NUM_SPELLS);
+    spell_calc_memo &memo = _spell_calc_memo[spell];
+    const int e = enkindled ? 1 : 0;
+    if (memo.fail_version[e] != derived_stats_version())
+    {
+        memo.fail[e] = _raw_spell_fail_uncached(spell, enkindled);
+        memo.fail_version[e] = derived_stats_version();
+    }
+    return memo.fail[e];
+}
+
+static int _calc_spell_power_uncached(spell_type spell)
 {
     int power = _skill_power(spell);
 
@@ -600,6 +618,30 @@ int calc_spell_power(spell_type spell)
     return power;
 }
 
+/*
+ * Calculate spell power.
+ *
+ * @param spell         the spell to check
+ *
+ * @return the resulting spell power.
+ */
+int calc_spell_power(spell_type spell)
+{
+    // Divine Exegesis is a transient flag set around a single cast, not
+    // an input the derived-stats counter tracks.
+    if (you.divine_exegesis)
+        return _calc_spell_power_uncached(spell);
+
+    ASSERT_RANGE(spell, 0, NUM_SPELLS);
+    spell_calc_memo &memo = _spell_calc_memo[spell];
+    if (memo.power_version != derived_stats_version())
+    {
+        memo.power = _calc_spell_power_uncached(spell);
+        memo.power_version = derived_stats_version();
+    }
+    return memo.power;
+}
+
 static int _spell_enhancement(spell_type spell)
 {
     const spschools_type typeflags = get_spell_disciplines(spell);
@@ -83,16 +83,12 @@ struct spell_desc
 // to spelldata
 #include "spl-data.h"
 
-// spell_list is a static vector mapping spell_type enum values into positions
-// in spelldata. It is not initialized until game startup, so can't be relied
-// on in static constructors. (E.g., all spells register as invalid until
-// `init_spell_descs` has been run.)
-static vector<int> &_get_spell_list()
-{
-    // https://isocpp.org/wiki/faq/ctors#construct-on-first-use-v2
-    static vector<int> spell_list(NUM_SPELLS, -1);
-    return spell_list;
-}
+// _spell_descs maps spell_type enum values directly to their spelldata
+// entries, so property queries are a single indexed load. It is
+// zero-initialised before any static constructor runs and not filled in
+// until game startup, so all spells register as invalid until
+// `init_spell_descs` has been run.
+static const struct spell_desc *_spell_descs[NUM_SPELLS];
 
 #define SPELLDATASIZE ARRAYSZ(spelldata)
 
@@ -105,8 +101,6 @@ static const struct spell_desc *_seekspell(spell_type spellid);
 // All this does is merely refresh the internal spell list {dlb}:
 void init_spell_descs()
 {
-    vector<int> &spell_list = _get_spell_list();
-
     for (unsigned int i = 0; i < SPELLDATASIZE; i++)
     {
         const spell_desc &data = spelldata[i];
@@ -138,7 +132,7 @@ void init_spell_descs()
                 "spell '%s' is not declared as a monster spell but is not a player spell", data.title);
         }
 
-        spell_list[data.id] = i;
+        _spell_descs[data.id] = &data;
     }
 }
 
@@ -1009,16 +1003,16 @@ spschool skill2spell_type(skill_type spell_skill)
 static const spell_desc *_seekspell(spell_type spell)
 {
     ASSERT_RANGE(spell, 0, NUM_SPELLS);
-    const int index = _get_spell_list()[spell];
-    ASSERT(index != -1);
+    const spell_desc *desc = _spell_descs[spell];
+    ASSERT(desc != nullptr);
 
-    return &spelldata[index];
+    return desc;
 }
 
 bool is_valid_spell(spell_type spell)
 {
     return spell > SPELL_NO_SPELL && spell < NUM_SPELLS
-           && _get_spell_list()[spell] != -1;
+           && _spell_descs[spell] != nullptr;
 }
 
 int spell_power_cap(spell_type spell)
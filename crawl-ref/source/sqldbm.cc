@@ -119,6 +119,15 @@ From SQLite's documentation:
         return errc;
     }
 
+    // Read-only databases (the game's text and description stores) are
+    // immutable once built, so have SQLite access them through memory-mapped
+    // I/O instead of private heap buffers. The OS page cache then keeps a
+    // single copy of each database shared between every crawl process on the
+    // host, which matters for servers running dozens of games at once.
+    if (readonly)
+        sqlite3_exec(db, "PRAGMA mmap_size=67108864;", nullptr, nullptr,
+                     nullptr);
+
     init_schema();
     return errc;
 }
@@ -167,7 +167,7 @@ static void _fully_identify_item(item_def *item)
 // Stash
 // ----------------------------------------------------------------------
 
-Stash::Stash(coord_def pos_) : items()
+Stash::Stash(coord_def pos_) : items(), search_cache_valid(false)
 {
     // First, fix what square we're interested in
     if (pos_.origin())
@@ -253,6 +253,20 @@ static bool _grid_is_interesting(const coord_def& pos)
 
 void Stash::update()
 {
+    // No item or terrain change anywhere since we last looked at this
+    // square, so a rescan could only tell us the player stepped onto it.
+    // This runs for every stash in view on every show update, so the
+    // early exit is what keeps loot-dense levels from taxing each turn.
+    if (item_mark == item_change_mark()
+        && feat_mark == terrain_change_mark())
+    {
+        if (pos == you.pos())
+            visited = true;
+        return;
+    }
+    item_mark = item_change_mark();
+    feat_mark = terrain_change_mark();
+
     feat = DNGN_FLOOR;
     feat_desc = "";
     if (_grid_is_interesting(pos))
@@ -313,6 +327,8 @@ void Stash::update()
     visited = pos == you.pos()
               || !(stack_greed || glowing_greed || artefact_greed)
               || current_size <= previous_size && visited;
+
+    search_cache_valid = false;
 }
 
 // Returns the item name for a given item, with any appropriate
@@ -364,6 +380,90 @@ string Stash::feature_description() const
     return feat_desc;
 }
 
+// Split text into its lowercased alphanumeric tokens.
+static void _stash_tokenise(const string &text, set<string> &tokens)
+{
+    string current;
+    for (char c : text)
+    {
+        if (isaalnum(c))
+            current += toalower(c);
+        else if (!current.empty())
+        {
+            tokens.insert(current);
+            current.clear();
+        }
+    }
+    if (!current.empty())
+        tokens.insert(current);
+}
+
+// Break a search pattern into the lowercased tokens any match must contain,
+// or return an empty list (meaning "could match anything") if the pattern
+// uses regex or other special syntax and can't be decomposed safely.
+static vector<string> _pattern_required_tokens(const string &pattern)
+{
+    if (pattern.find_first_of("\\^$.|?*+()[]{}<>!&:=~") != string::npos)
+        return vector<string>();
+
+    set<string> tokens;
+    _stash_tokenise(pattern, tokens);
+    return vector<string>(tokens.begin(), tokens.end());
+}
+
+// Rebuild the cached per-item search text and the token index over it.
+void Stash::rebuild_search_cache() const
+{
+    search_text.clear();
+    search_names.clear();
+
+    set<string> tokens;
+    for (const item_def &item : items)
+    {
+        const string s   = stash_item_name(item);
+        const string ann = stash_annotate_item(STASH_LUA_SEARCH_ANNOTATE,
+                                               &item);
+        string haystack = ann + " " + s;
+        if (is_dumpable_artefact(item))
+            haystack += " " + chardump_desc(item);
+
+        _stash_tokenise(haystack, tokens);
+        search_text.push_back(haystack);
+        search_names.push_back(s);
+    }
+
+    if (feat != DNGN_FLOOR)
+        _stash_tokenise(feat_desc, tokens);
+
+    search_tokens.assign(tokens.begin(), tokens.end());
+    search_cache_valid = true;
+}
+
+// A cheap necessary condition for any pattern match in this stash: every
+// required token has to occur inside some indexed token, since the indexed
+// tokens are separated by non-alphanumerics a plain token can't span.
+bool Stash::may_contain_tokens(const vector<string> &tokens) const
+{
+    if (!search_cache_valid)
+        rebuild_search_cache();
+
+    for (const string &token : tokens)
+    {
+        bool found = false;
+        for (const string &indexed : search_tokens)
+        {
+            if (indexed.find(token) != string::npos)
+            {
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
+
 vector<stash_search_result> Stash::matches_search(
     const string &prefix, const base_pattern &search) const
 {
@@ -371,18 +471,17 @@ vector<stash_search_result> Stash::matches_search(
     if (empty())
         return results;
 
-    for (const item_def &item : items)
+    if (!search_cache_valid)
+        rebuild_search_cache();
+
+    for (size_t i = 0; i < items.size(); i++)
     {
-        const string s   = stash_item_name(item);
-        const string ann = stash_annotate_item(STASH_LUA_SEARCH_ANNOTATE, &item);
-        string haystack = prefix + " " + ann + " " + s;
-        if (is_dumpable_artefact(item))
-            haystack += " " + chardump_desc(item);
-        if (search.matches(haystack))
+        const item_def &item = items[i];
+        if (search.matches(prefix + " " + search_text[i]))
         {
             stash_search_result res;
             res.match_type = MATCH_ITEM;
-            res.match = s;
+            res.match = search_names[i];
             res.primary_sort = item.name(DESC_QUALNAME);
             res.item = item;
             results.push_back(res);
@@ -423,9 +522,11 @@ void Stash::_update_corpses(int rot_time)
         if (new_rot <= 0 && !mons_has_skeleton(item.mon_type))
         {
             items.erase(items.begin() + i);
+            search_cache_valid = false;
             continue;
         }
         item.stash_freshness = static_cast<short>(new_rot);
+        search_cache_valid = false;
     }
 }
 
@@ -436,6 +537,7 @@ void Stash::_update_identification()
         ash_id_item(items[i]);
         maybe_identify_base_type(items[i]);
     }
+    search_cache_valid = false;
 }
 
 void Stash::add_item(item_def &item, bool add_to_front)
@@ -562,6 +664,8 @@ void Stash::load(reader& inf)
 
         items.push_back(item);
     }
+
+    search_cache_valid = false;
 }
 
 ShopInfo::ShopInfo(const shop_struct& shop_)
@@ -850,8 +954,28 @@ void LevelStashes::get_matching_stashes(
         return;
     }
 
+    // Tokens every matching stash must contain. Those the level tag itself
+    // satisfies are satisfied everywhere here, so drop them; the rest let us
+    // skip most stashes on a token index lookup instead of running the
+    // pattern over their full item descriptions.
+    vector<string> tokens = _pattern_required_tokens(s);
+    if (!tokens.empty())
+    {
+        const string lplace_lc = lowercase_string(lplace);
+        tokens.erase(remove_if(tokens.begin(), tokens.end(),
+                               [&lplace_lc] (const string &token)
+                               {
+                                   return lplace_lc.find(token)
+                                          != string::npos;
+                               }),
+                     tokens.end());
+    }
+
     for (const auto &entry : m_stashes)
     {
+        if (!tokens.empty() && !entry.second.may_contain_tokens(tokens))
+            continue;
+
         vector<stash_search_result> new_results =
             entry.second.matches_search(lplace, search);
         for (auto &res : new_results)
@@ -60,6 +60,8 @@ private:
     void _update_corpses(int rot_time);
     void _update_identification();
     void add_item(item_def &item, bool add_to_front = false);
+    void rebuild_search_cache() const;
+    bool may_contain_tokens(const vector<string> &tokens) const;
 
 private:
     bool visited;      // Is this correct to the best of our knowledge?
@@ -69,6 +71,21 @@ private:
 
     vector<item_def> items;
 
+    // Lazily rebuilt search cache: the text matches_search() runs patterns
+    // over (one entry per item), the matching item names, and the token
+    // index extracted from both. Building these involves item naming and a
+    // Lua annotation hook per item, so it only happens for stashes that
+    // changed since the last search.
+    mutable bool search_cache_valid;
+    mutable vector<string> search_text;
+    mutable vector<string> search_names;
+    mutable vector<string> search_tokens;
+
+    // Counters this stash was last updated against; not saved, so the
+    // first update after a load always runs. See Stash::update().
+    unsigned item_mark = 0;
+    unsigned feat_mark = 0;
+
     static bool are_items_same(const item_def &, const item_def &,
                                bool exact = false);
 
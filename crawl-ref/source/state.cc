@@ -44,7 +44,8 @@ game_state::game_state()
       last_type(GAME_TYPE_UNSPECIFIED), last_game_exit(game_exit::unknown),
       marked_as_won(false), arena_suspended(false),
       generating_level(false), dump_maps(false), test(false), script(false),
-      build_db(false), use_des_cache(true), tests_selected(),
+      build_db(false), startup_report(false), use_des_cache(true),
+      tests_selected(),
 #ifdef DGAMELAUNCH
       throttle(true),
       bypassed_startup_menu(true),
@@ -54,7 +55,8 @@ game_state::game_state()
 #endif
       clua_max_memory_mb(16), show_more_prompt(true),
       skip_autofight_check(false), terminal_resize_handler(nullptr),
-      terminal_resize_check(nullptr), doing_prev_cmd_again(false),
+      terminal_resize_check(nullptr), turn_began_us(0),
+      doing_prev_cmd_again(false),
       prev_cmd(CMD_NO_CMD), repeat_cmd(CMD_NO_CMD),
       cmd_repeat_started_unsafe(false),
       lua_calls_no_turn(0), lua_script_killed(false),
@@ -87,6 +87,7 @@ struct game_state
     bool test_list;         // Show available tests and exit.
     bool script;            // Set if we want to run a Lua script and exit.
     bool build_db;          // Set if we want to rebuild the db and exit.
+    bool startup_report;    // Print startup phase timings once initialised.
     bool use_des_cache;
     vector<string> tests_selected; // Tests to be run.
     vector<string> script_args;    // Arguments to scripts.
@@ -112,6 +113,10 @@ struct game_state
     void (*terminal_resize_handler)();
     void (*terminal_resize_check)();
 
+    // Slow-turn watchdog: wall-clock time in microseconds at which the
+    // current world_reacts cycle began, or 0 outside one.
+    int64_t         turn_began_us;
+
     bool            doing_prev_cmd_again;
     command_type    prev_cmd;
     deque<int>      prev_cmd_keys;
@@ -192,6 +192,39 @@ static bool _fill_inf_from_ddef(duration_type dur, status_info& inf)
     return true;
 }
 
+// Status cache: fill_status_info results for every duration and status
+// type, rebuilt at most once per invalidation. The invalidation sites are
+// the same ones that set you.redraw_status_lights (one blanket set per
+// turn plus a handful of immediate state changes), so the cache tracks
+// status changes exactly as closely as the console HUD always has, while
+// the webtiles player update - which runs on every redraw tick - stops
+// re-querying gods, transformations and durations when nothing changed.
+static vector<status_info> _status_cache;
+static vector<bool> _status_active;
+static bool _status_cache_valid = false;
+
+void invalidate_status_cache()
+{
+    _status_cache_valid = false;
+    you.redraw_status_lights = true;
+}
+
+const status_info *cached_status_info(int status)
+{
+    ASSERT_RANGE(status, 0, STATUS_LAST_STATUS + 1);
+
+    if (!_status_cache_valid)
+    {
+        _status_cache.assign(STATUS_LAST_STATUS + 1, status_info());
+        _status_active.assign(STATUS_LAST_STATUS + 1, false);
+        for (int i = 0; i <= STATUS_LAST_STATUS; ++i)
+            _status_active[i] = fill_status_info(i, _status_cache[i]);
+        _status_cache_valid = true;
+    }
+
+    return _status_active[status] ? &_status_cache[status] : nullptr;
+}
+
 static void _describe_airborne(status_info& inf);
 static void _describe_glow(status_info& inf);
 static void _describe_regen(status_info& inf);
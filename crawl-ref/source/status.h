@@ -80,6 +80,15 @@ struct status_info
 // returns true if the status has a description
 bool fill_status_info(int status, status_info& info);
 
+// Returns the cached status_info for a duration or status_type, or
+// nullptr if that status is currently inactive. The cache is rebuilt
+// lazily after invalidate_status_cache(), so the HUD consumers (console,
+// tiles and webtiles) share one recomputation per turn instead of
+// re-querying every status on each refresh.
+const status_info *cached_status_info(int status);
+// Marks the status cache stale and queues a status light redraw.
+void invalidate_status_cache();
+
 const char *duration_name(duration_type dur);
 duration_type duration_by_name(const string &name);
 vector<duration_type> all_duration_with_flag(uint64_t flag);
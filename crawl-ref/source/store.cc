@@ -1243,10 +1243,13 @@ void CrawlHashTable::read(reader &th)
 
     for (unsigned int i = 0; i < _size; i++)
     {
-        string           key = unmarshallString(th);
-        CrawlStoreValue &val = (*this)[key];
+        string key = unmarshallString(th);
 
-        val.read(th);
+        // write() walks the map in key order, so keys arrive sorted: an
+        // end() hint turns each insertion into an O(1) append instead of
+        // a fresh tree descent, and moving the key saves a copy.
+        iterator it = emplace_hint(end(), std::move(key), CrawlStoreValue());
+        it->second.read(th);
     }
 
     ASSERT_VALIDITY();
@@ -1400,11 +1403,10 @@ void CrawlVector::write(writer &th) const
     marshallByte(th, static_cast<char>(type));
     marshallByte(th, (char) default_flags);
 
+    // Marshal in place: copying a CrawlStoreValue deep-copies items,
+    // monsters and nested tables, which is pure waste on every save.
     for (vec_size i = 0; i < size(); i++)
-    {
-        CrawlStoreValue val = vec[i];
-        val.write(th);
-    }
+        vec[i].write(th);
 
     ASSERT_VALIDITY();
 }
@@ -16,11 +16,13 @@
 # include <wincrypt.h>
 # include <io.h>
 #else
+# include <cerrno>
 # include <dirent.h>
 # include <unistd.h>
 # include <fcntl.h>
 # include <sys/types.h>
 # include <sys/stat.h>
+# include <sys/uio.h>
 #endif
 
 #include "files.h"
@@ -260,6 +262,66 @@ int fdatasync(int fd)
 # endif
 #endif
 
+#ifdef TARGET_OS_WINDOWS
+bool write_2v(int fd, off_t at, const void *a, size_t alen,
+              const void *b, size_t blen)
+{
+    if (lseek(fd, at, SEEK_SET) != at)
+        return false;
+    if (alen && write(fd, a, alen) != (ssize_t)alen)
+        return false;
+    if (blen && write(fd, b, blen) != (ssize_t)blen)
+        return false;
+    return true;
+}
+#else
+bool write_2v(int fd, off_t at, const void *a, size_t alen,
+              const void *b, size_t blen)
+{
+    if (lseek(fd, at, SEEK_SET) != at)
+        return false;
+
+    // pwritev would save the seek as well, but is missing on older OS X;
+    // writev is universal.
+    struct iovec iov[2];
+    iov[0].iov_base = const_cast<void*>(a);
+    iov[0].iov_len  = alen;
+    iov[1].iov_base = const_cast<void*>(b);
+    iov[1].iov_len  = blen;
+
+    int first = 0;
+    while (first < 2)
+    {
+        if (!iov[first].iov_len)
+        {
+            first++;
+            continue;
+        }
+        const ssize_t res = writev(fd, iov + first, 2 - first);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        // a short write: drop what went through and retry the rest
+        size_t done = res;
+        while (first < 2 && done >= iov[first].iov_len)
+        {
+            done -= iov[first].iov_len;
+            iov[first].iov_len = 0;
+            first++;
+        }
+        if (first < 2 && done)
+        {
+            iov[first].iov_base = (char*)iov[first].iov_base + done;
+            iov[first].iov_len -= done;
+        }
+    }
+    return true;
+}
+#endif
+
 // The old school way of doing short delays via low level I/O sync.
 // Good for systems like old versions of Solaris that don't have usleep.
 #ifndef CRAWL_HAVE_USLEEP
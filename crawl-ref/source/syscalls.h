@@ -32,6 +32,11 @@ bool jni_keyboard_control(int toggle);
 int fdatasync(int fd);
 #endif
 
+// Write two buffers back to back at the given file offset, as a single
+// vectored write where the platform supports it.
+bool write_2v(int fd, off_t at, const void *a, size_t alen,
+              const void *b, size_t blen);
+
 #ifndef CRAWL_HAVE_USLEEP
 void usleep(unsigned long time);
 #endif
@@ -349,6 +349,7 @@ enum tag_minor_version
     TAG_MINOR_TERRAIN_CHANGE_MID,  // Marshall terrain change origin mids as int instead of shorts
     TAG_MINOR_REFACTOR_MALIGN_MARKER,   // Refactor handling of map_malign_gateway_marker
     TAG_MINOR_REMOVE_MORTAR_MARKERS, // Remove map_hellfire_mortar_lava_marker and refactor again
+    TAG_MINOR_LAZY_SHOP_STOCK,     // Defer generic shop stocking to first entry
 #endif
     NUM_TAG_MINORS,
     TAG_MINOR_VERSION = NUM_TAG_MINORS - 1
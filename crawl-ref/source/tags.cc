@@ -150,6 +150,16 @@ void reader::close()
 
 void reader::advance(size_t offset)
 {
+    // File- and buffer-backed readers can seek (read() with a null buffer
+    // fseeks); map_def::load() relies on this to jump straight to a map
+    // body in the middle of the .dsc cache. Chunk readers decompress as
+    // they go, so they have to read and discard.
+    if (_file || _pbuf)
+    {
+        read(nullptr, offset);
+        return;
+    }
+
     char junk[128];
 
     while (offset)
@@ -175,8 +185,10 @@ static NORETURN void _short_read(bool safe_read)
     die_noline("short read while reading save");
 }
 
-// Reads input in network byte order, from a file or buffer.
-unsigned char reader::readByte()
+// Reads input in network byte order, from a file or chunk. Buffer-backed
+// readers only get here when past the end of the buffer: the inline fast
+// path in tags.h handles the in-bounds case.
+unsigned char reader::readByte_slow()
 {
     if (_file)
     {
@@ -193,14 +205,10 @@ unsigned char reader::readByte()
         return buf;
     }
     else
-    {
-        if (_read_offset >= _pbuf->size())
-            _short_read(_safe_read);
-        return (*_pbuf)[_read_offset++];
-    }
+        _short_read(_safe_read);
 }
 
-void reader::read(void *data, size_t size)
+void reader::read_slow(void *data, size_t size)
 {
     if (_file)
     {
@@ -218,14 +226,7 @@ void reader::read(void *data, size_t size)
             _short_read(_safe_read);
     }
     else
-    {
-        if (_read_offset+size > _pbuf->size())
-            _short_read(_safe_read);
-        if (data && size)
-            memcpy(data, &(*_pbuf)[_read_offset], size);
-
-        _read_offset += size;
-    }
+        _short_read(_safe_read);
 }
 
 int reader::getMinorVersion() const
@@ -260,33 +261,26 @@ void writer::check_ok(bool ok)
     }
 }
 
-void writer::writeByte(unsigned char ch)
+void writer::writeByte_slow(unsigned char ch)
 {
     if (failed)
         return;
 
     if (_chunk)
         _chunk->write(&ch, 1);
-    else if (_file)
-        check_ok(fputc(ch, _file) != EOF);
     else
-        _pbuf->push_back(ch);
+        check_ok(fputc(ch, _file) != EOF);
 }
 
-void writer::write(const void *data, size_t size)
+void writer::write_slow(const void *data, size_t size)
 {
     if (failed)
         return;
 
     if (_chunk)
         _chunk->write(data, size);
-    else if (_file)
-        check_ok(fwrite(data, 1, size, _file) == size);
     else
-    {
-        const unsigned char* cdata = static_cast<const unsigned char*>(data);
-        _pbuf->insert(_pbuf->end(), cdata, cdata+size);
-    }
+        check_ok(fwrite(data, 1, size, _file) == size);
 }
 
 long writer::tell()
@@ -2551,6 +2545,9 @@ static void marshall_shop(writer &th, const shop_struct& shop)
     marshallString(th, shop.shop_name);
     marshallString(th, shop.shop_type_name);
     marshallString(th, shop.shop_suffix_name);
+    marshallBoolean(th, shop.stocked);
+    marshallUnsigned(th, shop.stock_seed);
+    marshallUnsigned(th, shop.stock_seq);
     _marshall_iterator(th, shop.stock.begin(), shop.stock.end(),
                        bind(marshallItem, placeholders::_1, placeholders::_2,
                             false));
@@ -2582,6 +2579,19 @@ static void unmarshall_shop(reader &th, shop_struct& shop)
     shop.shop_type_name = unmarshallString(th);
     shop.shop_suffix_name = unmarshallString(th);
 #if TAG_MAJOR_VERSION == 34
+    if (th.getMinorVersion() >= TAG_MINOR_LAZY_SHOP_STOCK)
+    {
+#endif
+        shop.stocked = unmarshallBoolean(th);
+        shop.stock_seed = unmarshallUnsigned(th);
+        shop.stock_seq = unmarshallUnsigned(th);
+#if TAG_MAJOR_VERSION == 34
+    }
+    else
+    {
+        shop.stocked = true;
+        shop.stock_seed = shop.stock_seq = 0;
+    }
     if (th.getMinorVersion() < TAG_MINOR_SHOP_HACK)
         shop.stock.clear();
     else
@@ -5610,6 +5620,32 @@ static int _last_used_index(const Z &thinglist, int max_things)
 
 // ------------------------------- level tags ---------------------------- //
 
+// Helpers for the fixed-width grid sections of the level tags. The wire
+// format is identical to a run of marshallShort calls (16 bits each, network
+// order), but the whole grid goes through a single buffer operation instead
+// of two writeByte/readByte calls per field, which is a measurable win for
+// the GXM*GYM-sized spans below on level load.
+static void _marshall_raw_shorts(writer &th, const unsigned short *data,
+                                 size_t count)
+{
+    vector<unsigned char> span(count * 2);
+    for (size_t i = 0; i < count; i++)
+    {
+        span[i * 2]     = data[i] >> 8;
+        span[i * 2 + 1] = data[i] & 0xFF;
+    }
+    th.write(&span[0], span.size());
+}
+
+static void _unmarshall_raw_shorts(reader &th, unsigned short *data,
+                                   size_t count)
+{
+    vector<unsigned char> span(count * 2);
+    th.read(&span[0], span.size());
+    for (size_t i = 0; i < count; i++)
+        data[i] = (unsigned short)(span[i * 2] << 8 | span[i * 2 + 1]);
+}
+
 static void _tag_construct_level(writer &th)
 {
     marshallByte(th, env.floor_colour);
@@ -5686,8 +5722,11 @@ static void _tag_construct_level(writer &th)
     if (env.heightmap)
     {
         grid_heightmap &heightmap(*env.heightmap);
+        vector<unsigned short> heights;
+        heights.reserve(GXM * GYM);
         for (rectangle_iterator ri(0); ri; ++ri)
-            marshallShort(th, heightmap(*ri));
+            heights.push_back((unsigned short)heightmap(*ri));
+        _marshall_raw_shorts(th, &heights[0], heights.size());
     }
 
     CANARY;
@@ -7145,18 +7184,23 @@ void _tag_construct_level_tiles(writer &th)
     marshallShort(th, tile_env.default_flavour.floor);
     marshallShort(th, tile_env.default_flavour.special);
 
+    // The flavour grid is pure fixed-width data; write it as one raw span.
+    vector<unsigned short> flv_fields;
+    flv_fields.reserve(GXM * GYM * 7);
     for (int count_x = 0; count_x < GXM; count_x++)
         for (int count_y = 0; count_y < GYM; count_y++)
         {
-            marshallShort(th, tile_env.flv[count_x][count_y].wall_idx);
-            marshallShort(th, tile_env.flv[count_x][count_y].floor_idx);
-            marshallShort(th, tile_env.flv[count_x][count_y].feat_idx);
+            const tile_flavour &flv = tile_env.flv[count_x][count_y];
+            flv_fields.push_back(flv.wall_idx);
+            flv_fields.push_back(flv.floor_idx);
+            flv_fields.push_back(flv.feat_idx);
 
-            marshallShort(th, tile_env.flv[count_x][count_y].wall);
-            marshallShort(th, tile_env.flv[count_x][count_y].floor);
-            marshallShort(th, tile_env.flv[count_x][count_y].feat);
-            marshallShort(th, tile_env.flv[count_x][count_y].special);
+            flv_fields.push_back(flv.wall);
+            flv_fields.push_back(flv.floor);
+            flv_fields.push_back(flv.feat);
+            flv_fields.push_back(flv.special);
         }
+    _marshall_raw_shorts(th, &flv_fields[0], flv_fields.size());
 
     marshallInt(th, TILE_WALL_MAX);
 }
@@ -7452,8 +7496,11 @@ static void _tag_read_level(reader &th)
     {
         env.heightmap.reset(new grid_heightmap);
         grid_heightmap &heightmap(*env.heightmap);
+        vector<unsigned short> heights(GXM * GYM);
+        _unmarshall_raw_shorts(th, &heights[0], heights.size());
+        const unsigned short *hp = &heights[0];
         for (rectangle_iterator ri(0); ri; ++ri)
-            heightmap(*ri) = unmarshallShort(th);
+            heightmap(*ri) = (short)*hp++;
     }
 
     EAT_CANARY;
@@ -8224,6 +8271,12 @@ static void _tag_read_level_monsters(reader &th)
 #endif
         env.mgrid(m.pos()) = i;
     }
+
+    env.live_mon_slots.clear();
+    for (int i = 0; i < count; i++)
+        if (env.mons[i].defined())
+            env.live_mon_slots.push_back(i);
+
 #if TAG_MAJOR_VERSION == 34
     // This relies on TAG_YOU (including lost monsters) being unmarshalled
     // on game load before the initial level.
@@ -8311,18 +8364,24 @@ void _tag_read_level_tiles(reader &th)
     tile_env.default_flavour.floor     = unmarshallShort(th);
     tile_env.default_flavour.special   = unmarshallShort(th);
 
+    // The flavour grid is one raw span of 16-bit fields, byte-identical to
+    // the per-field loop this replaced, so it can be slurped in bulk from
+    // saves of any minor version.
+    vector<unsigned short> flv_fields(gx * gy * 7);
+    _unmarshall_raw_shorts(th, &flv_fields[0], flv_fields.size());
+    const unsigned short *fp = &flv_fields[0];
     for (int x = 0; x < gx; x++)
         for (int y = 0; y < gy; y++)
         {
-            tile_env.flv[x][y].wall_idx  = unmarshallShort(th);
-            tile_env.flv[x][y].floor_idx = unmarshallShort(th);
-            tile_env.flv[x][y].feat_idx  = unmarshallShort(th);
+            tile_env.flv[x][y].wall_idx  = *fp++;
+            tile_env.flv[x][y].floor_idx = *fp++;
+            tile_env.flv[x][y].feat_idx  = *fp++;
 
             // These get overwritten by _regenerate_tile_flavour
-            tile_env.flv[x][y].wall    = unmarshallShort(th);
-            tile_env.flv[x][y].floor   = unmarshallShort(th);
-            tile_env.flv[x][y].feat    = unmarshallShort(th);
-            tile_env.flv[x][y].special = unmarshallShort(th);
+            tile_env.flv[x][y].wall    = *fp++;
+            tile_env.flv[x][y].floor   = *fp++;
+            tile_env.flv[x][y].feat    = *fp++;
+            tile_env.flv[x][y].special = *fp++;
         }
 
     _debug_count_tiles();
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstdio>
+#include <cstring>
 #include <vector>
 
 #include "bitary.h"
@@ -71,13 +72,36 @@ public:
 
     ~writer() { if (_chunk) delete _chunk; }
 
-    void writeByte(unsigned char byte);
-    void write(const void *data, size_t size);
+    // Fast path: marshalling into a memory buffer (as tag_write does for
+    // every save chunk) is just an inlined push_back. File and chunk
+    // backends take the out-of-line path. Buffer-backed writers can't fail,
+    // so `failed` needs no check here.
+    void writeByte(unsigned char byte)
+    {
+        if (_pbuf)
+            _pbuf->push_back(byte);
+        else
+            writeByte_slow(byte);
+    }
+
+    void write(const void *data, size_t size)
+    {
+        if (_pbuf)
+        {
+            const unsigned char* cdata = static_cast<const unsigned char*>(data);
+            _pbuf->insert(_pbuf->end(), cdata, cdata + size);
+        }
+        else
+            write_slow(data, size);
+    }
+
     long tell();
 
     bool succeeded() const { return !failed; }
 
 private:
+    void writeByte_slow(unsigned char byte);
+    void write_slow(const void *data, size_t size);
     void check_ok(bool ok);
 
 private:
@@ -125,8 +149,28 @@ public:
            int minorVersion = TAG_MINOR_INVALID);
     ~reader();
 
-    unsigned char readByte();
-    void read(void *data, size_t size);
+    // Fast path: bounds-checked reads straight out of the memory buffer
+    // (tag_read slurps each chunk into one before unmarshalling). File and
+    // chunk backends, and the past-the-end case, take the out-of-line path.
+    unsigned char readByte()
+    {
+        if (_pbuf && _read_offset < _pbuf->size())
+            return (*_pbuf)[_read_offset++];
+        return readByte_slow();
+    }
+
+    void read(void *data, size_t size)
+    {
+        if (_pbuf && size <= _pbuf->size() - _read_offset)
+        {
+            if (data && size)
+                memcpy(data, &(*_pbuf)[_read_offset], size);
+            _read_offset += size;
+        }
+        else
+            read_slow(data, size);
+    }
+
     void advance(size_t size);
     int getMinorVersion() const;
     void setMinorVersion(int minorVersion);
@@ -138,6 +182,10 @@ public:
 
     void set_safe_read(bool setting) { _safe_read = setting; }
 
+private:
+    unsigned char readByte_slow();
+    void read_slow(void *data, size_t size);
+
 private:
     string _filename;
     FILE* _file;
@@ -192,7 +192,9 @@ targeter_beam::targeter_beam(const actor *act, int r, zap_type zap,
                                int pow, int min_ex_rad, int max_ex_rad) :
                                min_expl_rad(min_ex_rad),
                                max_expl_rad(max_ex_rad),
-                               range(r)
+                               range(r),
+                               memo_aim(-1, -1), memo_result(false),
+                               memo_terrain_mark(0), memo_actor_mark(0)
 {
     ASSERT(act);
     ASSERT(min_ex_rad >= 0);
@@ -215,8 +217,21 @@ targeter_beam::targeter_beam(const actor *act, int r, zap_type zap,
 
 bool targeter_beam::set_aim(coord_def a)
 {
+    // The targeting UI re-aims at the unchanged cell on every redraw
+    // (mouse jitter, webtiles repaints); reuse the last tracer result
+    // unless something moved in the meantime.
+    if (a == memo_aim
+        && memo_terrain_mark == terrain_change_mark()
+        && memo_actor_mark == actor_position_mark())
+    {
+        return memo_result;
+    }
+    memo_aim = a;
+    memo_terrain_mark = terrain_change_mark();
+    memo_actor_mark = actor_position_mark();
+
     if (!targeter::set_aim(a))
-        return false;
+        return memo_result = false;
 
     bolt tempbeam = beam;
 
@@ -228,7 +243,7 @@ bool targeter_beam::set_aim(coord_def a)
     if (max_expl_rad > 0)
         set_explosion_aim(beam);
 
-    return true;
+    return memo_result = true;
 }
 
 void targeter_beam::set_explosion_aim(bolt tempbeam)
@@ -412,7 +427,9 @@ targeter_smite::targeter_smite(const actor* act, int ran,
     exp_range_min(exp_min), exp_range_max(exp_max), range(ran),
     cannot_harm_player(harmless_to_player), affects_walls(wall_ok),
     can_target_monsters(monster_ok),
-    affects_pos(affects_pos_func)
+    affects_pos(affects_pos_func),
+    memo_aim(-1, -1), memo_result(false),
+    memo_terrain_mark(0), memo_actor_mark(0)
 {
     ASSERT(act);
     ASSERT(exp_min >= 0);
@@ -450,8 +467,20 @@ bool targeter_smite::valid_aim(coord_def a)
 
 bool targeter_smite::set_aim(coord_def a)
 {
+    // As in targeter_beam::set_aim(), skip recomputing the explosion
+    // maps when a UI redraw re-aims at the same cell.
+    if (a == memo_aim
+        && memo_terrain_mark == terrain_change_mark()
+        && memo_actor_mark == actor_position_mark())
+    {
+        return memo_result;
+    }
+    memo_aim = a;
+    memo_terrain_mark = terrain_change_mark();
+    memo_actor_mark = actor_position_mark();
+
     if (!targeter::set_aim(a))
-        return false;
+        return memo_result = false;
 
     if (exp_range_max > 0)
     {
@@ -470,7 +499,7 @@ bool targeter_smite::set_aim(coord_def a)
                     exp_range_max, true, true);
         }
     }
-    return true;
+    return memo_result = true;
 }
 
 bool targeter_smite::can_affect_outside_range()
@@ -87,6 +87,10 @@ protected:
 private:
     bool penetrates_targets;
     explosion_map exp_map_min, exp_map_max;
+    // Memo of the last set_aim() call; see target.cc.
+    coord_def memo_aim;
+    bool memo_result;
+    unsigned memo_terrain_mark, memo_actor_mark;
 };
 
 class targeter_view : public targeter
@@ -121,6 +125,10 @@ private:
     bool affects_walls;
     bool can_target_monsters;
     bool (*affects_pos)(const coord_def &);
+    // Memo of the last set_aim() call; see target.cc.
+    coord_def memo_aim;
+    bool memo_result;
+    unsigned memo_terrain_mark, memo_actor_mark;
 };
 
 class targeter_permafrost : public targeter_smite
@@ -70,6 +70,25 @@ actor* actor_at(const coord_def& c)
     return monster_at(c);
 }
 
+/**
+ * Define a memoized function from dungeon_feature_type to bool.
+ * This macro should be followed by the non-memoized version of the
+ * function body: see feat_is_branch_entrance below for an example.
+ *
+ * @param funcname The name of the function to define.
+ * @param paramname The name under which the function's single parameter,
+ *        of type dungeon_feature_type, is visible in the function body.
+ */
+#define FEATFN_MEMOIZED(funcname, paramname) \
+    static bool _raw_ ## funcname (dungeon_feature_type); \
+    bool funcname (dungeon_feature_type feat) \
+    { \
+        static int cached[NUM_FEATURES+1] = { 0 }; \
+        if (!cached[feat]) cached[feat] = _raw_ ## funcname (feat) ? 1 : -1; \
+        return cached[feat] > 0; \
+    } \
+    static bool _raw_ ## funcname (dungeon_feature_type paramname)
+
 /** Can a malign gateway be placed on this feature?
  */
 bool feat_is_malign_gateway_suitable(dungeon_feature_type feat)
@@ -119,7 +138,7 @@ bool feat_is_stone_stair(dungeon_feature_type feat)
 
 /** Is it possible to call this feature a staircase? (purely cosmetic)
  */
-bool feat_is_staircase(dungeon_feature_type feat)
+FEATFN_MEMOIZED(feat_is_staircase, feat)
 {
     if (feat_is_stone_stair(feat))
         return true;
@@ -157,25 +176,6 @@ bool feat_is_hell_subbranch_exit(dungeon_feature_type feat)
     return cached[feat];
 }
 
-/**
- * Define a memoized function from dungeon_feature_type to bool.
- * This macro should be followed by the non-memoized version of the
- * function body: see feat_is_branch_entrance below for an example.
- *
- * @param funcname The name of the function to define.
- * @param paramname The name under which the function's single parameter,
- *        of type dungeon_feature_type, is visible in the function body.
- */
-#define FEATFN_MEMOIZED(funcname, paramname) \
-    static bool _raw_ ## funcname (dungeon_feature_type); \
-    bool funcname (dungeon_feature_type feat) \
-    { \
-        static int cached[NUM_FEATURES+1] = { 0 }; \
-        if (!cached[feat]) cached[feat] = _raw_ ## funcname (feat) ? 1 : -1; \
-        return cached[feat] > 0; \
-    } \
-    static bool _raw_ ## funcname (dungeon_feature_type paramname)
-
 /** Is this feature a branch entrance that should show up on ^O?
  */
 FEATFN_MEMOIZED(feat_is_branch_entrance, feat)
@@ -268,14 +268,14 @@ bool feat_is_portal(dungeon_feature_type feat)
 
 /** Is this feature a kind of level exit?
  */
-bool feat_is_stair(dungeon_feature_type gridc)
+FEATFN_MEMOIZED(feat_is_stair, gridc)
 {
     return feat_is_travelable_stair(gridc) || feat_is_gate(gridc);
 }
 
 /** Is this feature a level exit stair with a consistent endpoint?
  */
-bool feat_is_travelable_stair(dungeon_feature_type feat)
+FEATFN_MEMOIZED(feat_is_travelable_stair, feat)
 {
     return feat_is_stone_stair(feat)
            || feat_is_escape_hatch(feat)
@@ -294,7 +294,7 @@ bool feat_is_escape_hatch(dungeon_feature_type feat)
 /** Is this feature a gate?
   * XXX: Why does this matter??
  */
-bool feat_is_gate(dungeon_feature_type feat)
+FEATFN_MEMOIZED(feat_is_gate, feat)
 {
     if (feat_is_portal_entrance(feat)
         || feat_is_portal_exit(feat)
@@ -435,14 +435,14 @@ bool feat_has_dry_floor(dungeon_feature_type feat)
 
 /** Is this feature a variety of door?
  */
-bool feat_is_door(dungeon_feature_type feat)
+FEATFN_MEMOIZED(feat_is_door, feat)
 {
     return feat_is_closed_door(feat) || feat_is_open_door(feat);
 }
 
 /** Is this feature a variety of closed door?
  */
-bool feat_is_closed_door(dungeon_feature_type feat)
+FEATFN_MEMOIZED(feat_is_closed_door, feat)
 {
     return feat == DNGN_CLOSED_DOOR
            || feat == DNGN_CLOSED_CLEAR_DOOR
@@ -453,7 +453,7 @@ bool feat_is_closed_door(dungeon_feature_type feat)
 
 /** Is this feature a variety of open door?
  */
-bool feat_is_open_door(dungeon_feature_type feat)
+FEATFN_MEMOIZED(feat_is_open_door, feat)
 {
     return feat == DNGN_OPEN_DOOR
         || feat == DNGN_OPEN_CLEAR_DOOR
@@ -719,7 +719,7 @@ bool feat_is_food(dungeon_feature_type feat)
 
 /** Is this feature non-solid enough that you can reach past it?
  */
-bool feat_is_reachable_past(dungeon_feature_type feat)
+FEATFN_MEMOIZED(feat_is_reachable_past, feat)
 {
     return !feat_is_opaque(feat)
         && !feat_is_wall(feat)
@@ -1331,6 +1331,8 @@ static void _current_terrain_changed(coord_def pos,
     if (feat_is_wall(nfeat) && monster_at(pos))
         push_or_teleport_actor_from(pos);
 
+    travel_invalidate_distance_cache();
+
     _dgn_check_terrain_covering(pos, env.grid(pos), nfeat);
 
     if (nfeat != DNGN_UNSEEN)
@@ -1992,8 +1994,60 @@ const char* feat_type_name(dungeon_feature_type feat)
     return "floor";
 }
 
+// Bumped whenever a cell's feature changes, so caches derived from the
+// terrain grid (travel distances, monster reachability regions) can tell
+// whether they are still current without watching every mutation site.
+//
+// Alongside the counter we keep a short log of the changed cells, indexed
+// by counter value: a cache that remembered the counter at mark M can ask
+// terrain_changes_since(M) for exactly the cells touched since and patch
+// itself incrementally, falling back to a full rebuild only when the log
+// has been overtaken (a burst of changes, or a level change).
+static unsigned _terrain_change_mark = 0;
+static unsigned _terrain_change_log_base = 0;
+static vector<coord_def> _terrain_change_log;
+static level_id _terrain_change_level;
+
+static const size_t MAX_TERRAIN_CHANGE_LOG = 128;
+
+unsigned terrain_change_mark()
+{
+    return _terrain_change_mark;
+}
+
+bool terrain_changes_since(unsigned mark, vector<coord_def> &out)
+{
+    if (mark == _terrain_change_mark)
+        return true;
+
+    if (mark < _terrain_change_log_base || mark > _terrain_change_mark
+        || _terrain_change_level != level_id::current())
+    {
+        return false;
+    }
+
+    for (unsigned i = mark; i < _terrain_change_mark; i++)
+        out.push_back(_terrain_change_log[i - _terrain_change_log_base]);
+    return true;
+}
+
 void set_terrain_changed(const coord_def p)
 {
+    if (_terrain_change_level != level_id::current())
+    {
+        _terrain_change_log.clear();
+        _terrain_change_log_base = _terrain_change_mark;
+        _terrain_change_level = level_id::current();
+    }
+
+    _terrain_change_log.push_back(p);
+    _terrain_change_mark++;
+    if (_terrain_change_log.size() > MAX_TERRAIN_CHANGE_LOG)
+    {
+        _terrain_change_log.erase(_terrain_change_log.begin());
+        _terrain_change_log_base++;
+    }
+
     if (cell_is_solid(p))
         delete_cloud(p);
 
@@ -154,6 +154,12 @@ vector<string> dungeon_feature_matches(const string &name);
 const char *dungeon_feature_name(dungeon_feature_type rfeat);
 void destroy_wall(const coord_def& p);
 void set_terrain_changed(const coord_def c);
+unsigned terrain_change_mark();
+// Appends the cells changed on the current level since `mark` (an earlier
+// return value of terrain_change_mark()) to `out`. Returns false without
+// touching `out` if the change log no longer reaches back that far; the
+// caller must then rebuild from the grid.
+bool terrain_changes_since(unsigned mark, vector<coord_def> &out);
 bool cell_triggers_conduct(const coord_def pos);
 bool is_boring_terrain(dungeon_feature_type feat);
 
@@ -150,6 +150,46 @@ tileidx_t tile_fg_store::operator=(tileidx_t tile)
 /////////////////////////////////////////////////////////////////////////////
 // mcache_manager
 
+// How many unreferenced entries to keep around in the hope of reusing them;
+// beyond this the least recently used are evicted. Entries referenced from a
+// backstore (out-of-sight monsters) are never evicted.
+static const unsigned int MAX_UNREF_ENTRIES = 64;
+
+// Two cache entries that draw identically are interchangeable. Equality is
+// defined through the rendering interface (draw info, doll, transparency)
+// rather than per subclass, so new entry types dedup for free.
+static bool _entries_match(const mcache_entry *a, const mcache_entry *b)
+{
+    if (a->transparent() != b->transparent())
+        return false;
+
+    const dolls_data *doll_a = a->doll();
+    const dolls_data *doll_b = b->doll();
+    if (!doll_a != !doll_b)
+        return false;
+    if (doll_a && *doll_a != *doll_b)
+        return false;
+
+    tile_draw_info dinfo_a[mcache_entry::MAX_INFO_COUNT];
+    tile_draw_info dinfo_b[mcache_entry::MAX_INFO_COUNT];
+    const int count_a = a->info(dinfo_a);
+    const int count_b = b->info(dinfo_b);
+    if (count_a != count_b)
+        return false;
+
+    for (int i = 0; i < count_a; i++)
+    {
+        if (dinfo_a[i].idx != dinfo_b[i].idx
+            || dinfo_a[i].ofs_x != dinfo_b[i].ofs_x
+            || dinfo_a[i].ofs_y != dinfo_b[i].ofs_y)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 mcache_manager::~mcache_manager()
 {
     clear_all();
@@ -157,9 +197,6 @@ mcache_manager::~mcache_manager()
 
 unsigned int mcache_manager::register_monster(const monster_info& minf)
 {
-    // TODO enne - is it worth it to search against all mcache entries?
-    // TODO enne - pool mcache types to avoid too much alloc/dealloc?
-
     mcache_entry *entry;
 
     if (minf.props.exists(MONSTER_TILE_KEY))
@@ -184,42 +221,73 @@ unsigned int mcache_manager::register_monster(const monster_info& minf)
     else
         return 0;
 
-    tileidx_t idx = ~0;
-
+    // Reuse an existing entry that draws identically rather than
+    // accumulating duplicates; most registrations are for monsters that
+    // were already on screen at the last redraw.
     for (unsigned int i = 0; i < m_entries.size(); i++)
     {
-        if (!m_entries[i])
+        if (m_entries[i] && _entries_match(m_entries[i], entry))
         {
-            m_entries[i] = entry;
-            idx = i;
-            break;
+            delete entry;
+            m_entries[i]->set_last_used(++m_use_counter);
+            return TILEP_MCACHE_START + i;
         }
     }
 
-    if (idx > m_entries.size())
+    unsigned int idx;
+    if (!m_free_slots.empty())
+    {
+        idx = m_free_slots.back();
+        m_free_slots.pop_back();
+        m_entries[idx] = entry;
+    }
+    else
     {
         idx = m_entries.size();
         m_entries.push_back(entry);
     }
+    entry->set_last_used(++m_use_counter);
 
     return TILEP_MCACHE_START + idx;
 }
 
 void mcache_manager::clear_nonref()
 {
-    for (mcache_entry *&entry : m_entries)
-    {
-        if (!entry || entry->ref_count() > 0)
-            continue;
+    // Unreferenced entries, most recently used first.
+    vector<unsigned int> unref;
+    for (unsigned int i = 0; i < m_entries.size(); i++)
+        if (m_entries[i] && m_entries[i]->ref_count() <= 0)
+            unref.push_back(i);
 
-        delete entry;
-        entry = nullptr;
+    if (unref.size() <= MAX_UNREF_ENTRIES)
+        return;
+
+    sort(unref.begin(), unref.end(),
+         [this](unsigned int a, unsigned int b)
+         {
+             return m_entries[a]->last_used() > m_entries[b]->last_used();
+         });
+
+    for (unsigned int i = MAX_UNREF_ENTRIES; i < unref.size(); i++)
+    {
+        delete m_entries[unref[i]];
+        m_entries[unref[i]] = nullptr;
     }
+
+    // Let the table shrink again once its tail is free.
+    while (!m_entries.empty() && !m_entries.back())
+        m_entries.pop_back();
+
+    m_free_slots.clear();
+    for (unsigned int i = 0; i < m_entries.size(); i++)
+        if (!m_entries[i])
+            m_free_slots.push_back(i);
 }
 
 void mcache_manager::clear_all()
 {
     deleteAll(m_entries);
+    m_free_slots.clear();
 }
 
 mcache_entry *mcache_manager::get(tileidx_t tile)
@@ -232,6 +300,8 @@ mcache_entry *mcache_manager::get(tileidx_t tile)
         return nullptr;
 
     mcache_entry *entry = m_entries[idx - TILEP_MCACHE_START];
+    if (entry)
+        entry->set_last_used(++m_use_counter);
     return entry;
 }
 
@@ -34,13 +34,17 @@ public:
 class mcache_entry
 {
 public:
-    mcache_entry() : m_ref_count(0) {}
+    mcache_entry() : m_ref_count(0), m_last_used(0) {}
     virtual ~mcache_entry() {}
 
     void inc_ref() { m_ref_count++; }
     void dec_ref() { m_ref_count--; if (m_ref_count < 0) m_ref_count = 0; }
     int ref_count() { return m_ref_count; }
 
+    // LRU bookkeeping, maintained by the mcache_manager.
+    void set_last_used(int stamp) { m_last_used = stamp; }
+    int last_used() const { return m_last_used; }
+
     enum
     {
         // The maximum number of values written in the info function.
@@ -57,6 +61,9 @@ protected:
 
     // ref count in backstore
     int m_ref_count;
+
+    // use stamp from the manager's counter
+    int m_last_used;
 };
 
 class mcache_manager
@@ -74,6 +81,8 @@ public:
 
 protected:
     vector<mcache_entry*> m_entries;
+    vector<unsigned int> m_free_slots;
+    int m_use_counter = 0;
 };
 
 // The global monster cache.
@@ -132,7 +132,7 @@ tileidx_t tileidx_shop(const shop_struct *shop)
     }
 }
 
-tileidx_t tileidx_feature_base(dungeon_feature_type feat)
+static tileidx_t _tileidx_feature_base_build(dungeon_feature_type feat)
 {
     switch (feat)
     {
@@ -555,6 +555,29 @@ tileidx_t tileidx_feature_base(dungeon_feature_type feat)
     }
 }
 
+tileidx_t tileidx_feature_base(dungeon_feature_type feat)
+{
+    // This runs for every visible cell on every redraw, so resolve the
+    // mapping through a direct table built from the switch above on first
+    // use rather than re-walking the switch each time.
+    static tileidx_t feat_tiles[NUM_FEATURES];
+    static bool initialised = false;
+
+    if (!initialised)
+    {
+        for (int f = 0; f < NUM_FEATURES; ++f)
+        {
+            feat_tiles[f] =
+                _tileidx_feature_base_build(static_cast<dungeon_feature_type>(f));
+        }
+        initialised = true;
+    }
+
+    if (feat < 0 || feat >= NUM_FEATURES)
+        return TILE_DNGN_ERROR;
+    return feat_tiles[feat];
+}
+
 bool is_torch_tile(tileidx_t tile)
 {
     return tile == TILE_WALL_BRICK_DARK_2_TORCH
@@ -2531,6 +2554,13 @@ static tileidx_t _tileidx_monster_no_props(const monster_info& mon)
 
 tileidx_t tileidx_monster(const monster_info& mons)
 {
+    // The full derivation below (base tile variation, equipment checks,
+    // status and threat overlays) produces the same answer until the
+    // monster_info is rebuilt, which only happens when the underlying
+    // monster changes; remember it rather than redoing it per frame.
+    if (mons.tile_memo_set)
+        return mons.tile_memo;
+
     tileidx_t ch = _tileidx_monster_no_props(mons);
 
     if ((mons.airborne() && !_tentacle_tile_not_flying(ch))
@@ -2679,6 +2709,8 @@ tileidx_t tileidx_monster(const monster_info& mons)
     }
 #endif
 
+    mons.tile_memo = ch;
+    mons.tile_memo_set = true;
     return ch;
 }
 #endif
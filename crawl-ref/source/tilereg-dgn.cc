@@ -38,6 +38,7 @@
 #include "rltiles/tiledef-icons.h"
 #include "rltiles/tiledef-main.h"
 #include "tag-version.h"
+#include "tile-flags.h"
 #include "tilefont.h"
 #include "tilepick.h"
 #include "tiles-build-specific.h"
@@ -90,13 +91,118 @@ DungeonRegion::~DungeonRegion()
 {
 }
 
+// packed_cell::operator== is no use for frame comparison: map_cell
+// equality is currently pointer identity, so two copies never compare
+// equal. This compares the fields the packing code actually draws from,
+// including ones operator== predates (icons, summoner highlight, flavour).
+static bool _packed_cells_equal(const packed_cell &a, const packed_cell &b)
+{
+    if (a.fg != b.fg || a.bg != b.bg || a.cloud != b.cloud)
+        return false;
+
+    if (a.halo != b.halo
+        || a.quad_glow != b.quad_glow
+        || a.old_blood != b.old_blood
+        || a.is_highlighted_summoner != b.is_highlighted_summoner
+        || a.is_bloody != b.is_bloody
+        || a.is_silenced != b.is_silenced
+        || a.is_sanctuary != b.is_sanctuary
+        || a.is_blasphemy != b.is_blasphemy
+        || a.is_liquefied != b.is_liquefied
+        || a.mangrove_water != b.mangrove_water
+        || a.awakened_forest != b.awakened_forest
+        || a.has_bfb_corpse != b.has_bfb_corpse
+        || a.orb_glow != b.orb_glow
+        || a.blood_rotation != b.blood_rotation
+        || a.travel_trail != b.travel_trail
+        || a.disjunct != b.disjunct)
+    {
+        return false;
+    }
+
+    if (a.flv.floor != b.flv.floor || a.flv.special != b.flv.special)
+        return false;
+
+    if (a.num_dngn_overlay != b.num_dngn_overlay)
+        return false;
+    for (int i = 0; i < a.num_dngn_overlay; ++i)
+        if (a.dngn_overlay[i] != b.dngn_overlay[i])
+            return false;
+
+    if (a.icons != b.icons)
+        return false;
+
+    // The only map knowledge read while packing is the spell on a
+    // parchment, for its school overlay.
+    const tileidx_t fg_idx = a.fg & TILE_FLAG_MASK;
+    if (fg_idx >= TILE_PARCHMENT_LOW && fg_idx <= TILE_PARCHMENT_HIGH)
+    {
+        const item_def *item_a = a.map_knowledge.item();
+        const item_def *item_b = b.map_knowledge.item();
+        if (!item_a != !item_b || (item_a && item_a->plus != item_b->plus))
+            return false;
+    }
+
+    return true;
+}
+
+static bool _vbufs_equal(const crawl_view_buffer &a,
+                         const crawl_view_buffer &b)
+{
+    if (a.empty() || a.size() != b.size())
+        return false;
+
+    const screen_cell_t *cell_a = a;
+    const screen_cell_t *cell_b = b;
+    const int count = a.size().x * a.size().y;
+    for (int i = 0; i < count; ++i)
+    {
+        if (cell_a[i].glyph != cell_b[i].glyph
+            || cell_a[i].colour != cell_b[i].colour
+            || cell_a[i].flash_colour != cell_b[i].flash_colour
+            || cell_a[i].flash_alpha != cell_b[i].flash_alpha
+            || !_packed_cells_equal(cell_a[i].tile, cell_b[i].tile))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void DungeonRegion::load_dungeon(const crawl_view_buffer &vbuf,
                                  const coord_def &gc_at_vbuf_centre)
 {
+    const int cx_to_gx = gc_at_vbuf_centre.x - mx / 2;
+    const int cy_to_gy = gc_at_vbuf_centre.y - my / 2;
+
+    // The player doll and the rampage icon are read from global state
+    // while packing, not from the view buffer, so they are part of the
+    // comparison key.
+    dolls_data cur_doll = player_doll;
+    fill_doll_equipment(cur_doll);
+    const bool tailwind = you.duration[DUR_TAILWIND];
+
+    // A quiet frame ships the same contents as the previous one: keep the
+    // packed vertex buffers instead of rebuilding every cell.
+    if (!m_dirty
+        && cx_to_gx == m_cx_to_gx && cy_to_gy == m_cy_to_gy
+        && cur_doll == m_last_doll
+        && tailwind == m_last_tailwind
+        && Options.tile_display_mode == m_last_display_mode
+        && _vbufs_equal(m_vbuf_raw, vbuf))
+    {
+        return;
+    }
+
     m_dirty = true;
 
-    m_cx_to_gx = gc_at_vbuf_centre.x - mx / 2;
-    m_cy_to_gy = gc_at_vbuf_centre.y - my / 2;
+    m_cx_to_gx = cx_to_gx;
+    m_cy_to_gy = cy_to_gy;
+
+    m_vbuf_raw = vbuf;
+    m_last_doll = cur_doll;
+    m_last_tailwind = tailwind;
+    m_last_display_mode = Options.tile_display_mode;
 
     m_vbuf = vbuf;
 
@@ -386,6 +492,7 @@ void DungeonRegion::draw_minibars()
 void DungeonRegion::clear()
 {
     m_vbuf.clear();
+    m_vbuf_raw.clear();
 }
 
 void DungeonRegion::config_glyph_font()
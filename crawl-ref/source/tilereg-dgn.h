@@ -6,6 +6,7 @@
 #include "cursor-type.h"
 #include "text-tag-type.h"
 #include "tiledgnbuf.h"
+#include "tiledoll.h"
 #include "tilereg.h"
 #include "viewgeom.h"
 
@@ -59,6 +60,14 @@ protected:
     int get_buffer_index(const coord_def &gc);
 
     crawl_view_buffer m_vbuf;
+    // Inputs of the last buffer pack that load_dungeon compares against to
+    // recognise a quiet frame: the view buffer before overlays were added
+    // (pack_cell_overlays edits m_vbuf in place), plus the bits of global
+    // state the packing code draws from directly.
+    crawl_view_buffer m_vbuf_raw;
+    dolls_data m_last_doll;
+    bool m_last_tailwind = false;
+    string m_last_display_mode;
     int m_cx_to_gx;
     int m_cy_to_gy;
     coord_def m_cursor[CURSOR_MAX];
@@ -4,6 +4,8 @@
 
 #include "tiletex.h"
 
+#include <thread>
+
 #include "files.h"
 #include "glwrapper.h"
 #include "rltiles/tiledef-dngn.h"
@@ -75,6 +77,25 @@ bool GenericTexture::load_texture(unsigned char *pixels, unsigned int new_width,
     return true;
 }
 
+bool GenericTexture::load_decoded_texture(unsigned char *pixels,
+                                          unsigned int new_width,
+                                          unsigned int new_height,
+                                          unsigned int original_width,
+                                          unsigned int original_height,
+                                          MipMapOptions mip_opt)
+{
+    glmanager->pixelstore_unpack_alignment(1);
+    opengl::check_texture_size("decoded texture", new_width, new_height);
+
+    m_orig_width  = original_width;
+    m_orig_height = original_height;
+
+    const bool success = load_texture(pixels, new_width, new_height, mip_opt);
+    opengl::flush_opengl_errors();
+
+    return success;
+}
+
 void GenericTexture::bind() const
 {
     ASSERT(m_handle);
@@ -178,10 +199,53 @@ bool ImageManager::load_textures(bool need_mips)
     MipMapOptions mip = need_mips ?
         MIPMAP_CREATE : MIPMAP_NONE;
 
-    int i = 0;
-    for (const auto &f : get_texture_filenames())
-        if (!m_textures[i++].load_texture(f.c_str(), mip))
-            return false;
+    // Decode the sheets on worker threads: the PNG decode and the RGBA
+    // conversion dominate the cost of a cold start and don't touch the
+    // GL context. The uploads still happen here, on the thread that
+    // owns the context.
+    struct decoded_sheet
+    {
+        unsigned char *pixels = nullptr;
+        unsigned int width = 0, height = 0;
+        unsigned int orig_width = 0, orig_height = 0;
+        bool success = false;
+    };
+
+    const vector<string> &filenames = get_texture_filenames();
+    vector<decoded_sheet> sheets(filenames.size());
+
+    vector<thread> workers;
+    for (size_t i = 0; i < filenames.size(); i++)
+    {
+        decoded_sheet *sheet = &sheets[i];
+        const string &name = filenames[i];
+        workers.emplace_back([sheet, &name]()
+        {
+            sheet->success = wm->decode_texture(name.c_str(), &sheet->pixels,
+                                                sheet->width, sheet->height,
+                                                sheet->orig_width,
+                                                sheet->orig_height);
+        });
+    }
+
+    bool success = true;
+    for (size_t i = 0; i < workers.size(); i++)
+    {
+        workers[i].join();
+        decoded_sheet &sheet = sheets[i];
+        if (sheet.success)
+        {
+            success &= m_textures[i].load_decoded_texture(sheet.pixels,
+                            sheet.width, sheet.height,
+                            sheet.orig_width, sheet.orig_height, mip);
+        }
+        else
+            success = false;
+        delete[] sheet.pixels;
+    }
+
+    if (!success)
+        return false;
 
     m_textures[TEX_FLOOR].set_info(TILE_FLOOR_MAX, &tile_floor_info);
     m_textures[TEX_WALL].set_info(TILE_DNGN_MAX, &tile_wall_info);
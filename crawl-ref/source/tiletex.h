@@ -29,6 +29,13 @@ public:
                       bool force_power_of_two = true);
     bool load_texture(unsigned char *pixels, unsigned int w, unsigned int h,
                       MipMapOptions mip_opt, int offsetx=-1, int offsety=-1);
+    // Upload pixels produced by WindowManager::decode_texture; must be
+    // called on the main thread, as it talks to the GL context.
+    bool load_decoded_texture(unsigned char *pixels,
+                              unsigned int w, unsigned int h,
+                              unsigned int original_width,
+                              unsigned int original_height,
+                              MipMapOptions mip_opt);
     void unload_texture();
 
     unsigned int width() const { return m_width; }
@@ -16,6 +16,7 @@ WebTextArea::WebTextArea(string name) :
     m_abuf(nullptr),
     m_old_cbuf(nullptr),
     m_old_abuf(nullptr),
+    m_line_dirty(nullptr),
     m_client_side_name(name),
     m_dirty(true)
 {
@@ -29,6 +30,7 @@ WebTextArea::~WebTextArea()
         delete[] m_abuf;
         delete[] m_old_cbuf;
         delete[] m_old_abuf;
+        delete[] m_line_dirty;
     }
 }
 
@@ -46,6 +48,7 @@ void WebTextArea::resize(int x, int y)
         delete[] m_abuf;
         delete[] m_old_cbuf;
         delete[] m_old_abuf;
+        delete[] m_line_dirty;
     }
 
     int size = mx * my;
@@ -53,6 +56,7 @@ void WebTextArea::resize(int x, int y)
     m_abuf = new uint8_t[size];
     m_old_cbuf = new char32_t[size];
     m_old_abuf = new uint8_t[size];
+    m_line_dirty = new bool[my];
 
     for (int i = 0; i < mx * my; i++)
     {
@@ -62,6 +66,9 @@ void WebTextArea::resize(int x, int y)
         m_old_abuf[i] = 0;
     }
 
+    for (int i = 0; i < my; i++)
+        m_line_dirty[i] = true;
+
     m_dirty = true;
 
     on_resize();
@@ -75,6 +82,9 @@ void WebTextArea::clear()
         m_abuf[i] = 0;
     }
 
+    for (int i = 0; i < my; i++)
+        m_line_dirty[i] = true;
+
     m_dirty = true;
 }
 
@@ -85,7 +95,10 @@ void WebTextArea::put_character(char32_t chr, int fg, int bg, int x, int y)
     uint8_t col = (fg & 0xf) + (bg << 4);
 
     if (m_cbuf[x + y * mx] != chr || m_abuf[x + y * mx] != col)
+    {
+        m_line_dirty[y] = true;
         m_dirty = true;
+    }
 
     m_cbuf[x + y * mx] = chr;
     m_abuf[x + y * mx] = col;
@@ -108,6 +121,13 @@ void WebTextArea::send(bool force)
 
     for (int y = 0; y < my; ++y)
     {
+        // Only lines written to since the last send can differ from what
+        // the client has; a forced send has to walk everything, since it
+        // resends lines the client is assumed to have lost.
+        if (!force && !m_line_dirty[y])
+            continue;
+        m_line_dirty[y] = false;
+
         last_col = -1;
         space_count = 0;
         dirty = false;
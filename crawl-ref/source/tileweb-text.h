@@ -26,6 +26,10 @@ protected:
     char32_t *m_old_cbuf;
     uint8_t *m_old_abuf;
 
+    // Lines touched since the last send; clean lines are skipped entirely
+    // instead of being rebuilt and diffed every frame.
+    bool *m_line_dirty;
+
     string m_client_side_name;
 
     bool m_dirty;
@@ -86,14 +86,18 @@ TilesFramework tiles;
 
 TilesFramework::TilesFramework() :
       m_controlled_from_web(false),
+      m_receiver_count(1),
       _send_lock(false),
       m_last_ui_state(UI_INIT),
+      m_last_anim_frame(0),
       m_view_loaded(false),
       m_current_view(coord_def(GXM, GYM)),
       m_next_view(coord_def(GXM, GYM)),
       m_next_view_tl(0, 0),
       m_next_view_br(-1, -1),
       m_need_full_map(true),
+      m_shadow_stamp(0),
+      m_bin_cell_updates(false),
       m_text_menu("menu_txt"),
       m_print_fg(15)
 {
@@ -148,6 +152,10 @@ bool TilesFramework::initialise()
     // Need small maximum message size to avoid crashes in OS X
     m_max_msg_size = 2048;
 
+    // The message buffer doubles as the arena for the JSON writers; keep
+    // the common case (map updates) from ever reallocating mid-message.
+    m_msg_buf.reserve(16 * 1024);
+
     struct timeval tv;
     tv.tv_sec = 1;
     tv.tv_usec = 0;
@@ -466,10 +474,20 @@ wint_t TilesFramework::_handle_control_message(sockaddr_un addr, string data)
     }
     else if (msgtype == "spectator_joined")
     {
+        // The matching watcher_count message may not have arrived yet;
+        // don't leave has_receivers() false while we resync.
+        if (m_receiver_count == 0)
+            m_receiver_count = 1;
         flush_messages();
         _send_everything();
         flush_messages();
     }
+    else if (msgtype == "watcher_count")
+    {
+        JsonWrapper count = json_find_member(obj.node, "count");
+        count.check(JSON_NUMBER);
+        m_receiver_count = (int) count->number_;
+    }
     else if (msgtype == "menu_hover")
     {
         JsonWrapper hover = json_find_member(obj.node, "hover");
@@ -604,6 +622,22 @@ wint_t TilesFramework::_handle_control_message(sockaddr_un addr, string data)
             c = CK_MOUSE_CMD;
         }
     }
+    else if (msgtype == "set_cell_protocol")
+    {
+        // The client opts into (or out of) the packed base64 encoding of
+        // per-cell tile data; see _write_tile_blob. The game_data scripts
+        // are served by game version, so every client of this game runs
+        // the matching decoder; clients without one never send this.
+        JsonWrapper bin = json_find_member(obj.node, "bincells");
+        bin.check(JSON_BOOL);
+        if (bin->bool_ != m_bin_cell_updates)
+        {
+            m_bin_cell_updates = bin->bool_;
+            // Resynchronise so the client never sees a partial mix of
+            // encodings for the same cell history.
+            m_need_full_map = true;
+        }
+    }
     else if (msgtype == "set_option")
     {
         // this is an extremely brute force approach...
@@ -1058,11 +1092,12 @@ static bool _update_statuses(player_info& c)
 {
     bool changed = false;
     unsigned int counter = 0;
-    status_info inf;
     for (unsigned int status = 0; status <= STATUS_LAST_STATUS; ++status)
     {
-        if (!fill_status_info(status, inf)) // this will reset inf itself
+        const status_info *pinf = cached_status_info(status);
+        if (!pinf)
             continue;
+        const status_info &inf = *pinf;
 
         if (!inf.light_text.empty() || !inf.short_text.empty())
         {
@@ -1599,9 +1634,437 @@ void TilesFramework::write_tileidx(tileidx_t t)
     const int lo = t & 0xFFFFFFFF;
     const int hi = t >> 32;
     if (hi == 0)
-        tiles.write_message("%d", lo);
+        _append_int(lo);
     else
-        tiles.write_message("[%d,%d]", lo, hi);
+    {
+        m_msg_buf.push_back('[');
+        _append_int(lo);
+        m_msg_buf.push_back(',');
+        _append_int(hi);
+        m_msg_buf.push_back(']');
+    }
+}
+
+// The JSON encoding of the changed packed_cell fields; kept field-for-field
+// in sync with _write_tile_blob below.
+void TilesFramework::_write_tile_json(const packed_cell &current_pc,
+                                      const packed_cell &next_pc,
+                                      bool fg_changed, bool force_full)
+{
+    const tileidx_t fg_idx = next_pc.fg & TILE_FLAG_MASK;
+
+    if (fg_changed)
+    {
+        json_write_name("fg");
+        write_tileidx(next_pc.fg);
+        if (get_tile_texture(fg_idx) == TEX_DEFAULT)
+            json_write_int("base", (int) tileidx_known_base_item(fg_idx));
+
+        // XXX: Encode spell school overlays for parchments.
+        if (fg_idx >= TILE_PARCHMENT_LOW && fg_idx <= TILE_PARCHMENT_HIGH)
+        {
+            const item_def* item = next_pc.map_knowledge.item();
+            if (item)
+            {
+                spell_type spell = static_cast<spell_type>(item->plus);
+                const tileidx_t school1 = tileidx_parchment_overlay(spell, 0);
+                const tileidx_t school2 = tileidx_parchment_overlay(spell, 1);
+
+                if (school1 > 0)
+                    json_write_int("overlay1", school1);
+                if (school2 > 0)
+                    json_write_int("overlay2", school2);
+            }
+        }
+    }
+
+    if (next_pc.bg != current_pc.bg)
+    {
+        json_write_name("bg");
+        write_tileidx(next_pc.bg);
+    }
+
+    if (next_pc.cloud != current_pc.cloud)
+    {
+        json_write_name("cloud");
+        write_tileidx(next_pc.cloud);
+    }
+
+    if (next_pc.icons != current_pc.icons)
+        json_write_icons(next_pc.icons);
+
+    if (Options.show_blood) {
+        if (next_pc.is_bloody != current_pc.is_bloody)
+            json_write_bool("bloody", next_pc.is_bloody);
+
+        if (next_pc.old_blood != current_pc.old_blood)
+            json_write_bool("old_blood", next_pc.old_blood);
+    }
+
+    if (next_pc.is_silenced != current_pc.is_silenced)
+        json_write_bool("silenced", next_pc.is_silenced);
+
+    if (next_pc.halo != current_pc.halo)
+        json_write_int("halo", next_pc.halo);
+
+    if (next_pc.is_highlighted_summoner
+        != current_pc.is_highlighted_summoner)
+    {
+        json_write_bool("highlighted_summoner",
+                        next_pc.is_highlighted_summoner);
+    }
+
+    if (next_pc.is_sanctuary != current_pc.is_sanctuary)
+        json_write_bool("sanctuary", next_pc.is_sanctuary);
+    if (next_pc.is_blasphemy != current_pc.is_blasphemy)
+        json_write_bool("blasphemy", next_pc.is_blasphemy);
+
+    if (next_pc.has_bfb_corpse != current_pc.has_bfb_corpse)
+        json_write_bool("has_bfb_corpse", next_pc.has_bfb_corpse);
+
+    if (next_pc.is_liquefied != current_pc.is_liquefied)
+        json_write_bool("liquefied", next_pc.is_liquefied);
+
+    if (next_pc.orb_glow != current_pc.orb_glow)
+        json_write_int("orb_glow", next_pc.orb_glow);
+
+    if (next_pc.quad_glow != current_pc.quad_glow)
+        json_write_bool("quad_glow", next_pc.quad_glow);
+
+    if (next_pc.disjunct != current_pc.disjunct)
+        json_write_bool("disjunct", next_pc.disjunct);
+
+    if (next_pc.mangrove_water != current_pc.mangrove_water)
+        json_write_bool("mangrove_water", next_pc.mangrove_water);
+
+    if (next_pc.awakened_forest != current_pc.awakened_forest)
+        json_write_bool("awakened_forest", next_pc.awakened_forest);
+
+    if (next_pc.blood_rotation != current_pc.blood_rotation)
+        json_write_int("blood_rotation", next_pc.blood_rotation);
+
+    if (next_pc.travel_trail != current_pc.travel_trail)
+        json_write_int("travel_trail", next_pc.travel_trail);
+
+    if (_needs_flavour(next_pc) &&
+        (next_pc.flv.floor != current_pc.flv.floor
+         || next_pc.flv.special != current_pc.flv.special
+         || !_needs_flavour(current_pc)
+         || force_full))
+    {
+        json_open_object("flv");
+        json_write_int("f", next_pc.flv.floor);
+        if (next_pc.flv.special)
+            json_write_int("s", next_pc.flv.special);
+        json_close_object();
+    }
+
+    bool overlays_changed = false;
+
+    if (next_pc.num_dngn_overlay != current_pc.num_dngn_overlay)
+        overlays_changed = true;
+    else
+    {
+        for (int i = 0; i < next_pc.num_dngn_overlay; i++)
+        {
+            if (next_pc.dngn_overlay[i] != current_pc.dngn_overlay[i])
+            {
+                overlays_changed = true;
+                break;
+            }
+        }
+    }
+
+    if (overlays_changed)
+    {
+        json_open_array("ov");
+        for (int i = 0; i < next_pc.num_dngn_overlay; ++i)
+            json_write_int(next_pc.dngn_overlay[i]);
+        json_close_array();
+    }
+}
+
+// Field bits of the packed cell blob sent when the client has negotiated
+// the binary cell protocol (see _write_tile_blob). The decoder in
+// map_knowledge.js has to stay in sync with both this list and the field
+// encodings below.
+enum bin_cell_field
+{
+    BCF_FG,
+    BCF_BASE,
+    BCF_OVERLAY1,
+    BCF_OVERLAY2,
+    BCF_BG,
+    BCF_CLOUD,
+    BCF_ICONS,
+    BCF_BLOODY,
+    BCF_OLD_BLOOD,
+    BCF_SILENCED,
+    BCF_HALO,
+    BCF_HIGHLIGHTED_SUMMONER,
+    BCF_SANCTUARY,
+    BCF_BLASPHEMY,
+    BCF_HAS_BFB_CORPSE,
+    BCF_LIQUEFIED,
+    BCF_ORB_GLOW,
+    BCF_QUAD_GLOW,
+    BCF_DISJUNCT,
+    BCF_MANGROVE_WATER,
+    BCF_AWAKENED_FOREST,
+    BCF_BLOOD_ROTATION,
+    BCF_TRAVEL_TRAIL,
+    BCF_FLV,
+    BCF_OV,
+};
+
+// Append-only byte buffer for the packed cell encoding. All multi-byte
+// values are little-endian.
+struct bin_cell_buf
+{
+    uint32_t mask = 0;
+    vector<uint8_t> data;
+
+    void field(bin_cell_field bit) { mask |= (uint32_t)1 << bit; }
+    void put8(uint8_t v) { data.push_back(v); }
+    void put16(uint16_t v) { put8(v & 0xff); put8(v >> 8); }
+    void put32(uint32_t v) { put16(v & 0xffff); put16(v >> 16); }
+    void put64(uint64_t v) { put32(v & 0xffffffff); put32(v >> 32); }
+};
+
+static string _base64_encode(const uint8_t *data, size_t len)
+{
+    static const char *digits =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    string out;
+    out.reserve((len + 2) / 3 * 4);
+    for (size_t i = 0; i < len; i += 3)
+    {
+        uint32_t triple = data[i] << 16;
+        if (i + 1 < len)
+            triple |= data[i + 1] << 8;
+        if (i + 2 < len)
+            triple |= data[i + 2];
+        out.push_back(digits[(triple >> 18) & 0x3f]);
+        out.push_back(digits[(triple >> 12) & 0x3f]);
+        out.push_back(i + 1 < len ? digits[(triple >> 6) & 0x3f] : '=');
+        out.push_back(i + 2 < len ? digits[triple & 0x3f] : '=');
+    }
+    return out;
+}
+
+// The binary counterpart of the scalar field writes in _send_cell: encodes
+// the changed packed_cell fields into a presence mask plus packed values and
+// writes them as a single base64 "bl" member of the "t" object. The change
+// detection must mirror the JSON path exactly, since both feed the same
+// client-side cell diffing.
+void TilesFramework::_write_tile_blob(const packed_cell &current_pc,
+                                      const packed_cell &next_pc,
+                                      bool fg_changed, bool force_full)
+{
+    bin_cell_buf buf;
+    const tileidx_t fg_idx = next_pc.fg & TILE_FLAG_MASK;
+
+    if (fg_changed)
+    {
+        buf.field(BCF_FG);
+        buf.put64(next_pc.fg);
+        if (get_tile_texture(fg_idx) == TEX_DEFAULT)
+        {
+            buf.field(BCF_BASE);
+            buf.put32((uint32_t) tileidx_known_base_item(fg_idx));
+        }
+
+        // XXX: Encode spell school overlays for parchments.
+        if (fg_idx >= TILE_PARCHMENT_LOW && fg_idx <= TILE_PARCHMENT_HIGH)
+        {
+            const item_def* item = next_pc.map_knowledge.item();
+            if (item)
+            {
+                spell_type spell = static_cast<spell_type>(item->plus);
+                const tileidx_t school1 = tileidx_parchment_overlay(spell, 0);
+                const tileidx_t school2 = tileidx_parchment_overlay(spell, 1);
+
+                if (school1 > 0)
+                {
+                    buf.field(BCF_OVERLAY1);
+                    buf.put32((uint32_t) school1);
+                }
+                if (school2 > 0)
+                {
+                    buf.field(BCF_OVERLAY2);
+                    buf.put32((uint32_t) school2);
+                }
+            }
+        }
+    }
+
+    if (next_pc.bg != current_pc.bg)
+    {
+        buf.field(BCF_BG);
+        buf.put64(next_pc.bg);
+    }
+
+    if (next_pc.cloud != current_pc.cloud)
+    {
+        buf.field(BCF_CLOUD);
+        buf.put64(next_pc.cloud);
+    }
+
+    if (next_pc.icons != current_pc.icons)
+    {
+        buf.field(BCF_ICONS);
+        buf.put8(next_pc.icons.size());
+        for (const tileidx_t icon : next_pc.icons)
+            buf.put64(icon);
+    }
+
+    if (Options.show_blood)
+    {
+        if (next_pc.is_bloody != current_pc.is_bloody)
+        {
+            buf.field(BCF_BLOODY);
+            buf.put8(next_pc.is_bloody);
+        }
+
+        if (next_pc.old_blood != current_pc.old_blood)
+        {
+            buf.field(BCF_OLD_BLOOD);
+            buf.put8(next_pc.old_blood);
+        }
+    }
+
+    if (next_pc.is_silenced != current_pc.is_silenced)
+    {
+        buf.field(BCF_SILENCED);
+        buf.put8(next_pc.is_silenced);
+    }
+
+    if (next_pc.halo != current_pc.halo)
+    {
+        buf.field(BCF_HALO);
+        buf.put8(next_pc.halo);
+    }
+
+    if (next_pc.is_highlighted_summoner != current_pc.is_highlighted_summoner)
+    {
+        buf.field(BCF_HIGHLIGHTED_SUMMONER);
+        buf.put8(next_pc.is_highlighted_summoner);
+    }
+
+    if (next_pc.is_sanctuary != current_pc.is_sanctuary)
+    {
+        buf.field(BCF_SANCTUARY);
+        buf.put8(next_pc.is_sanctuary);
+    }
+
+    if (next_pc.is_blasphemy != current_pc.is_blasphemy)
+    {
+        buf.field(BCF_BLASPHEMY);
+        buf.put8(next_pc.is_blasphemy);
+    }
+
+    if (next_pc.has_bfb_corpse != current_pc.has_bfb_corpse)
+    {
+        buf.field(BCF_HAS_BFB_CORPSE);
+        buf.put8(next_pc.has_bfb_corpse);
+    }
+
+    if (next_pc.is_liquefied != current_pc.is_liquefied)
+    {
+        buf.field(BCF_LIQUEFIED);
+        buf.put8(next_pc.is_liquefied);
+    }
+
+    if (next_pc.orb_glow != current_pc.orb_glow)
+    {
+        buf.field(BCF_ORB_GLOW);
+        buf.put8(next_pc.orb_glow);
+    }
+
+    if (next_pc.quad_glow != current_pc.quad_glow)
+    {
+        buf.field(BCF_QUAD_GLOW);
+        buf.put8(next_pc.quad_glow);
+    }
+
+    if (next_pc.disjunct != current_pc.disjunct)
+    {
+        buf.field(BCF_DISJUNCT);
+        buf.put8(next_pc.disjunct);
+    }
+
+    if (next_pc.mangrove_water != current_pc.mangrove_water)
+    {
+        buf.field(BCF_MANGROVE_WATER);
+        buf.put8(next_pc.mangrove_water);
+    }
+
+    if (next_pc.awakened_forest != current_pc.awakened_forest)
+    {
+        buf.field(BCF_AWAKENED_FOREST);
+        buf.put8(next_pc.awakened_forest);
+    }
+
+    if (next_pc.blood_rotation != current_pc.blood_rotation)
+    {
+        buf.field(BCF_BLOOD_ROTATION);
+        buf.put8(next_pc.blood_rotation);
+    }
+
+    if (next_pc.travel_trail != current_pc.travel_trail)
+    {
+        buf.field(BCF_TRAVEL_TRAIL);
+        buf.put8(next_pc.travel_trail);
+    }
+
+    if (_needs_flavour(next_pc) &&
+        (next_pc.flv.floor != current_pc.flv.floor
+         || next_pc.flv.special != current_pc.flv.special
+         || !_needs_flavour(current_pc)
+         || force_full))
+    {
+        buf.field(BCF_FLV);
+        buf.put16(next_pc.flv.floor);
+        buf.put16(next_pc.flv.special);
+    }
+
+    bool overlays_changed = false;
+
+    if (next_pc.num_dngn_overlay != current_pc.num_dngn_overlay)
+        overlays_changed = true;
+    else
+    {
+        for (int i = 0; i < next_pc.num_dngn_overlay; i++)
+        {
+            if (next_pc.dngn_overlay[i] != current_pc.dngn_overlay[i])
+            {
+                overlays_changed = true;
+                break;
+            }
+        }
+    }
+
+    if (overlays_changed)
+    {
+        buf.field(BCF_OV);
+        buf.put8(next_pc.num_dngn_overlay);
+        for (int i = 0; i < next_pc.num_dngn_overlay; ++i)
+            buf.put32((uint32_t) next_pc.dngn_overlay[i]);
+    }
+
+    if (!buf.mask)
+        return;
+
+    vector<uint8_t> blob;
+    blob.reserve(4 + buf.data.size());
+    blob.push_back(buf.mask & 0xff);
+    blob.push_back((buf.mask >> 8) & 0xff);
+    blob.push_back((buf.mask >> 16) & 0xff);
+    blob.push_back((buf.mask >> 24) & 0xff);
+    blob.insert(blob.end(), buf.data.begin(), buf.data.end());
+
+    json_write_string("bl", _base64_encode(blob.data(), blob.size()));
 }
 
 void TilesFramework::_send_cell(const coord_def &gc,
@@ -1651,115 +2114,12 @@ void TilesFramework::_send_cell(const coord_def &gc,
         const tileidx_t fg_idx = next_pc.fg & TILE_FLAG_MASK;
 
         const bool in_water = _in_water(next_pc);
-        bool fg_changed = false;
-
-        if (next_pc.fg != current_pc.fg)
-        {
-            fg_changed = true;
-
-            json_write_name("fg");
-            write_tileidx(next_pc.fg);
-            if (get_tile_texture(fg_idx) == TEX_DEFAULT)
-                json_write_int("base", (int) tileidx_known_base_item(fg_idx));
-
-            // XXX: Encode spell school overlays for parchments.
-            if (fg_idx >= TILE_PARCHMENT_LOW && fg_idx <= TILE_PARCHMENT_HIGH)
-            {
-                const item_def* item = next_pc.map_knowledge.item();
-                if (item)
-                {
-                    spell_type spell = static_cast<spell_type>(item->plus);
-                    const tileidx_t school1 = tileidx_parchment_overlay(spell, 0);
-                    const tileidx_t school2 = tileidx_parchment_overlay(spell, 1);
-
-                    if (school1 > 0)
-                        json_write_int("overlay1", school1);
-                    if (school2 > 0)
-                        json_write_int("overlay2", school2);
-                }
-            }
-        }
-
-        if (next_pc.bg != current_pc.bg)
-        {
-            json_write_name("bg");
-            write_tileidx(next_pc.bg);
-        }
-
-        if (next_pc.cloud != current_pc.cloud)
-        {
-            json_write_name("cloud");
-            write_tileidx(next_pc.cloud);
-        }
-
-        if (next_pc.icons != current_pc.icons)
-            json_write_icons(next_pc.icons);
-
-        if (Options.show_blood) {
-            if (next_pc.is_bloody != current_pc.is_bloody)
-                json_write_bool("bloody", next_pc.is_bloody);
-
-            if (next_pc.old_blood != current_pc.old_blood)
-                json_write_bool("old_blood", next_pc.old_blood);
-        }
-
-        if (next_pc.is_silenced != current_pc.is_silenced)
-            json_write_bool("silenced", next_pc.is_silenced);
-
-        if (next_pc.halo != current_pc.halo)
-            json_write_int("halo", next_pc.halo);
-
-        if (next_pc.is_highlighted_summoner
-            != current_pc.is_highlighted_summoner)
-        {
-            json_write_bool("highlighted_summoner",
-                            next_pc.is_highlighted_summoner);
-        }
-
-        if (next_pc.is_sanctuary != current_pc.is_sanctuary)
-            json_write_bool("sanctuary", next_pc.is_sanctuary);
-        if (next_pc.is_blasphemy != current_pc.is_blasphemy)
-            json_write_bool("blasphemy", next_pc.is_blasphemy);
+        const bool fg_changed = next_pc.fg != current_pc.fg;
 
-        if (next_pc.has_bfb_corpse != current_pc.has_bfb_corpse)
-            json_write_bool("has_bfb_corpse", next_pc.has_bfb_corpse);
-
-        if (next_pc.is_liquefied != current_pc.is_liquefied)
-            json_write_bool("liquefied", next_pc.is_liquefied);
-
-        if (next_pc.orb_glow != current_pc.orb_glow)
-            json_write_int("orb_glow", next_pc.orb_glow);
-
-        if (next_pc.quad_glow != current_pc.quad_glow)
-            json_write_bool("quad_glow", next_pc.quad_glow);
-
-        if (next_pc.disjunct != current_pc.disjunct)
-            json_write_bool("disjunct", next_pc.disjunct);
-
-        if (next_pc.mangrove_water != current_pc.mangrove_water)
-            json_write_bool("mangrove_water", next_pc.mangrove_water);
-
-        if (next_pc.awakened_forest != current_pc.awakened_forest)
-            json_write_bool("awakened_forest", next_pc.awakened_forest);
-
-        if (next_pc.blood_rotation != current_pc.blood_rotation)
-            json_write_int("blood_rotation", next_pc.blood_rotation);
-
-        if (next_pc.travel_trail != current_pc.travel_trail)
-            json_write_int("travel_trail", next_pc.travel_trail);
-
-        if (_needs_flavour(next_pc) &&
-            (next_pc.flv.floor != current_pc.flv.floor
-             || next_pc.flv.special != current_pc.flv.special
-             || !_needs_flavour(current_pc)
-             || force_full))
-        {
-            json_open_object("flv");
-            json_write_int("f", next_pc.flv.floor);
-            if (next_pc.flv.special)
-                json_write_int("s", next_pc.flv.special);
-            json_close_object();
-        }
+        if (m_bin_cell_updates)
+            _write_tile_blob(current_pc, next_pc, fg_changed, force_full);
+        else
+            _write_tile_json(current_pc, next_pc, fg_changed, force_full);
 
         if (fg_idx >= TILEP_MCACHE_START)
         {
@@ -1834,30 +2194,6 @@ void TilesFramework::_send_cell(const coord_def &gc,
                 json_write_null("mcache");
             }
         }
-
-        bool overlays_changed = false;
-
-        if (next_pc.num_dngn_overlay != current_pc.num_dngn_overlay)
-            overlays_changed = true;
-        else
-        {
-            for (int i = 0; i < next_pc.num_dngn_overlay; i++)
-            {
-                if (next_pc.dngn_overlay[i] != current_pc.dngn_overlay[i])
-                {
-                    overlays_changed = true;
-                    break;
-                }
-            }
-        }
-
-        if (overlays_changed)
-        {
-            json_open_array("ov");
-            for (int i = 0; i < next_pc.num_dngn_overlay; ++i)
-                json_write_int(next_pc.dngn_overlay[i]);
-            json_close_array();
-        }
     }
     json_close_object(true);
 }
@@ -1898,6 +2234,22 @@ void TilesFramework::_mcache_ref(bool inc)
         }
 }
 
+void TilesFramework::_evict_map_shadows()
+{
+    // Each shadow holds a full map_knowledge array, so keep only a handful
+    // of the most recently left levels.
+    static const unsigned int MAX_MAP_SHADOWS = 8;
+
+    while (m_map_shadows.size() > MAX_MAP_SHADOWS)
+    {
+        auto oldest = m_map_shadows.begin();
+        for (auto it = m_map_shadows.begin(); it != m_map_shadows.end(); ++it)
+            if (it->second->last_used < oldest->second->last_used)
+                oldest = it;
+        m_map_shadows.erase(oldest);
+    }
+}
+
 void TilesFramework::_send_map(bool spectator_only)
 {
     // TODO: prevent in some other / better way?
@@ -1906,6 +2258,55 @@ void TilesFramework::_send_map(bool spectator_only)
 
     unwind_bool no_rentry(_send_lock, true);
 
+    // Switch the diff basis when the level has changed since the last map
+    // message: stash the shadow of what the client last saw of the level we
+    // left, and restore the shadow of the level we entered, so only cells
+    // that changed since go over the wire. All cells were already marked
+    // dirty by tile_new_level.
+    const level_id cur_level = level_id::current();
+    const bool level_switched = cur_level != m_shadow_level;
+    if (level_switched)
+    {
+        if (m_mcache_ref_done)
+        {
+            _mcache_ref(false);
+            m_mcache_ref_done = false;
+        }
+
+        if (m_shadow_level.is_valid())
+        {
+            unique_ptr<MapShadow> stash(new MapShadow());
+            stash->map_knowledge = m_current_map_knowledge;
+            stash->view = m_current_view;
+            stash->monster_locs = m_monster_locs;
+            stash->origin = m_origin;
+            stash->current_gc = m_current_gc;
+            stash->last_used = ++m_shadow_stamp;
+            m_map_shadows[m_shadow_level] = std::move(stash);
+            _evict_map_shadows();
+        }
+
+        auto shadow = m_map_shadows.find(cur_level);
+        if (shadow != m_map_shadows.end())
+        {
+            m_current_map_knowledge = shadow->second->map_knowledge;
+            m_current_view = shadow->second->view;
+            m_monster_locs = shadow->second->monster_locs;
+            m_origin = shadow->second->origin;
+            m_current_gc = shadow->second->current_gc;
+            m_map_shadows.erase(shadow);
+        }
+        else
+        {
+            m_origin = coord_def(-1, -1);
+            // Changing the origin invalidates coordinates on the client side
+            m_current_gc = coord_def(-1, -1);
+            m_need_full_map = true;
+        }
+
+        m_shadow_level = cur_level;
+    }
+
     map<uint32_t, coord_def> new_monster_locs;
 
     bool force_full = spectator_only || m_need_full_map;
@@ -1924,6 +2325,12 @@ void TilesFramework::_send_map(bool spectator_only)
     if (force_full)
         json_write_bool("clear", true);
 
+    // Tells the client which level the cells belong to, so it can keep its
+    // own per-level copies in step with the shadows above. Sent on full
+    // maps too so newly joined spectators learn the current level.
+    if (level_switched || force_full)
+        json_write_string("lvl", cur_level.describe());
+
     if (force_full || you.on_current_level != m_player_on_level)
     {
         json_write_bool("player_on_level", you.on_current_level);
@@ -2214,6 +2621,11 @@ void TilesFramework::_send_everything()
     // _send_map(true) only sends the full map to the newly connected
     // spectator but resets the dirty flags. So make sure the player's
     // map data is up to date first.
+    // The new spectator has no client-side copy of levels the player left
+    // earlier, so our shadows of them no longer describe every receiver.
+    // Drop them; later level changes fall back to a full send.
+    m_map_shadows.clear();
+
     const bool sent_full_map = m_need_full_map;
     _send_map(false);
     // If we didn't send the full map, send it to the new spectator
@@ -2329,6 +2741,25 @@ void TilesFramework::redraw()
     m_last_tick_redraw = get_milliseconds();
 }
 
+bool TilesFramework::redraw_animation_frame()
+{
+    // Minimum interval between animation frames actually sent (~30fps).
+    // Frames arriving faster than this are coalesced rather than lost:
+    // their cells stay dirty and go out as part of the next frame, since
+    // _send_map only ever transmits a diff against what the client was
+    // last sent. This keeps one explosion from turning into dozens of
+    // websocket messages per spectator.
+    static const unsigned int MIN_ANIM_FRAME_MS = 33;
+
+    const unsigned int now = get_milliseconds();
+    if (m_last_anim_frame && now - m_last_anim_frame < MIN_ANIM_FRAME_MS)
+        return false;
+
+    m_last_anim_frame = now;
+    redraw();
+    return true;
+}
+
 void TilesFramework::update_minimap(const coord_def& gc)
 {
     if (gc.x < 0 || gc.x >= GXM || gc.y < 0 || gc.y >= GYM)
@@ -2339,10 +2770,9 @@ void TilesFramework::update_minimap(const coord_def& gc)
 
 void TilesFramework::clear_minimap()
 {
-    m_origin = coord_def(-1, -1);
-    // Changing the origin invalidates coordinates on the client side
-    m_current_gc = coord_def(-1, -1);
-    m_need_full_map = true;
+    // Nothing to do: _send_map notices level changes itself and either
+    // restores the shadow of what the client already has for the new level
+    // or falls back to a full send.
 }
 
 void TilesFramework::update_minimap_bounds()
@@ -2601,6 +3031,26 @@ void TilesFramework::json_close_array(bool erase_if_empty)
     json_close(erase_if_empty, ']');
 }
 
+void TilesFramework::_append_int(int value)
+{
+    // Direct decimal formatting into the message buffer. The buffer keeps
+    // its capacity across messages, so once warmed up the JSON send path
+    // neither allocates nor goes through printf.
+    char buf[12];
+    char *end = buf + sizeof(buf);
+    char *out = end;
+    unsigned int v = value < 0 ? -(unsigned int)value : (unsigned int)value;
+    do
+    {
+        *--out = '0' + v % 10;
+        v /= 10;
+    }
+    while (v);
+    if (value < 0)
+        *--out = '-';
+    m_msg_buf.append(out, end - out);
+}
+
 void TilesFramework::json_write_comma()
 {
     if (m_msg_buf.empty())
@@ -2608,7 +3058,7 @@ void TilesFramework::json_write_comma()
     char last = m_msg_buf[m_msg_buf.size() - 1];
     if (last == '{' || last == '[' || last == ',' || last == ':')
         return;
-    write_message(",");
+    m_msg_buf.push_back(',');
 }
 
 void TilesFramework::json_write_icons(const set<tileidx_t> &icons)
@@ -2626,16 +3076,16 @@ void TilesFramework::json_write_name(const string& name)
 {
     json_write_comma();
 
-    write_message("\"");
+    m_msg_buf.push_back('"');
     write_message_escaped(name);
-    write_message("\":");
+    m_msg_buf.append("\":");
 }
 
 void TilesFramework::json_write_int(int value)
 {
     json_write_comma();
 
-    write_message("%d", value);
+    _append_int(value);
 }
 
 void TilesFramework::json_write_int(const string& name, int value)
@@ -2651,9 +3101,9 @@ void TilesFramework::json_write_bool(bool value)
     json_write_comma();
 
     if (value)
-        write_message("true");
+        m_msg_buf.append("true");
     else
-        write_message("false");
+        m_msg_buf.append("false");
 }
 
 void TilesFramework::json_write_bool(const string& name, bool value)
@@ -2668,7 +3118,7 @@ void TilesFramework::json_write_null()
 {
     json_write_comma();
 
-    write_message("null");
+    m_msg_buf.append("null");
 }
 
 void TilesFramework::json_write_null(const string& name)
@@ -2683,9 +3133,9 @@ void TilesFramework::json_write_string(const string& value)
 {
     json_write_comma();
 
-    write_message("\"");
+    m_msg_buf.push_back('"');
     write_message_escaped(value);
-    write_message("\"");
+    m_msg_buf.push_back('"');
 }
 
 void TilesFramework::json_write_string(const string& name, const string& value)
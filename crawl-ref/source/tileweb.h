@@ -9,11 +9,13 @@
 
 #include <bitset>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include <sys/un.h>
 
 #include "cursor-type.h"
+#include "level-id.h"
 #include "map-cell.h"
 #include "map-knowledge.h"
 #include "status.h"
@@ -129,6 +131,7 @@ public:
     void set_need_redraw();
     bool need_redraw(unsigned int min_tick_delay = 0) const;
     void redraw();
+    bool redraw_animation_frame();
 
     void place_cursor(cursor_type type, const coord_def &gc);
     void clear_text_tags(text_tag_type type);
@@ -167,7 +170,13 @@ public:
     void send_message(PRINTF(1, ));
     void flush_messages();
 
-    bool has_receivers() { return !m_dest_addrs.empty(); }
+    // Whether anything on the other end would render what we send: at
+    // least one attached socket, and the webserver hasn't told us (via a
+    // watcher_count message) that no player or spectator is connected.
+    bool has_receivers()
+    {
+        return !m_dest_addrs.empty() && m_receiver_count != 0;
+    }
     bool is_controlled_from_web() { return m_controlled_from_web; }
 
     wint_t try_await_input();
@@ -238,6 +247,9 @@ protected:
     vector<sockaddr_un> m_dest_addrs;
 
     bool m_controlled_from_web;
+    // Connections (player and spectators) the webserver reports as
+    // receiving our output; assume one until told otherwise.
+    int m_receiver_count;
     bool m_need_flush;
 
     bool _send_lock; // not thread safe
@@ -256,6 +268,7 @@ protected:
 
     void json_open(const string& name, char opener, char type);
     void json_close(bool erase_if_empty, char type);
+    void _append_int(int value);
 
     struct UIStackFrame
     {
@@ -272,6 +285,7 @@ protected:
     vector<int> m_ui_cutoff_stack;
 
     unsigned int m_last_tick_redraw;
+    unsigned int m_last_anim_frame;
     bool m_need_redraw;
     bool m_layout_reset;
 
@@ -299,6 +313,29 @@ protected:
     map<uint32_t, coord_def> m_monster_locs;
     bool m_need_full_map;
 
+    // Shadow of what the client was last sent for a level the player has
+    // left, so that re-entering the level only transmits the cells that
+    // changed since. Bounded; levels whose shadow was evicted (and newly
+    // joined spectators, who have no client-side copy of other levels)
+    // fall back to a full send.
+    struct MapShadow
+    {
+        FixedArray<map_cell, GXM, GYM> map_knowledge;
+        crawl_view_buffer view;
+        map<uint32_t, coord_def> monster_locs;
+        coord_def origin;
+        coord_def current_gc;
+        int last_used;
+    };
+    map<level_id, unique_ptr<MapShadow>> m_map_shadows;
+    level_id m_shadow_level;
+    int m_shadow_stamp;
+    void _evict_map_shadows();
+    // Send the per-cell tile data of map messages as a packed base64 blob
+    // instead of a JSON object. Off by default; the client opts in with a
+    // set_cell_protocol message once its decoder is loaded.
+    bool m_bin_cell_updates;
+
     coord_def m_cursor[CURSOR_MAX];
     coord_def m_last_clicked_grid;
     bool m_text_cursor;
@@ -335,6 +372,12 @@ protected:
                     const map_cell &current_mc, const map_cell &next_mc,
                     map<uint32_t, coord_def>& new_monster_locs,
                     bool force_full);
+    void _write_tile_json(const packed_cell &current_pc,
+                          const packed_cell &next_pc,
+                          bool fg_changed, bool force_full);
+    void _write_tile_blob(const packed_cell &current_pc,
+                          const packed_cell &next_pc,
+                          bool fg_changed, bool force_full);
     void _send_monster(const coord_def &gc, const monster_info* m,
                        map<uint32_t, coord_def>& new_monster_locs,
                        bool force_full);
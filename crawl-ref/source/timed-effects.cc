@@ -65,6 +65,7 @@
 #include "view.h"
 #include "viewchar.h"
 #include "unwind.h"
+#include "zone-profile.h"
 
 static void _apply_contam_over_time()
 {
@@ -425,6 +426,7 @@ static struct timed_effect timed_effects[] =
 // Do various time related actions...
 void handle_time()
 {
+    PERF_ZONE("handle_time");
     int base_time = you.elapsed_time % 200;
     int old_time = base_time - you.time_taken;
 
@@ -35,6 +35,7 @@
 #include "nearby-danger.h"
 #include "output.h"
 #include "player-equip.h"
+#include "player.h"
 #include "player-stats.h"
 #include "prompt.h"
 #include "religion.h"
@@ -43,6 +44,7 @@
 #include "spl-cast.h"
 #include "spl-zap.h"
 #include "state.h"
+#include "status.h"
 #include "stringutil.h"
 #include "tag-version.h"
 #include "terrain.h"
@@ -1950,7 +1952,7 @@ static void _on_enter_form(transformation which_trans)
         break;
 
     case transformation::death:
-        you.redraw_status_lights = true;
+        invalidate_status_cache();
         _print_death_brand_changes(you.weapon(), true);
         _print_death_brand_changes(you.offhand_weapon(), true);
         break;
@@ -1983,6 +1985,7 @@ void set_form(transformation which_trans, int dur, bool scale_hp)
 {
     you.form = which_trans;
     you.duration[DUR_TRANSFORMATION] = max(1, dur * BASELINE_DELAY);
+    invalidate_derived_stats();
     update_player_symbol();
 
     const int str_mod = get_form(which_trans)->str_mod;
@@ -2464,12 +2467,6 @@ transformation form_for_talisman(const item_def &talisman)
     return transformation::none;
 }
 
-void clear_form_info_on_exit()
-{
-    for (const form_entry &entry : formdata)
-        delete entry.special_dice;
-}
-
 void sphinx_notice_riddle_target(monster* mon)
 {
     if (!mon->is_peripheral() && !mons_aligned(&you, mon))
@@ -312,7 +312,7 @@ private:
 
     /// Calculator for form-specific 'special' damage done by this form (eg:
     /// Blinkbolt damage or Contam damage)
-    const dam_deducer* special_dice;
+    dam_deducer* special_dice;
 };
 const Form* get_form(transformation form = you.form);
 const Form* cur_form(bool temp = true);
@@ -364,7 +364,6 @@ void merfolk_start_swimming();
 void merfolk_stop_swimming();
 
 transformation form_for_talisman(const item_def &talisman);
-void clear_form_info_on_exit();
 
 void sphinx_notice_riddle_target(monster* mon);
 void sphinx_check_riddle();
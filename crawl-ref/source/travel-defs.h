@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "defines.h"
 
-typedef int travel_distance_col[GYM];
+// int16_t halves the grid's cache footprint; distances and the PD_*
+// sentinels all fit comfortably.
+typedef int16_t travel_distance_col[GYM];
 typedef travel_distance_col travel_distance_grid_t[GXM];
@@ -16,6 +16,7 @@
 #include <cstdarg>
 #include <cstdio>
 #include <memory>
+#include <queue>
 #include <set>
 #include <sstream>
 
@@ -131,6 +132,39 @@ static string trans_travel_dest;
 // hostile terrain.
 travel_distance_grid_t travel_point_distance;
 
+// Generation stamps for travel_point_distance: a cell's value is only
+// valid if its stamp matches the current generation, so wiping the grid
+// before a flood is a counter increment rather than a memset. (Level
+// generation uses the grid as raw scratch with its own memsets and
+// ignores the stamps entirely.)
+static uint16_t _tpd_stamp[GXM][GYM];
+static uint16_t _tpd_generation = 0;
+
+static void _tpd_new_generation()
+{
+    if (++_tpd_generation == 0)
+    {
+        // The counter wrapped; stamps left over from 65536 floods ago
+        // would read as current, so really clear them this once.
+        memset(_tpd_stamp, 0, sizeof(_tpd_stamp));
+        _tpd_generation = 1;
+    }
+}
+
+// The distance the last flood assigned to p, or 0 if the flood never
+// reached it. Use this instead of reading travel_point_distance directly.
+int travel_point_distance_at(const coord_def &p)
+{
+    return _tpd_stamp[p.x][p.y] == _tpd_generation
+           ? travel_point_distance[p.x][p.y] : 0;
+}
+
+static void _tpd_set(const coord_def &p, int dist)
+{
+    _tpd_stamp[p.x][p.y] = _tpd_generation;
+    travel_point_distance[p.x][p.y] = dist;
+}
+
 // Apply slime wall checks when checking if squares are travelsafe.
 static bool g_Slime_Wall_Check = true;
 
@@ -224,7 +258,7 @@ static inline bool _is_safe_cloud(const coord_def& c)
 
 // Returns an estimate for the time needed to cross this feature.
 // This is done, so traps etc. will usually be circumvented where possible.
-static inline int _feature_traverse_cost(dungeon_feature_type feature)
+static int _feature_traverse_cost_uncached(dungeon_feature_type feature)
 {
     const bool safe_trap = (feature == DNGN_TRAP_WEB || feature == DNGN_TRAP_NET)
                            && you.is_web_immune()
@@ -265,8 +299,9 @@ bool is_unknown_transporter(const coord_def &p)
 
 // Returns true if the character can cross this dungeon feature, and
 // the player hasn't requested that travel avoid the feature.
-bool feat_is_traversable_now(dungeon_feature_type grid, bool try_fallback,
-                             bool assume_flight)
+static bool _feat_is_traversable_now_uncached(dungeon_feature_type grid,
+                                              bool try_fallback,
+                                              bool assume_flight)
 {
     if (!ignore_player_traversability)
     {
@@ -305,6 +340,61 @@ bool feat_is_traversable_now(dungeon_feature_type grid, bool try_fallback,
     return feat_is_traversable(grid, try_fallback);
 }
 
+// Per-feature cache for feat_is_traversable_now() and the traverse-cost
+// estimate. Both depend only on the feature type plus player state that
+// is fixed for the span of any one travel or pathfinding flood (swimming
+// and flight ability, web immunity, travel_avoid_terrain), but the state
+// queries walk mutations, religion and equipment, and a flood makes
+// thousands of them. One rebuild per turn covers every consumer; a grid
+// cache isn't needed since no input varies per cell.
+static bool _traversable_now[2][2][NUM_FEATURES];
+static uint8_t _traverse_cost[NUM_FEATURES];
+static int _traversable_cache_turn = -1;
+static transformation _traversable_cache_form = transformation::none;
+static bool _traversable_cache_ignore = false;
+static bool _traversable_cache_valid = false;
+
+static void _check_traversability_cache()
+{
+    if (_traversable_cache_valid
+        && _traversable_cache_turn == you.num_turns
+        && _traversable_cache_form == you.form
+        && _traversable_cache_ignore == ignore_player_traversability)
+    {
+        return;
+    }
+
+    for (int feat = 0; feat < NUM_FEATURES; ++feat)
+    {
+        const auto grid = static_cast<dungeon_feature_type>(feat);
+        for (int fallback = 0; fallback < 2; ++fallback)
+            for (int flight = 0; flight < 2; ++flight)
+            {
+                _traversable_now[fallback][flight][feat] =
+                    _feat_is_traversable_now_uncached(grid, fallback, flight);
+            }
+        _traverse_cost[feat] = _feature_traverse_cost_uncached(grid);
+    }
+
+    _traversable_cache_valid  = true;
+    _traversable_cache_turn   = you.num_turns;
+    _traversable_cache_form   = you.form;
+    _traversable_cache_ignore = ignore_player_traversability;
+}
+
+bool feat_is_traversable_now(dungeon_feature_type grid, bool try_fallback,
+                             bool assume_flight)
+{
+    _check_traversability_cache();
+    return _traversable_now[try_fallback][assume_flight][grid];
+}
+
+static inline int _feature_traverse_cost(dungeon_feature_type feature)
+{
+    _check_traversability_cache();
+    return _traverse_cost[feature];
+}
+
 // Returns true if a generic character can cross this dungeon feature.
 // Ignores swimming, flying, and travel_avoid_terrain.
 bool feat_is_traversable(dungeon_feature_type feat, bool try_fallback)
@@ -564,6 +654,122 @@ static bool _is_safe_move(const coord_def& c)
     return _is_safe_cloud(c);
 }
 
+// Explore frontier bookkeeping. For autoexplore we maintain a persistent
+// set of "frontier" squares: seen, non-solid squares adjacent to at least
+// one unseen square. Any unexplored terrain the explore flood can discover
+// is discovered while examining one of these squares, so once they have
+// all been examined (or the set is empty) the flood can stop instead of
+// scanning the rest of the level. The set is updated incrementally as
+// squares come into view, and rebuilt from scratch if the level or its
+// terrain changes under us.
+static set<coord_def> _explore_frontier;
+static level_id _frontier_level;
+static unsigned _frontier_terrain_mark = 0;
+static bool     _frontier_valid = false;
+
+static bool _is_frontier_square(const coord_def &p)
+{
+    const map_cell &cell = env.map_knowledge(p);
+    if (!cell.seen())
+        return false;
+
+    // The flood can only look outwards from squares it can examine; walls
+    // and other solid features never make it onto the flood's agenda.
+    const dungeon_feature_type feat = cell.feat();
+    if (feat_is_solid(feat) && !feat_is_closed_door(feat))
+        return false;
+
+    for (adjacent_iterator ai(p); ai; ++ai)
+        if (in_bounds(*ai) && !env.map_knowledge(*ai).seen())
+            return true;
+
+    return false;
+}
+
+void explore_frontier_invalidate()
+{
+    _frontier_valid = false;
+}
+
+// Brings the frontier set up to date with the current terrain mark by
+// patching in the cells from the terrain change log: membership can only
+// have changed for the altered cells and their neighbours. Returns false
+// if the set is invalid or the log no longer reaches back far enough, in
+// which case only a full rebuild will do.
+static bool _frontier_catch_up()
+{
+    if (!_frontier_valid || _frontier_level != level_id::current())
+        return false;
+
+    if (_frontier_terrain_mark == terrain_change_mark())
+        return true;
+
+    vector<coord_def> changed;
+    if (!terrain_changes_since(_frontier_terrain_mark, changed))
+        return false;
+
+    for (const coord_def &pos : changed)
+        for (adjacent_iterator ai(pos, false); ai; ++ai)
+        {
+            if (!in_bounds(*ai))
+                continue;
+
+            if (_is_frontier_square(*ai))
+                _explore_frontier.insert(*ai);
+            else
+                _explore_frontier.erase(*ai);
+        }
+
+    _frontier_terrain_mark = terrain_change_mark();
+    return true;
+}
+
+// Called whenever a square is seen for the first time.
+void explore_frontier_seen(const coord_def &pos)
+{
+    if (!_frontier_catch_up())
+    {
+        _frontier_valid = false;
+        return;
+    }
+
+    // Seeing pos can change frontier membership only for pos itself and
+    // its neighbours.
+    for (adjacent_iterator ai(pos, false); ai; ++ai)
+    {
+        if (!in_bounds(*ai))
+            continue;
+
+        if (_is_frontier_square(*ai))
+            _explore_frontier.insert(*ai);
+        else
+            _explore_frontier.erase(*ai);
+    }
+}
+
+// Returns the current level's frontier set, rebuilding it if it is out of
+// date, or nullptr if no trustworthy set can be maintained here.
+static const set<coord_def> *_explore_frontier_get()
+{
+    // The Abyss morphs and rots map knowledge behind our back.
+    if (player_in_branch(BRANCH_ABYSS))
+        return nullptr;
+
+    if (!_frontier_catch_up())
+    {
+        _explore_frontier.clear();
+        for (rectangle_iterator ri(1); ri; ++ri)
+            if (_is_frontier_square(*ri))
+                _explore_frontier.insert(*ri);
+
+        _frontier_level = level_id::current();
+        _frontier_terrain_mark = terrain_change_mark();
+        _frontier_valid = true;
+    }
+
+    return &_explore_frontier;
+}
+
 void travel_init_load_level()
 {
     curr_excludes.clear();
@@ -582,6 +788,7 @@ void travel_init_new_level()
 
     travel_init_load_level();
 
+    explore_frontier_invalidate();
     explore_stopped_pos.reset();
 }
 
@@ -716,7 +923,7 @@ static void _explore_find_target_square()
     // If we didn't find an explore target the first time, try fallback mode
     // Do the same if the original target was a "hostile" place.
     if (!whereto.x && !whereto.y
-       || 0 > travel_point_distance[whereto.x][whereto.y])
+       || 0 > travel_point_distance_at(whereto))
     {
         travel_pathfind fallback_tp;
         fallback_tp.set_floodseed(you.pos(), true);
@@ -746,7 +953,7 @@ static void _explore_find_target_square()
         // player's starting position may in some cases not have its
         // travel_point_distance set, but we know it's reachable, since
         // we're there.
-        if (travel_point_distance[whereto.x][whereto.y] <= 0
+        if (travel_point_distance_at(whereto) <= 0
             && whereto != you.pos())
         {
             whereto.reset();
@@ -1282,14 +1489,15 @@ static void _fill_exclude_radius(const travel_exclude &exc)
         for (int x = c.x - radius; x <= c.x + radius; ++x)
         {
             const coord_def p(x, y);
-            if (!map_bounds(x, y) || travel_point_distance[x][y])
+            if (!map_bounds(x, y) || travel_point_distance_at(p))
                 continue;
 
             if (is_exclude_root(p))
-                travel_point_distance[x][y] = PD_EXCLUDED;
+                _tpd_set(p, PD_EXCLUDED);
             else if (is_excluded(p) && env.map_knowledge(p).known())
-                travel_point_distance[x][y] = PD_EXCLUDED_RADIUS;
+                _tpd_set(p, PD_EXCLUDED_RADIUS);
         }
+    travel_invalidate_distance_cache();
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -1308,6 +1516,8 @@ travel_pathfind::travel_pathfind()
       need_for_greed(false), autopickup(false),
       unexplored_place(), greedy_place(), unexplored_dist(0), greedy_dist(0),
       refdist(nullptr), reseed_points(), features(nullptr), unreachables(),
+      flood_stops(), have_flood_stops(false),
+      frontier_pending(), track_frontier(false),
       point_distance(travel_point_distance), next_iter_points(0),
       traveled_distance(0), circ_index(0)
 {
@@ -1317,6 +1527,18 @@ travel_pathfind::~travel_pathfind()
 {
 }
 
+int travel_pathfind::pd_at(const coord_def &c) const
+{
+    return _tpd_stamp[c.x][c.y] == _tpd_generation
+           ? point_distance[c.x][c.y] : 0;
+}
+
+void travel_pathfind::pd_set(const coord_def &c, int dist)
+{
+    _tpd_stamp[c.x][c.y] = _tpd_generation;
+    point_distance[c.x][c.y] = dist;
+}
+
 static bool _is_greed_inducing_square(const LevelStashes *ls,
                                       const coord_def &c, bool autopickup)
 {
@@ -1347,6 +1569,12 @@ void travel_pathfind::set_floodseed(const coord_def &seed, bool dblflood)
     double_flood = dblflood;
 }
 
+void travel_pathfind::set_floodstops(const vector<coord_def> &stops)
+{
+    flood_stops = stops;
+    have_flood_stops = !flood_stops.empty();
+}
+
 void travel_pathfind::set_feature_vector(vector<coord_def> *feats)
 {
     features = feats;
@@ -1431,7 +1659,9 @@ coord_def travel_pathfind::pathfind(run_mode_type rmode, bool fallback_explore)
     //
     // point_distance will hold the distance of all points from the starting
     // point, i.e. the distance travelled to get there.
-    memset(point_distance, 0, sizeof(travel_distance_grid_t));
+    _tpd_new_generation();
+    // Whatever full flood was memoized is gone now.
+    travel_invalidate_distance_cache();
 
     if (!in_bounds(start))
         return coord_def();
@@ -1454,6 +1684,29 @@ coord_def travel_pathfind::pathfind(run_mode_type rmode, bool fallback_explore)
                                  && !actor_slime_wall_immune(&you));
     unwind_slime_wall_precomputer slime_neighbours(g_Slime_Wall_Check);
 
+    // If we have an up-to-date frontier set for this level, explore can
+    // stop flooding once every frontier square has been examined, and can
+    // skip the flood entirely when nothing is left to explore.
+    track_frontier = false;
+    if (floodout
+        && (runmode == RMODE_EXPLORE || runmode == RMODE_EXPLORE_GREEDY)
+        && !features && !annotate_map)
+    {
+        if (const set<coord_def> *frontier = _explore_frontier_get())
+        {
+            track_frontier = true;
+            frontier_pending = *frontier;
+            if (frontier_pending.empty())
+            {
+                // The level is fully explored; all greedy explore might
+                // still want is picking up known items.
+                if (!need_for_greed)
+                    return coord_def();
+                unexplored_dist = INFINITE_DIST;
+            }
+        }
+    }
+
     // How many points we'll consider next iteration.
     next_iter_points = 0;
 
@@ -1505,6 +1758,21 @@ coord_def travel_pathfind::pathfind(run_mode_type rmode, bool fallback_explore)
             }
         }
 
+        // All requested stop cells are settled; no need to flood the
+        // rest of the level.
+        if (have_flood_stops && flood_stops.empty())
+            break;
+
+        // Every frontier square has been examined, so flooding farther
+        // cannot discover more unexplored terrain. With explore_wall_bias
+        // set this is what ends the flood once a target is known; don't
+        // cut greedy explore short while it is still hunting for items.
+        if (track_frontier && found_target && frontier_pending.empty()
+            && (!need_for_greed || greedy_dist != UNFOUND_DIST))
+        {
+            return explore_target();
+        }
+
         // Handle exploration with wall bias
         if (next_iter_points == 0 && found_target)
             return explore_target();
@@ -1568,7 +1836,7 @@ void travel_pathfind::get_features()
     if (!ls && (annotate_map || need_for_greed))
         ls = StashTrack.find_current_level();
 
-    memset(point_distance, 0, sizeof(travel_distance_grid_t));
+    _tpd_new_generation();
 
     coord_def dc;
     for (dc.x = X_BOUND_1; dc.x <= X_BOUND_2; ++dc.x)
@@ -1619,7 +1887,7 @@ bool travel_pathfind::square_slows_movement(const coord_def &c)
         feat_cost += 5;
 
     if (feat_cost > 1
-        && point_distance[c.x][c.y] > traveled_distance - feat_cost)
+        && pd_at(c) > traveled_distance - feat_cost)
     {
         circumference[!circ_index][next_iter_points++] = c;
         return true;
@@ -1651,6 +1919,21 @@ void travel_pathfind::check_square_greed(const coord_def &c)
     }
 }
 
+// A cell just got its distance; if it was one of the requested stop
+// points, tick it off so the flood can end once all are settled.
+void travel_pathfind::note_floodstop(const coord_def &dc)
+{
+    if (!have_flood_stops)
+        return;
+    for (unsigned int i = 0; i < flood_stops.size(); ++i)
+        if (flood_stops[i] == dc)
+        {
+            flood_stops[i] = flood_stops.back();
+            flood_stops.pop_back();
+            break;
+        }
+}
+
 bool travel_pathfind::path_flood(const coord_def &c, const coord_def &dc)
 {
     if (!in_bounds(dc) || unreachables.count(dc))
@@ -1667,7 +1950,7 @@ bool travel_pathfind::path_flood(const coord_def &c, const coord_def &dc)
                 // place from where we can see it.
                 for (radius_iterator ri(dc, LOS_DEFAULT, true); ri; ++ri)
                 {
-                    const int dist = point_distance[ri->x][ri->y];
+                    const int dist = pd_at(*ri);
                     if (dist > 0
                         && (dist < unexplored_dist || unexplored_dist < 0))
                     {
@@ -1794,7 +2077,7 @@ bool travel_pathfind::path_flood(const coord_def &c, const coord_def &dc)
         // This point is not okay to travel on, but if this is a
         // trap, we'll want to put it on the feature vector anyway.
         if (_is_reseedable(dc, ignore_danger)
-            && !point_distance[dc.x][dc.y]
+            && !pd_at(dc)
             && dc != start)
         {
             if (features && (is_trap(dc) || is_exclude_root(dc))
@@ -1809,31 +2092,32 @@ bool travel_pathfind::path_flood(const coord_def &c, const coord_def &dc)
 
             // Appropriate mystic number. Nobody else should check
             // this number, since this square is unsafe for travel.
-            point_distance[dc.x][dc.y] =
-                is_exclude_root(dc)   ? PD_EXCLUDED :
-                is_excluded(dc)       ? PD_EXCLUDED_RADIUS :
-                !_is_safe_cloud(dc)   ? PD_CLOUD
-                                      : PD_TRAP;
+            pd_set(dc, is_exclude_root(dc) ? PD_EXCLUDED :
+                       is_excluded(dc)     ? PD_EXCLUDED_RADIUS :
+                       !_is_safe_cloud(dc) ? PD_CLOUD
+                                           : PD_TRAP);
+            note_floodstop(dc);
         }
         return false;
     }
 
-    if (!point_distance[dc.x][dc.y])
+    if (!pd_at(dc))
     {
         // This point is going to be on the agenda for the next
         // iteration
         circumference[!circ_index][next_iter_points++] = dc;
-        point_distance[dc.x][dc.y] = traveled_distance;
+        pd_set(dc, traveled_distance);
+        note_floodstop(dc);
 
         // Negative distances here so that show_map can colour
         // the map differently for these squares.
         if (ignore_hostile)
         {
-            point_distance[dc.x][dc.y] = -point_distance[dc.x][dc.y];
+            pd_set(dc, -pd_at(dc));
             if (is_exclude_root(dc))
-                point_distance[dc.x][dc.y] = PD_EXCLUDED;
+                pd_set(dc, PD_EXCLUDED);
             else if (is_excluded(dc))
-                point_distance[dc.x][dc.y] = PD_EXCLUDED_RADIUS;
+                pd_set(dc, PD_EXCLUDED_RADIUS);
         }
 
         if (features && !ignore_hostile)
@@ -1866,11 +2150,11 @@ bool travel_pathfind::path_flood(const coord_def &c, const coord_def &dc)
 
 void travel_pathfind::good_square(const coord_def &c)
 {
-    if (!point_distance[c.x][c.y])
+    if (!pd_at(c))
     {
         // This point is going to be on the agenda for the next iteration.
         circumference[!circ_index][next_iter_points++] = c;
-        point_distance[c.x][c.y] = traveled_distance;
+        pd_set(c, traveled_distance);
     }
 }
 
@@ -1899,6 +2183,9 @@ bool travel_pathfind::path_examine_point(const coord_def &c)
     if (point_traverse_delay(c))
         return false;
 
+    if (track_frontier)
+        frontier_pending.erase(c);
+
     bool found_target = false;
 
     // For each point, we look at all surrounding points. Take them orthogonals
@@ -1982,9 +2269,38 @@ int travel_pathfind::explore_status()
  * @param      youpos The starting position.
  * @param[in]  features A vector of features to give to travel_pathfind.
  */
-void fill_travel_point_distance(const coord_def& youpos,
-                                vector<coord_def>* features)
+// Memoization of the last full flood: repeated travel/stash queries in
+// the same turn usually re-flood from the same square over unchanged
+// terrain. The key includes the level, the seed, the turn count and a
+// mark bumped by terrain and exclusion changes, so any of those
+// invalidates the cached grid.
+static level_id _tpd_cache_level;
+static coord_def _tpd_cache_seed;
+static int _tpd_cache_turns = -1;
+static uint32_t _tpd_cache_mark = 0;
+static uint32_t _tpd_dirty_mark = 1;
+
+void travel_invalidate_distance_cache()
 {
+    ++_tpd_dirty_mark;
+}
+
+void fill_travel_point_distance(const coord_def& youpos,
+                                vector<coord_def>* features,
+                                const vector<coord_def>* stop_points)
+{
+    // Only plain full floods are reusable: feature collection has side
+    // effects and stop-point floods leave the grid partially filled.
+    const bool cacheable = !features && !stop_points;
+    if (cacheable
+        && _tpd_cache_turns == you.num_turns
+        && _tpd_cache_mark == _tpd_dirty_mark
+        && _tpd_cache_seed == youpos
+        && _tpd_cache_level == level_id::current())
+    {
+        return;
+    }
+
     travel_pathfind tp;
     tp.set_floodseed(youpos);
     tp.set_feature_vector(features);
@@ -1993,7 +2309,24 @@ void fill_travel_point_distance(const coord_def& youpos,
     // has no effect on travel_point_distance.
     if (features)
         tp.pathfind(RMODE_NOT_RUNNING, false);
+    // Only the final flood may stop early: each pathfind() starts by
+    // wiping the distance grid.
+    if (stop_points)
+        tp.set_floodstops(*stop_points);
     tp.pathfind(RMODE_NOT_RUNNING, true);
+
+    if (cacheable)
+    {
+        _tpd_cache_level = level_id::current();
+        _tpd_cache_seed = youpos;
+        _tpd_cache_turns = you.num_turns;
+        _tpd_cache_mark = _tpd_dirty_mark;
+    }
+    else
+    {
+        // The grid no longer holds a plain full flood.
+        _tpd_cache_turns = -1;
+    }
 }
 
 extern map<branch_type, set<level_id> > stair_level;
@@ -3035,6 +3368,28 @@ static int _target_distance_from(const coord_def &pos)
     return -1;
 }
 
+// A level/position pair waiting to be expanded by _find_transtravel_stair,
+// along with the first stair taken from the player's position to get there,
+// so that the stair starting the winning route can be reported.
+struct transtravel_frontier
+{
+    int dist;
+    level_id lev;
+    // The entry position on lev; not necessarily a stair (the player need
+    // not be standing on one).
+    coord_def pos;
+    coord_def first_stair;
+};
+
+struct transtravel_frontier_farther
+{
+    bool operator()(const transtravel_frontier &a,
+                    const transtravel_frontier &b) const
+    {
+        return a.dist > b.dist;
+    }
+};
+
 /*
  * Sets best_stair to the coordinates of the best stair on the player's current
  * level to take to get to the 'target' level. Should be called with 'distance'
@@ -3051,118 +3406,157 @@ static int _target_distance_from(const coord_def &pos)
  *
  * This function has undefined behaviour when the target position is not
  * traversable.
+ *
+ * The search is Dijkstra's algorithm over the stair graph of all known
+ * levels, expanding entry points in order of increasing distance. The
+ * stair_info::distance fields (cleared by clear_distances() before the
+ * search) double as the distance labels. A depth-first formulation of the
+ * same relaxation used to re-expand a level every time a shorter route to it
+ * was found, which on characters with many visited levels produced stalls
+ * long enough to look like a hang; best-first order expands each stair once.
  */
 static int _find_transtravel_stair(const level_id &cur,
                                     const level_pos &target,
                                     int distance,
-                                    // This is actually the current position
-                                    // on cur, not necessarily a stair.
                                     const coord_def &stair,
                                     level_id &closest_level,
                                     int &best_level_distance,
-                                    coord_def &best_stair,
-                                    int search_depth = 0)
+                                    coord_def &best_stair)
 {
     int local_distance = -1;
     level_id player_level = level_id::current();
 
-    LevelInfo &li = travel_cache.get_level_info(cur);
+    priority_queue<transtravel_frontier, vector<transtravel_frontier>,
+                   transtravel_frontier_farther> frontier;
+    frontier.push({ distance, cur, stair, coord_def(-1, -1) });
 
-    // Have we reached the target level?
-    if (cur == target.id)
+    while (!frontier.empty())
     {
-        // Are we in an exclude? If so, bail out. Unless it is just a stair exclusion.
-        if (is_excluded(stair, li.get_excludes()) && !is_stair_exclusion(stair))
-            return -1;
+        const transtravel_frontier node = frontier.top();
+        frontier.pop();
 
-        // If there's no target position on the target level, or we're on the
-        // target, we're home.
-        if (target.pos.x == -1 || target.pos == stair)
-            return distance;
+        const level_id lev = node.lev;
+        const coord_def pos = node.pos;
+        const int dist = node.dist;
 
-        // If there *is* a target position, we need to work out our distance
-        // from it.
-        int deltadist = _target_distance_from(stair);
+        // Any route through this entry can only be longer than the best
+        // arrival already found.
+        if (local_distance != -1 && dist >= local_distance)
+            continue;
 
-        if (deltadist == -1 && cur == player_level)
-        {
-            // Okay, we don't seem to have a distance available to us, which
-            // means we're either (a) not standing on stairs or (b) whoever
-            // initiated interlevel travel didn't call
-            // _populate_stair_distances. Assuming we're not on stairs, that
-            // situation can arise only if interlevel travel has been triggered
-            // for a location on the same level. If that's the case, we can get
-            // the distance off the travel_point_distance matrix.
-            deltadist = travel_point_distance[target.pos.x][target.pos.y];
-            if (!deltadist && stair != target.pos)
-                deltadist = -1;
-        }
+        LevelInfo &li = travel_cache.get_level_info(lev);
 
-        if (deltadist != -1)
+        // this_stair being nullptr is perfectly acceptable, since we start
+        // with coords as the player coords, and the player need not be
+        // standing on stairs.
+        stair_info *this_stair = li.get_stair(pos);
+
+        // A shorter route to this stair was already found (and, for an
+        // intra-level route, dominates this one by the triangle inequality);
+        // this entry is stale.
+        if (this_stair && this_stair->distance != -1
+            && this_stair->distance < dist)
         {
-            local_distance = distance + deltadist;
-
-            // See if this is a degenerate case of interlevel travel:
-            // A degenerate case of interlevel travel decays to normal travel;
-            // we identify this by checking if:
-            // a. The current level is the target level.
-            // b. The target square is reachable from the 'current' square.
-            // c. The current square is where the player is.
-            //
-            // Note that even if this *is* degenerate, interlevel travel may
-            // still be able to find a shorter route, since it can consider
-            // routes that leave and reenter the current level.
-            if (player_level == target.id && stair == you.pos())
-                best_stair = target.pos;
-
-            // The local_distance is already set, but there may actually be
-            // stairs we can take that'll get us to the target faster than the
-            // direct route, so we also try the stairs.
+            continue;
         }
-    }
 
-    vector<stair_info> &stairs = li.get_stairs();
+        const bool at_source = lev == player_level && pos == you.pos();
 
-    // this_stair being nullptr is perfectly acceptable, since we start with
-    // coords as the player coords, and the player need not be standing on
-    // stairs.
-    stair_info *this_stair = li.get_stair(stair);
+        // Have we reached the target level?
+        if (lev == target.id)
+        {
+            // Are we in an exclude? If so, bail out. Unless it is just a
+            // stair exclusion.
+            if (is_excluded(pos, li.get_excludes()) && !is_stair_exclusion(pos))
+                continue;
 
-    if (!this_stair && cur != player_level)
-    {
-        // Whoops, there's no stair in the travel cache for the current
-        // position, and we're not on the player's current level (i.e., there
-        // certainly *should* be a stair here). Since we can't proceed in any
-        // reasonable way, bail out.
-        return local_distance;
-    }
+            // If there's no target position on the target level, or we're on
+            // the target, we're home; routes through here can't get shorter.
+            if (target.pos.x == -1 || target.pos == pos)
+            {
+                if (local_distance == -1 || dist < local_distance)
+                {
+                    local_distance = dist;
+                    if (!at_source)
+                        best_stair = node.first_stair;
+                }
+                continue;
+            }
 
-    for (stair_info &si : stairs)
-    {
-        if (stairs_destination_is_excluded(si))
-            continue;
+            // If there *is* a target position, we need to work out our
+            // distance from it.
+            int deltadist = _target_distance_from(pos);
 
-        // Skip placeholders and excluded stairs.
-        if (!si.can_travel() || is_excluded(si.position, li.get_excludes()))
-            continue;
+            if (deltadist == -1 && lev == player_level)
+            {
+                // Okay, we don't seem to have a distance available to us,
+                // which means we're either (a) not standing on stairs or (b)
+                // whoever initiated interlevel travel didn't call
+                // _populate_stair_distances. Assuming we're not on stairs,
+                // that situation can arise only if interlevel travel has been
+                // triggered for a location on the same level. If that's the
+                // case, we can get the distance off the travel_point_distance
+                // matrix.
+                deltadist = travel_point_distance_at(target.pos);
+                if (!deltadist && pos != target.pos)
+                    deltadist = -1;
+            }
 
-        int deltadist = li.distance_between(this_stair, &si);
+            if (deltadist != -1
+                && (local_distance == -1 || dist + deltadist < local_distance))
+            {
+                local_distance = dist + deltadist;
+
+                // See if this is a degenerate case of interlevel travel:
+                // A degenerate case of interlevel travel decays to normal
+                // travel; we identify this by checking if:
+                // a. The current level is the target level.
+                // b. The target square is reachable from the 'current' square.
+                // c. The current square is where the player is.
+                //
+                // Note that even if this *is* degenerate, interlevel travel
+                // may still be able to find a shorter route, since it can
+                // consider routes that leave and reenter the current level,
+                // so we fall through and try the stairs as well.
+                best_stair = at_source ? target.pos : node.first_stair;
+            }
+        }
 
-        if (!this_stair)
+        if (!this_stair && !at_source)
         {
-            deltadist = travel_point_distance[si.position.x][si.position.y];
-            if (!deltadist && you.pos() != si.position)
-                deltadist = -1;
-        }
-        // deltadist == 0 is legal (if this_stair is nullptr), since the player
-        // may be standing on the stairs. If two stairs are disconnected,
-        // deltadist has to be negative.
-        if (deltadist < 0)
+            // Whoops, there's no stair in the travel cache for the current
+            // position, and we're not at the player's position (i.e., there
+            // certainly *should* be a stair here). Since we can't proceed in
+            // any reasonable way, skip this entry.
             continue;
+        }
 
-        int dist2stair = distance + deltadist;
-        if (si.distance == -1 || si.distance > dist2stair)
+        for (stair_info &si : li.get_stairs())
         {
+            if (stairs_destination_is_excluded(si))
+                continue;
+
+            // Skip placeholders and excluded stairs.
+            if (!si.can_travel() || is_excluded(si.position, li.get_excludes()))
+                continue;
+
+            int deltadist = li.distance_between(this_stair, &si);
+
+            if (!this_stair)
+            {
+                deltadist = travel_point_distance_at(si.position);
+                if (!deltadist && you.pos() != si.position)
+                    deltadist = -1;
+            }
+            // deltadist == 0 is legal (if this_stair is nullptr), since the
+            // player may be standing on the stairs. If two stairs are
+            // disconnected, deltadist has to be negative.
+            if (deltadist < 0)
+                continue;
+
+            int dist2stair = dist + deltadist;
+            if (si.distance != -1 && si.distance <= dist2stair)
+                continue;
             si.distance = dist2stair;
 
             // Account for the cost of taking the stairs
@@ -3185,6 +3579,10 @@ static int _find_transtravel_stair(const level_id &cur,
                 continue;
             }
 
+            // The stair starting this route from the player's position.
+            const coord_def first_stair =
+                at_source ? si.position : node.first_stair;
+
             // We can only short-circuit the stair-following process if we
             // have no exact target location. If there *is* an exact target
             // location, we can't follow stairs for which we have incomplete
@@ -3195,19 +3593,18 @@ static int _find_transtravel_stair(const level_id &cur,
                 if (local_distance == -1 || local_distance > dist2stair)
                 {
                     local_distance = dist2stair;
-                    if (cur == player_level && you.pos() == stair)
-                        best_stair = si.position;
+                    best_stair = first_stair;
                 }
                 continue;
             }
 
             if (dest.id.depth > -1) // We have a valid level descriptor.
             {
-                int dist = level_distance(dest.id, target.id);
-                if (dist != -1 && (dist < best_level_distance
-                                   || best_level_distance == -1))
+                int ldist = level_distance(dest.id, target.id);
+                if (ldist != -1 && (ldist < best_level_distance
+                                    || best_level_distance == -1))
                 {
-                    best_level_distance = dist;
+                    best_level_distance = ldist;
                     closest_level       = dest.id;
                 }
             }
@@ -3216,17 +3613,17 @@ static int _find_transtravel_stair(const level_id &cur,
             if (!dest.is_valid())
                 continue;
 
-            // Don't try hell branches if we are not already in one or targeting
-            // one. When you actually enter the vestibule, the branch entry
-            // point is adjusted to be the portal you entered through, but
-            // autotravel needs to simulate this somehow, or it can find (fake)
-            // paths through hell that are shortcuts in depths, because the
-            // vestibule side of the portals do map to particular portals
-            // scattered throughout depths, even if those mappings won't be
-            // used while exiting from the vestibule.
+            // Don't try hell branches if we are not already in one or
+            // targeting one. When you actually enter the vestibule, the
+            // branch entry point is adjusted to be the portal you entered
+            // through, but autotravel needs to simulate this somehow, or it
+            // can find (fake) paths through hell that are shortcuts in
+            // depths, because the vestibule side of the portals do map to
+            // particular portals scattered throughout depths, even if those
+            // mappings won't be used while exiting from the vestibule.
             if (is_hell_branch(dest.id.branch)
                             && !(is_hell_branch(target.id.branch)
-                                 || is_hell_branch(cur.branch)))
+                                 || is_hell_branch(lev.branch)))
             {
                 continue;
             }
@@ -3236,31 +3633,18 @@ static int _find_transtravel_stair(const level_id &cur,
             LevelInfo &lo = travel_cache.get_level_info(dest.id);
             if (stair_info *so = lo.get_stair(dest.pos))
             {
-                if (so->distance == -1 || so->distance > dist2stair)
-                    so->distance = dist2stair;
-                else
+                if (so->distance != -1 && so->distance <= dist2stair)
                     continue;   // We've already been here.
+                so->distance = dist2stair;
             }
 #ifdef DEBUG_TRAVEL
-            string indent(search_depth, '.');
-            dprf("%strying stairs at %d,%d, dest is %d depth %d, pos %d,%d",
-                indent.c_str(), si.position.x, si.position.y, dest.id.branch,
+            dprf("trying stairs at %d,%d, dest is %d depth %d, pos %d,%d",
+                si.position.x, si.position.y, dest.id.branch,
                 dest.id.depth, dest.pos.x, dest.pos.y);
 #endif
 
             // Okay, take these stairs and keep going.
-            const int newdist =
-                _find_transtravel_stair(dest.id, target,
-                                        dist2stair, dest.pos, closest_level,
-                                        best_level_distance, best_stair,
-                                        search_depth + 1);
-            if (newdist != -1
-                && (local_distance == -1 || local_distance > newdist))
-            {
-                local_distance = newdist;
-                if (cur == player_level && you.pos() == stair)
-                    best_stair = si.position;
-            }
+            frontier.push({ dist2stair, dest.id, dest.pos, first_stair });
         }
     }
     return local_distance;
@@ -3282,7 +3666,7 @@ static void _populate_stair_distances(const level_pos &target)
     curr_stairs.clear();
     for (stair_info si : travel_cache.get_level_info(target.id).get_stairs())
     {
-        si.distance = travel_point_distance[si.position.x][si.position.y];
+        si.distance = travel_point_distance_at(si.position);
         if (!si.distance && target.pos != si.position
             || si.distance < -1)
         {
@@ -3299,7 +3683,7 @@ static coord_def _find_closest_adj(coord_def targ)
     int closest_dist = INT_MAX;
     for (adjacent_iterator ai(targ); ai; ++ai)
     {
-        const int dist = travel_point_distance[ai->x][ai->y];
+        const int dist = travel_point_distance_at(*ai);
         if (dist > 0 && dist < closest_dist)
         {
             closest_pos = *ai;
@@ -3536,25 +3920,24 @@ level_id level_id::get_next_level_id(const coord_def &pos)
 
 string level_id::describe(bool long_name, bool with_number) const
 {
-    string result = (long_name ? branches[branch].longname
-                               : branches[branch].abbrevname);
+    // Format straight from the static branch data; no intermediate
+    // string is needed unless we have to decapitalise "The".
+    const char *base = long_name ? branches[branch].longname
+                                 : branches[branch].abbrevname;
+
+    if (!with_number || brdepth[branch] == 1)
+        return base;
 
-    if (with_number && brdepth[branch] != 1)
+    if (long_name)
     {
-        if (long_name)
-        {
-            // decapitalise 'the'
-            if (starts_with(result, "The"))
-                result[0] = 't';
-            result = make_stringf("Level %d of %s",
-                      depth, result.c_str());
-        }
-        else if (depth)
-            result = make_stringf("%s:%d", result.c_str(), depth);
-        else
-            result = make_stringf("%s:$", result.c_str());
+        // decapitalise 'the'
+        if (strncmp(base, "The", 3) == 0)
+            return make_stringf("Level %d of t%s", depth, base + 1);
+        return make_stringf("Level %d of %s", depth, base);
     }
-    return result;
+    if (depth)
+        return make_stringf("%s:%d", base, depth);
+    return make_stringf("%s:$", base);
 }
 
 level_id level_id::parse_level_id(const string &s)
@@ -3726,15 +4109,19 @@ void LevelInfo::update_stair_distances()
         set_distance_between_stairs(s, s, 0);
 
         // For each stair, we need to ask travel to populate the distance
-        // array.
-        fill_travel_point_distance(stairs[s].position);
+        // array. Only the distances to the remaining stairs are
+        // needed, so let the flood stop once it has settled them all.
+        vector<coord_def> other_stairs;
+        for (int other = s + 1; other < nstairs; ++other)
+            other_stairs.push_back(stairs[other].position);
+        fill_travel_point_distance(stairs[s].position, nullptr, &other_stairs);
 
         // Assume movement distance between stairs is commutative,
         // i.e. going from a->b is the same distance as b->a.
         for (int other = s + 1; other < nstairs; ++other)
         {
             const coord_def op = stairs[other].position;
-            const int dist = travel_point_distance[op.x][op.y];
+            const int dist = travel_point_distance_at(op);
             set_distance_between_stairs(s, other, dist);
         }
     }
@@ -59,6 +59,10 @@ void stop_running(bool clear_delays = true);
 void travel_init_load_level();
 void travel_init_new_level();
 
+// Keep the explore frontier set in sync with map knowledge.
+void explore_frontier_seen(const coord_def &pos);
+void explore_frontier_invalidate();
+
 uint8_t is_waypoint(const coord_def &p);
 command_type direction_to_command(int x, int y);
 bool is_resting();
@@ -77,7 +81,13 @@ bool is_unknown_stair(const coord_def &p);
 bool is_unknown_transporter(const coord_def &p);
 
 void fill_travel_point_distance(const coord_def& youpos,
-                     vector<coord_def>* coords = nullptr);
+                     vector<coord_def>* coords = nullptr,
+                     const vector<coord_def>* stop_points = nullptr);
+
+// Drop the memoized travel_point_distance flood; must be called by
+// anything that changes what a travel flood would compute (terrain,
+// exclusions) or that scribbles on the grid directly.
+void travel_invalidate_distance_cache();
 
 bool is_stair_exclusion(const coord_def &p);
 
@@ -155,6 +165,13 @@ const int PD_CLOUD = -20101;
  * *********************************************************************** */
 extern travel_distance_grid_t travel_point_distance;
 
+// The distance the last travel flood assigned to p, or 0 if the flood
+// never reached it. Cells are invalidated by generation stamping rather
+// than a grid-wide clear, so read distances through this instead of
+// indexing travel_point_distance directly. (Level generation uses the
+// grid as raw scratch and is exempt.)
+int travel_point_distance_at(const coord_def &p);
+
 ////////////////////////////////////////////////////////////////////////////
 // Structs for interlevel travel.
 
@@ -461,6 +478,11 @@ public:
     // For flood-fills (explore), sets starting (seed) square.
     void set_floodseed(const coord_def &seed, bool double_flood = false);
 
+    // For flood-fills that only need distances to certain cells:
+    // stop the flood once every one of these has been settled,
+    // instead of flooding the rest of the level.
+    void set_floodstops(const vector<coord_def> &stops);
+
     // For regular travel, set starting point (usually the character's current
     // position) and destination.
     void set_src_dst(const coord_def &src, const coord_def &dst);
@@ -495,8 +517,14 @@ protected:
     virtual bool path_flood(const coord_def &c, const coord_def &dc);
     bool square_slows_movement(const coord_def &c);
     void check_square_greed(const coord_def &c);
+    void note_floodstop(const coord_def &c);
     void good_square(const coord_def &c);
 
+    // Generation-stamped access to the distance grid; a cell unwritten
+    // since the last clear reads as 0.
+    int pd_at(const coord_def &c) const;
+    void pd_set(const coord_def &c, int dist);
+
 protected:
     static const int UNFOUND_DIST  = -30000;
     static const int INFINITE_DIST =  INFINITE_DISTANCE;
@@ -555,6 +583,15 @@ protected:
     // List of unexplored and unreachable points.
     set<coord_def> unreachables;
 
+    // Cells whose settlement ends the flood; see set_floodstops().
+    vector<coord_def> flood_stops;
+    bool have_flood_stops;
+
+    // Explore frontier squares this flood has yet to examine; only
+    // meaningful when track_frontier is set.
+    set<coord_def> frontier_pending;
+    bool track_frontier;
+
     travel_distance_col *point_distance;
 
     // How many points we'll consider next iteration.
@@ -492,6 +492,27 @@ int strwidth(const string &s)
     return strwidth(s.c_str());
 }
 
+void utf8_to_glyphs(const char *s, vector<ucs_glyph> &out)
+{
+    out.clear();
+    char32_t c;
+
+    while (*s)
+    {
+        if (*s > 0x1f && *s < 0x7f)
+        {
+            // Printable ASCII: always one column.
+            out.push_back({ (char32_t)*s++, 1 });
+            continue;
+        }
+        const int l = utf8towc(&c, s);
+        if (!l)
+            break;
+        s += l;
+        out.push_back({ c, c ? wcwidth(c) : 0 });
+    }
+}
+
 int wclen(char32_t c)
 {
     char dummy[4];
@@ -42,6 +42,18 @@ static inline string mb_to_utf8(const string &s)
 
 int wclen(char32_t c);
 
+// One decoded glyph of a UTF-8 string: the codepoint and its terminal
+// column width as wcwidth reports it (-1 for control characters).
+struct ucs_glyph
+{
+    char32_t code;
+    int width;
+};
+
+// Decode a whole string in one pass, so draw loops don't re-enter the
+// decoder and the width lookup once per character.
+void utf8_to_glyphs(const char *s, vector<ucs_glyph> &out);
+
 #ifndef UNIX
 int wcwidth(char32_t c);
 #endif
@@ -284,7 +284,7 @@ class DiceDef:
     def format(self):
         if self.num == 0 and self.size == 0 and self.mult == 0 and self.div == 0:
             return 'nullptr'
-        return "new dicedef_calculator<{},{},{},{}>".format(self.num, self.size, self.mult, self.div)
+        return "dicedef_calculator<{},{},{},{}>".format(self.num, self.size, self.mult, self.div)
 
 # Extremely simple/dumb parser that just lets you write dice formulas in a more readable way
 def parse_dice(s):
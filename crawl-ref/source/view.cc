@@ -28,6 +28,7 @@
 #include "religion.h"
 #include "showsymb.h"
 #include "tag-version.h"
+#include "terrain.h" // terrain_change_mark
 #include "tilemcache.h"
 #ifdef USE_TILE
  #include "tile-flags.h"
@@ -40,6 +41,7 @@
 #include "ui.h"
 #include "unicode.h"
 #include "viewmap.h"
+#include "zone-profile.h"
 
 static layers_type _layers = LAYERS_ALL;
 static layers_type _layers_saved = Layer::None;
@@ -199,6 +201,34 @@ void redraw_view_at(coord_def pos)
 #endif
 }
 
+// One consolidated redraw pass over a rectangle of cells, for callers that
+// have just rewritten map knowledge over a whole region. Unlike per-cell
+// redraw_view_at(), each cell - including the one-cell margin needed for
+// the explore horizon on the minimap - is touched exactly once.
+void redraw_view_region(coord_def tl, coord_def br)
+{
+    tl.x = max(tl.x - 1, 0);
+    tl.y = max(tl.y - 1, 0);
+    br.x = min(br.x + 1, GXM - 1);
+    br.y = min(br.y + 1, GYM - 1);
+
+    for (rectangle_iterator ri(tl, br); ri; ++ri)
+    {
+#ifdef USE_TILE
+        tile_draw_map_cell(*ri);
+#endif
+#ifdef USE_TILE_WEB
+        tiles.mark_for_redraw(*ri);
+#endif
+#ifndef USE_TILE_LOCAL
+        _redraw_console_at(*ri);
+#endif
+#ifdef USE_TILE
+        tiles.update_minimap(*ri);
+#endif
+    }
+}
+
 bool view_update()
 {
     if (you.num_turns > you.last_view_update)
@@ -210,16 +240,46 @@ bool view_update()
     return false;
 }
 
+// Animation time already charged to the current turn, for the
+// animation_budget_ms throttle. Once a turn has spent its budget, later
+// animation frames still render but their waits are dropped, so stacked
+// beam and cloud animations (e.g. many casters acting in one turn)
+// degrade to a fast-forward instead of a serial sleep per frame.
+static int _anim_budget_spent = 0;
+static int _anim_budget_turn  = -1;
+
+static bool _charge_animation_budget(unsigned int ms)
+{
+    if (_anim_budget_turn != (int)you.num_turns)
+    {
+        _anim_budget_turn  = (int)you.num_turns;
+        _anim_budget_spent = 0;
+    }
+    if (Options.animation_budget_ms <= 0)
+        return true;
+    const bool within = _anim_budget_spent < Options.animation_budget_ms;
+    _anim_budget_spent += ms;
+    return within;
+}
+
 void animation_delay(unsigned int ms, bool do_refresh)
 {
     // this leaves any Options.use_animations & UA_BEAM checks to the caller;
     // but maybe it could be refactored into here
+#ifdef USE_TILE_WEB
+    // Under the webserver with no player or spectator connected (e.g. a
+    // headless bot game), nothing would render this frame: skip both the
+    // redraw and the wait.
+    if (tiles.is_controlled_from_web() && !tiles.has_receivers())
+        return;
+#endif
     if (do_refresh)
     {
         viewwindow(false);
         update_screen();
     }
-    scaled_delay(ms);
+    if (_charge_animation_budget(ms))
+        scaled_delay(ms);
 }
 
 static void _flash_view(colour_t colour, targeter* where)
@@ -250,8 +310,14 @@ void flash_view_delay(use_animation_type a, colour_t colour, int flash_delay,
 {
     if (crawl_state.need_save && Options.use_animations & a)
     {
+#ifdef USE_TILE_WEB
+        // As in animation_delay: no connected client, no flash.
+        if (tiles.is_controlled_from_web() && !tiles.has_receivers())
+            return;
+#endif
         _flash_view(colour, where);
-        scaled_delay(flash_delay);
+        if (_charge_animation_budget(flash_delay))
+            scaled_delay(flash_delay);
         _flash_view(BLACK, nullptr);
     }
 }
@@ -586,6 +652,19 @@ void run_animation(animation_type anim, use_animation_type type, bool cleanup)
 static bool _view_is_updating = false;
 
 crawl_view_buffer view_dungeon(animation *a, bool anim_updates, view_renderer *renderer);
+static bool _overlays_empty();
+
+// The last rendered view buffer. Quiet refreshes — a keypress with
+// nothing changed underneath — used to walk the whole view rectangle
+// rebuilding every cell through showsymb; when nothing that feeds the
+// cells has changed since the frame was built, hand the frontends the
+// cached buffer instead (the console repaints from it, webtiles diffs
+// internally). Any show update, animation, flash, overlay, restricted
+// layer set or passage of game time forces a rebuild.
+static crawl_view_buffer _last_vbuf;
+static int _last_vbuf_turn = -1;
+static coord_def _last_vbuf_centre;
+static bool _last_vbuf_valid = false;
 
 static bool _viewwindow_should_render()
 {
@@ -614,6 +693,7 @@ static bool _viewwindow_should_render()
  */
 void viewwindow(bool show_updates, bool tiles_only, animation *a, view_renderer *renderer)
 {
+    PERF_ZONE("viewwindow");
     if (_view_is_updating)
     {
         // recursive calls to this function can lead to memory corruption or
@@ -688,7 +768,26 @@ void viewwindow(bool show_updates, bool tiles_only, animation *a, view_renderer
 
         if (_viewwindow_should_render())
         {
-            const auto vbuf = view_dungeon(a, anim_updates, renderer);
+            // A frame is cacheable if it shows the plain state of the
+            // world: no animation or renderer injections, no flash, no
+            // overlays, all layers on.
+            const bool cacheable = !a && !renderer && _layers == LAYERS_ALL
+                                   && you.flash_colour == BLACK
+                                   && !you.flash_where
+                                   && _overlays_empty();
+            const bool reuse = cacheable && !show_updates && !anim_updates
+                               && _last_vbuf_valid
+                               && _last_vbuf_turn == (int)you.num_turns
+                               && _last_vbuf_centre == crawl_view.vgrdc
+                               && _last_vbuf.size() == crawl_view.viewsz;
+            if (!reuse)
+            {
+                _last_vbuf = view_dungeon(a, anim_updates, renderer);
+                _last_vbuf_valid = cacheable;
+                _last_vbuf_turn = you.num_turns;
+                _last_vbuf_centre = crawl_view.vgrdc;
+            }
+            const crawl_view_buffer &vbuf = _last_vbuf;
 
             you.last_view_update = you.num_turns;
 #ifndef USE_TILE_LOCAL
@@ -772,6 +871,15 @@ void flash_tile(coord_def p, colour_t colour, int delay, tileidx_t tile)
         animation_delay(delay, true);
 }
 
+static bool _overlays_empty()
+{
+#ifdef USE_TILE
+    if (!tile_overlays.empty())
+        return false;
+#endif
+    return glyph_overlays.empty();
+}
+
 void view_clear_overlays()
 {
 #ifdef USE_TILE
@@ -906,6 +1014,48 @@ crawl_view_buffer view_dungeon(animation *a, bool anim_updates, view_renderer *r
     return vbuf;
 }
 
+// While aiming, every keystroke redraws the view and draw_cell asks the
+// active targeter whether each cell is a valid aim to grey out the rest.
+// valid_aim can be expensive (beam targeters trace a ray per query) but
+// only depends on the targeter, the origin and the terrain, so the
+// answers are memoized per cell until any of those change. The memo is
+// reset from range_view_annotator as well, since a later aiming prompt
+// can reuse a dead targeter's address.
+static map_bitmask _darken_aim_valid;
+static map_bitmask _darken_aim_known;
+static const targeter *_darken_aim_for = nullptr;
+static coord_def _darken_aim_origin(-1, -1);
+static unsigned _darken_aim_terrain_mark = 0;
+
+void invalidate_darken_range_cache()
+{
+    _darken_aim_for = nullptr;
+}
+
+static bool _darken_range_valid_aim(const coord_def &gc)
+{
+    targeter *range = crawl_state.darken_range;
+    if (!map_bounds(gc))
+        return range->valid_aim(gc);
+
+    if (_darken_aim_for != range
+        || _darken_aim_origin != you.pos()
+        || _darken_aim_terrain_mark != terrain_change_mark())
+    {
+        _darken_aim_known.reset();
+        _darken_aim_for = range;
+        _darken_aim_origin = you.pos();
+        _darken_aim_terrain_mark = terrain_change_mark();
+    }
+
+    if (!_darken_aim_known(gc))
+    {
+        _darken_aim_valid.set(gc, range->valid_aim(gc));
+        _darken_aim_known.set(gc);
+    }
+    return _darken_aim_valid(gc);
+}
+
 void draw_cell(screen_cell_t *cell, const coord_def &gc,
                bool anim_updates, int flash_colour)
 {
@@ -978,7 +1128,7 @@ void draw_cell(screen_cell_t *cell, const coord_def &gc,
     else if (crawl_state.darken_range)
     {
         if ((crawl_state.darken_range->obeys_mesmerise && mesmerise_excluded)
-            || (!crawl_state.darken_range->valid_aim(gc)))
+            || (!_darken_range_valid_aim(gc)))
         {
             if (allow_mon_recolour)
                 cell->colour = DARKGREY;
@@ -21,6 +21,10 @@ colour_t viewmap_flash_colour();
 bool view_update();
 void view_update_at(const coord_def &pos);
 void redraw_view_at(coord_def pos);
+void redraw_view_region(coord_def tl, coord_def br);
+// Drop the memoized valid-aim overlay; called when the active range
+// targeter is installed or removed.
+void invalidate_darken_range_cache();
 class targeter;
 
 static inline void scaled_delay(unsigned int ms)
@@ -67,7 +67,7 @@ static unsigned _get_travel_colour(const coord_def& p)
         = feat_is_traversable(env.grid(p)) ? Options.tc_forbidden
                                       : Options.tc_dangerous;
 
-    const short dist = travel_point_distance[p.x][p.y];
+    const short dist = travel_point_distance_at(p);
     return dist > 0?                    Options.tc_reachable        :
            dist == PD_EXCLUDED ?        Options.tc_excluded         :
            dist == PD_EXCLUDED_RADIUS ? Options.tc_exclude_circle   :
@@ -79,7 +79,7 @@ static unsigned _get_travel_colour(const coord_def& p)
 bool travel_colour_override(const coord_def& p)
 {
     if (is_waypoint(p) || is_stair_exclusion(p)
-       || travel_point_distance[p.x][p.y] == PD_EXCLUDED)
+       || travel_point_distance_at(p) == PD_EXCLUDED)
     {
         return true;
     }
@@ -261,6 +261,80 @@ static int _get_number_of_lines_levelmap()
     return get_number_of_lines() - 1;
 }
 
+static screen_cell_t _map_cell_contents(const coord_def &c, bool travel_mode,
+                                        bool on_level)
+{
+    screen_cell_t cell = {};
+
+    cglyph_t g = get_cell_glyph(c, false, -1);
+    cell.glyph = g.ch;
+    cell.colour = g.col;
+
+    const show_class show = get_cell_show_class(env.map_knowledge(c));
+
+    if (show == SH_NOTHING && is_explore_horizon(c))
+    {
+        const feature_def& fd = get_feature_def(DNGN_EXPLORE_HORIZON);
+        cell.glyph = fd.symbol();
+        cell.colour = fd.colour();
+    }
+
+    if (travel_mode && travel_colour_override(c))
+        cell.colour = _get_travel_colour(c);
+
+    // If we've a waypoint on the current square,
+    // show the waypoint number.
+    const uint8_t waypoint_char = is_waypoint(c);
+    if (waypoint_char)
+        cell.glyph = waypoint_char;
+
+    if (c == you.pos() && !crawl_state.arena_suspended && on_level)
+    {
+        // [dshaligram] Draw the @ symbol on the
+        // level-map. It's no longer saved into the
+        // env.map_knowledge, so we need to draw it
+        // directly.
+        cell.colour = WHITE;
+        cell.glyph  = mons_char(you.symbol);
+    }
+
+    if (Options.show_travel_trail && travel_trail_index(c) >= 0)
+    {
+        const feature_def& fd = get_feature_def(DNGN_TRAVEL_TRAIL);
+
+        // Don't overwrite the player's symbol
+        if (fd.symbol() && c != you.pos())
+            cell.glyph = fd.symbol();
+        if (fd.colour() != COLOUR_UNDEF)
+            cell.colour = fd.colour();
+
+        cell.colour |= COLFLAG_REVERSE;
+    }
+
+    return cell;
+}
+
+// The whole level rendered at once, so that opening the map is a blit
+// of the visible window and scrolling doesn't recompute any cells. The
+// render is redone when its inputs change: a turn passing or the player
+// moving (map knowledge, travel trail and explore horizon only change
+// along with those while the map is up), a level switch, or one of the
+// explicit invalidation points below (forgetting the map, and travel
+// colour/waypoint/exclusion updates, which all funnel through
+// _reset_travel_colours).
+static crawl_view_buffer _level_map_cache;
+static level_id _level_map_cache_level;
+static int _level_map_cache_turn = -1;
+static coord_def _level_map_cache_player;
+static bool _level_map_cache_travel = false;
+static bool _level_map_cache_on_level = false;
+static bool _level_map_cache_valid = false;
+
+static void _invalidate_level_map_cache()
+{
+    _level_map_cache_valid = false;
+}
+
 static void _draw_level_map(int start_x, int start_y, bool travel_mode,
         bool on_level, ui::Region region)
 {
@@ -273,10 +347,32 @@ static void _draw_level_map(int start_x, int start_y, bool travel_mode,
 
     cursor_control cs(false);
 
+    if (!_level_map_cache_valid
+        || _level_map_cache_level != level_id::current()
+        || _level_map_cache_turn != you.num_turns
+        || _level_map_cache_player != you.pos()
+        || _level_map_cache_travel != travel_mode
+        || _level_map_cache_on_level != on_level)
+    {
+        _level_map_cache = crawl_view_buffer(coord_def(GXM, GYM));
+        screen_cell_t *mc = _level_map_cache;
+        for (int y = 0; y < GYM; y++)
+            for (int x = 0; x < GXM; x++)
+                *mc++ = _map_cell_contents(coord_def(x, y), travel_mode,
+                                           on_level);
+        _level_map_cache_level = level_id::current();
+        _level_map_cache_turn = you.num_turns;
+        _level_map_cache_player = you.pos();
+        _level_map_cache_travel = travel_mode;
+        _level_map_cache_on_level = on_level;
+        _level_map_cache_valid = true;
+    }
+
+    const screen_cell_t *map_cells = _level_map_cache;
     for (int screen_y = 0; screen_y < region.height; screen_y++)
         for (int screen_x = 0; screen_x < region.width; screen_x++)
         {
-            coord_def c(start_x + screen_x, start_y + screen_y);
+            const coord_def c(start_x + screen_x, start_y + screen_y);
 
             if (!map_bounds(c))
             {
@@ -284,52 +380,7 @@ static void _draw_level_map(int start_x, int start_y, bool travel_mode,
                 cell->glyph  = 0;
             }
             else
-            {
-                cglyph_t g = get_cell_glyph(c, false, -1);
-                cell->glyph = g.ch;
-                cell->colour = g.col;
-
-                const show_class show = get_cell_show_class(env.map_knowledge(c));
-
-                if (show == SH_NOTHING && is_explore_horizon(c))
-                {
-                    const feature_def& fd = get_feature_def(DNGN_EXPLORE_HORIZON);
-                    cell->glyph = fd.symbol();
-                    cell->colour = fd.colour();
-                }
-
-                if (travel_mode && travel_colour_override(c))
-                    cell->colour = _get_travel_colour(c);
-
-                // If we've a waypoint on the current square,
-                // show the waypoint number.
-                const uint8_t waypoint_char = is_waypoint(c);
-                if (waypoint_char)
-                    cell->glyph = waypoint_char;
-
-                if (c == you.pos() && !crawl_state.arena_suspended && on_level)
-                {
-                    // [dshaligram] Draw the @ symbol on the
-                    // level-map. It's no longer saved into the
-                    // env.map_knowledge, so we need to draw it
-                    // directly.
-                    cell->colour = WHITE;
-                    cell->glyph  = mons_char(you.symbol);
-                }
-
-                if (Options.show_travel_trail && travel_trail_index(c) >= 0)
-                {
-                    const feature_def& fd = get_feature_def(DNGN_TRAVEL_TRAIL);
-
-                    // Don't overwrite the player's symbol
-                    if (fd.symbol() && c != you.pos())
-                        cell->glyph = fd.symbol();
-                    if (fd.colour() != COLOUR_UNDEF)
-                        cell->colour = fd.colour();
-
-                    cell->colour |= COLFLAG_REVERSE;
-                }
-            }
+                *cell = map_cells[c.y * GXM + c.x];
 
             cell++;
         }
@@ -340,6 +391,10 @@ static void _draw_level_map(int start_x, int start_y, bool travel_mode,
 
 static void _reset_travel_colours(vector<coord_def> &features, bool on_level)
 {
+#ifndef USE_TILE_LOCAL
+    _invalidate_level_map_cache();
+#endif
+
     // We now need to redo travel colours.
     features.clear();
 
@@ -497,6 +552,9 @@ static level_pos _stair_dest(const coord_def& p, command_type dir)
 
 static void _unforget_map()
 {
+#ifndef USE_TILE_LOCAL
+    _invalidate_level_map_cache();
+#endif
     ASSERT(env.map_forgotten);
     MapKnowledge &old(*env.map_forgotten);
 
@@ -515,6 +573,9 @@ static void _unforget_map()
 
 static void _forget_map(bool wizard_forget = false)
 {
+#ifndef USE_TILE_LOCAL
+    _invalidate_level_map_cache();
+#endif
     for (rectangle_iterator ri(0); ri; ++ri)
     {
         auto& flags = env.map_knowledge(*ri).flags;
@@ -541,6 +602,7 @@ static void _forget_map(bool wizard_forget = false)
         tiles.update_minimap(*ri);
 #endif
     }
+    explore_frontier_invalidate();
 }
 
 map_control_state process_map_command(command_type cmd, const map_control_state &state);
@@ -68,9 +68,36 @@ function ($, comm, map_knowledge, view_data, monster_list, minimap,
         monster_list.clear();
     }
 
+    var current_level = null;
+
+    $(document).bind("game_init", function () {
+        current_level = null;
+    });
+
     // Message handlers
     function handle_map_message(data)
     {
+        if (data.lvl !== undefined && data.lvl !== current_level)
+        {
+            // Level change: stash the map knowledge of the level we are
+            // leaving and restore what we already have for the new one, so
+            // the server can send only the cells that changed since. If we
+            // have nothing stashed, the message carries a full map instead.
+            if (current_level !== null)
+                map_knowledge.stash_level(current_level);
+
+            dungeon_renderer.clear();
+            minimap.clear();
+            monster_list.clear();
+
+            if (map_knowledge.restore_level(data.lvl))
+                invalidate(true);
+            else
+                map_knowledge.clear();
+
+            current_level = data.lvl;
+        }
+
         if (data.clear)
             clear_map();
 
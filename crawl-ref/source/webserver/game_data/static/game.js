@@ -340,6 +340,11 @@ function ($, exports, comm, client, key_conversion, dungeon_renderer, display,
     {
         game_version = data;
         document.title = data.text;
+
+        // Opt into the packed cell encoding for map updates; the game keeps
+        // sending plain JSON cells until it hears this. These scripts are
+        // served per game version, so the decoder always matches the game.
+        comm.send_message("set_cell_protocol", { bincells: true });
     }
 
     function glyph_mode_font_init()
@@ -3,6 +3,11 @@ define(["jquery", "./enums", "./util"], function ($, enums, util) {
 
     var k, player_on_level, monster_table, dirty_locs, bounds, bounds_changed;
 
+    // Map knowledge of levels we left, keyed by level id, so that the server
+    // only has to send a delta when we come back. The server keeps a matching
+    // shadow of what it sent; levels it evicted arrive as a full map again.
+    var level_stashes;
+
     function init()
     {
         k = new Array(65536);
@@ -10,6 +15,7 @@ define(["jquery", "./enums", "./util"], function ($, enums, util) {
         dirty_locs = [];
         bounds = null;
         bounds_changed = false;
+        level_stashes = {};
     }
 
     $(document).bind("game_init", init);
@@ -37,6 +43,30 @@ define(["jquery", "./enums", "./util"], function ($, enums, util) {
         bounds = null;
     }
 
+    function stash_level(id)
+    {
+        level_stashes[id] = {
+            k: k,
+            monster_table: monster_table,
+            bounds: bounds
+        };
+    }
+
+    function restore_level(id)
+    {
+        var stash = level_stashes[id];
+        if (!stash)
+            return false;
+
+        delete level_stashes[id];
+        k = stash.k;
+        monster_table = stash.monster_table;
+        bounds = stash.bounds;
+        dirty_locs = [];
+        bounds_changed = true;
+        return true;
+    }
+
     function visible(cell)
     {
         if (cell.t)
@@ -121,6 +151,76 @@ define(["jquery", "./enums", "./util"], function ($, enums, util) {
         }
     }
 
+    // Decoder for the packed cell encoding produced by _write_tile_blob in
+    // tileweb.cc when the binary cell protocol has been negotiated: a base64
+    // string holding a 32-bit field presence mask followed by the packed
+    // little-endian field values. The field bits and encodings have to stay
+    // in sync with the C++ side.
+    function decode_cell_blob(blob)
+    {
+        var raw = atob(blob);
+        var pos = 0;
+        function u8() { return raw.charCodeAt(pos++); }
+        function u16() { return u8() | u8() << 8; }
+        function i32() { return u8() | u8() << 8 | u8() << 16 | u8() << 24; }
+        function tileidx()
+        {
+            // mirrors write_tileidx(): a plain (signed) int when the high
+            // word is zero, a [lo,hi] pair otherwise
+            var lo = i32(), hi = i32();
+            return hi === 0 ? lo : [lo, hi];
+        }
+
+        var mask = i32();
+        function flag(bit) { return mask & (1 << bit); }
+
+        var t = {};
+        if (flag(0)) t.fg = tileidx();
+        if (flag(1)) t.base = i32();
+        if (flag(2)) t.overlay1 = i32();
+        if (flag(3)) t.overlay2 = i32();
+        if (flag(4)) t.bg = tileidx();
+        if (flag(5)) t.cloud = tileidx();
+        if (flag(6))
+        {
+            var n = u8();
+            t.icons = [];
+            for (var i = 0; i < n; i++)
+                t.icons.push(tileidx());
+        }
+        if (flag(7)) t.bloody = !!u8();
+        if (flag(8)) t.old_blood = !!u8();
+        if (flag(9)) t.silenced = !!u8();
+        if (flag(10)) t.halo = u8();
+        if (flag(11)) t.highlighted_summoner = !!u8();
+        if (flag(12)) t.sanctuary = !!u8();
+        if (flag(13)) t.blasphemy = !!u8();
+        if (flag(14)) t.has_bfb_corpse = !!u8();
+        if (flag(15)) t.liquefied = !!u8();
+        if (flag(16)) t.orb_glow = u8();
+        if (flag(17)) t.quad_glow = !!u8();
+        if (flag(18)) t.disjunct = !!u8();
+        if (flag(19)) t.mangrove_water = !!u8();
+        if (flag(20)) t.awakened_forest = !!u8();
+        if (flag(21)) t.blood_rotation = u8();
+        if (flag(22)) t.travel_trail = u8();
+        if (flag(23))
+        {
+            t.flv = { f: u16() };
+            var s = u16();
+            if (s)
+                t.flv.s = s;
+        }
+        if (flag(24))
+        {
+            var count = u8();
+            t.ov = [];
+            for (var j = 0; j < count; j++)
+                t.ov.push(i32());
+        }
+        return t;
+    }
+
     var merge_last_x, merge_last_y;
 
     function merge(val)
@@ -149,6 +249,14 @@ define(["jquery", "./enums", "./util"], function ($, enums, util) {
             }
             else if (prop == "t")
             {
+                if (val.t.bl !== undefined)
+                {
+                    var decoded = decode_cell_blob(val.t.bl);
+                    delete val.t.bl;
+                    for (var dprop in decoded)
+                        val.t[dprop] = decoded[dprop];
+                }
+
                 entry[prop] = merge_objects(entry[prop], val[prop]);
 
                 // The transparency flag is linked to the doll;
@@ -211,6 +319,8 @@ define(["jquery", "./enums", "./util"], function ($, enums, util) {
         get: get,
         merge: merge_diff,
         clear: clear,
+        stash_level: stash_level,
+        restore_level: restore_level,
         touch: touch,
         visible: visible,
         player_on_level: function () { return player_on_level; },
@@ -1060,8 +1060,25 @@ class CrawlProcessHandler(CrawlProcessHandlerBase):
 
         if self.conn and self.conn.open:
             self._fresh_watchers.add(watcher)
+            # count first: the crawl side uses it to decide whether anyone
+            # would render what the spectator_joined resync produces.
+            self._send_receiver_count()
             self.conn.send_message('{"msg":"spectator_joined"}')
 
+    def remove_watcher(self, watcher):
+        super(CrawlProcessHandler, self).remove_watcher(watcher)
+        self._send_receiver_count()
+
+    def _send_receiver_count(self):
+        # Tell the crawl process how many connections (player plus
+        # spectators) receive its output, so it can skip presentation
+        # work -- animation frames and their delays -- when the count is
+        # zero, as in headless bot games.
+        if self.conn and self.conn.open:
+            self.conn.send_message(json_encode({
+                "msg": "watcher_count",
+                "count": len(self._receivers)}))
+
     def handle_input(self, msg): # type: (str) -> None
         obj = json_decode(msg)
 
@@ -283,6 +283,34 @@ def admin_only(f):
 MessageBundle = collections.namedtuple('MessageBundle', ["binmsg", "compressed"])
 MessageBundle.__bool__ = lambda self: bool(self.binmsg)
 
+
+# One-entry cache of the last encoded message batch. When a game fans one
+# tick's messages out to its spectators, every receiver's queue usually
+# holds the identical list of message strings, so the join + utf8 encode
+# only has to happen once and the resulting immutable bytes are shared by
+# reference between the sockets. Only the deflate step stays per-socket,
+# since each socket's compression stream is stateful. Returns None if the
+# batch cannot be encoded.
+_batch_cache_key = None # type: Optional[Tuple[str, ...]]
+_batch_cache_bin = None # type: Optional[bytes]
+
+def _encode_batch(message_queue):
+    # type: (List[str]) -> Optional[bytes]
+    global _batch_cache_key, _batch_cache_bin
+    key = tuple(message_queue)
+    if key != _batch_cache_key:
+        try:
+            binmsg = utf8("{\"msgs\":[" + ",".join(message_queue) + "]}")
+        except:
+            # might happen with weird utf-8 stuff...can this be handled more
+            # precisely?
+            logging.warning("Exception trying to encode message batch.",
+                            exc_info = True)
+            return None
+        _batch_cache_key = key
+        _batch_cache_bin = binmsg
+    return _batch_cache_bin
+
 class CrawlWebSocket(tornado.websocket.WebSocketHandler):
     def __init__(self, app, req, **kwargs):
         tornado.websocket.WebSocketHandler.__init__(self, app, req, **kwargs)
@@ -1354,9 +1382,8 @@ class CrawlWebSocket(tornado.websocket.WebSocketHandler):
                                     exc_info=True)
             self.failed_on_messages += 1
 
-    def _encode_for_send(self, msg, deflate):
+    def _encode_for_send(self, binmsg, deflate):
         try:
-            binmsg = utf8(msg)
             if deflate:
                 # Compress like in deflate-frame extension:
                 # Apply deflate, flush, then remove the 00 00 FF FF
@@ -1376,12 +1403,12 @@ class CrawlWebSocket(tornado.websocket.WebSocketHandler):
             return MessageBundle(None, None)
 
 
-    # send a single message batch, encoding and compressing it if necessary
-    def _send_raw_message(self, msg):
-        if self.client_closed or not msg:
+    # send a single pre-encoded message batch, compressing it if necessary
+    def _send_raw_message(self, binmsg):
+        if self.client_closed or not binmsg:
             return False
 
-        bundle = self._encode_for_send(msg, self.deflate)
+        bundle = self._encode_for_send(binmsg, self.deflate)
         if not bundle:
             self.failed_messages += 1
             return False
@@ -1453,11 +1480,13 @@ class CrawlWebSocket(tornado.websocket.WebSocketHandler):
         if self.client_closed or len(self.message_queue) == 0:
             return False
 
-        batch = ("{\"msgs\":["
-            + ",".join(self.message_queue)
-            + "]}")
+        queue = self.message_queue
         self.message_queue = [] # always empty the queue
-        return self._send_raw_message(batch)
+        binmsg = _encode_batch(queue)
+        if binmsg is None:
+            self.failed_messages += 1
+            return False
+        return self._send_raw_message(binmsg)
 
     # n.b. this looks a lot like superclass write_message, but has a static
     # type signature that is not compatible with it, so we do not override
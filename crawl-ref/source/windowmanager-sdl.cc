@@ -1141,8 +1141,37 @@ bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
                               unsigned int &orig_height, tex_proc_func proc,
                               bool force_power_of_two)
 {
-    char acBuffer[512];
+    unsigned char *pixels = nullptr;
+    unsigned int new_width = 0, new_height = 0;
 
+    if (!decode_texture(filename, &pixels, new_width, new_height,
+                        orig_width, orig_height, force_power_of_two))
+    {
+        return false;
+    }
+
+    glmanager->pixelstore_unpack_alignment(1);
+
+    bool success = false;
+    if (!proc || proc(pixels, new_width, new_height))
+    {
+        // TODO: could fail if texture is too large / if there are opengl errs
+        opengl::check_texture_size(filename, new_width, new_height);
+        success |= tex->load_texture(pixels, new_width, new_height, mip_opt);
+        opengl::flush_opengl_errors();
+    }
+
+    delete[] pixels;
+
+    return success;
+}
+
+bool SDLWrapper::decode_texture(const char *filename, unsigned char **out,
+                                unsigned int &width, unsigned int &height,
+                                unsigned int &orig_width,
+                                unsigned int &orig_height,
+                                bool force_power_of_two)
+{
     string tex_path = datafile_path(filename);
 
     if (tex_path.c_str()[0] == 0)
@@ -1168,10 +1197,9 @@ bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
     }
 
     unsigned int bpp = img->format->BytesPerPixel;
-    glmanager->pixelstore_unpack_alignment(1);
 
-    // Determine texture format
-    unsigned char *pixels = (unsigned char*)img->pixels;
+    // Convert into a tightly-packed RGBA copy that outlives the surface.
+    unsigned char *pixels = nullptr;
 
     int new_width;
     int new_height;
@@ -1220,34 +1248,31 @@ bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
     }
     else if (bpp == 3)
     {
-        if (new_width != img->w || new_height != img->h)
-        {
-            SDL_LockSurface(img);
-            pixels = new unsigned char[4 * new_width * new_height];
-            memset(pixels, 0, 4 * new_width * new_height);
+        SDL_LockSurface(img);
+        pixels = new unsigned char[4 * new_width * new_height];
+        memset(pixels, 0, 4 * new_width * new_height);
 
-            int dest = 0;
-            for (int y = 0; y < img->h; y++)
+        int dest = 0;
+        for (int y = 0; y < img->h; y++)
+        {
+            for (int x = 0; x < img->w; x++)
             {
-                for (int x = 0; x < img->w; x++)
-                {
-                    unsigned char *p = ((unsigned char*)img->pixels
-                                       + y * img->pitch + x * bpp);
-                    unsigned int pixel;
-                    if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
-                        pixel = p[0] << 16 | p[1] << 8 | p[2];
-                    else
-                        pixel = p[0] | p[1] << 8 | p[2] << 16;
-                    SDL_GetRGBA(pixel, img->format, &pixels[dest],
-                                &pixels[dest+1], &pixels[dest+2],
-                                &pixels[dest+3]);
-                    dest += 4;
-                }
-                dest += 4 * (new_width - img->w);
+                unsigned char *p = ((unsigned char*)img->pixels
+                                   + y * img->pitch + x * bpp);
+                unsigned int pixel;
+                if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+                    pixel = p[0] << 16 | p[1] << 8 | p[2];
+                else
+                    pixel = p[0] | p[1] << 8 | p[2] << 16;
+                SDL_GetRGBA(pixel, img->format, &pixels[dest],
+                            &pixels[dest+1], &pixels[dest+2],
+                            &pixels[dest+3]);
+                dest += 4;
             }
-
-            SDL_UnlockSurface(img);
+            dest += 4 * (new_width - img->w);
         }
+
+        SDL_UnlockSurface(img);
     }
     else if (bpp == 1)
     {
@@ -1299,30 +1324,21 @@ bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
     }
     else
     {
-        printf("Warning: unsupported format, bpp = %d for '%s'\n",
-               bpp, acBuffer);
+        fprintf(stderr, "Warning: unsupported format, bpp = %d for '%s'\n",
+                bpp, tex_path.c_str());
+        SDL_FreeSurface(img);
         return false;
     }
 
-    bool success = false;
-    if (!proc || proc(pixels, new_width, new_height))
-    {
-        // TODO: could fail if texture is too large / if there are opengl errs
-        opengl::check_texture_size(filename, new_width, new_height);
-        success |= tex->load_texture(pixels, new_width, new_height, mip_opt);
-        opengl::flush_opengl_errors();
-    }
-
-    // If conversion has occurred, delete converted data.
-    if (pixels != img->pixels)
-        delete[] pixels;
-
+    width       = new_width;
+    height      = new_height;
     orig_width  = img->w;
     orig_height = img->h;
 
     SDL_FreeSurface(img);
 
-    return success;
+    *out = pixels;
+    return true;
 }
 
 SDL_Surface *SDLWrapper::load_image(const char *file) const
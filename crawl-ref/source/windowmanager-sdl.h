@@ -61,6 +61,11 @@ public:
                               unsigned int &orig_height,
                               tex_proc_func proc = nullptr,
                               bool force_power_of_two = true) override;
+    virtual bool decode_texture(const char *filename, unsigned char **pixels,
+                                unsigned int &width, unsigned int &height,
+                                unsigned int &orig_width,
+                                unsigned int &orig_height,
+                                bool force_power_of_two = true) override;
 
 protected:
     // Helper functions
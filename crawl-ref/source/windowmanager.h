@@ -183,6 +183,14 @@ public:
                               unsigned int &orig_height,
                               tex_proc_func proc = nullptr,
                               bool force_power_of_two = true) = 0;
+    // Decode an image file into a tightly-packed RGBA buffer without
+    // touching the GL context, so it is safe to call off the main thread.
+    // On success the caller owns *pixels and must delete[] it.
+    virtual bool decode_texture(const char *filename, unsigned char **pixels,
+                                unsigned int &width, unsigned int &height,
+                                unsigned int &orig_width,
+                                unsigned int &orig_height,
+                                bool force_power_of_two = true) = 0;
 };
 
 // Main interface for UI functions
@@ -8,6 +8,7 @@
 #include "wiz-fsim.h"
 
 #include <cerrno>
+#include <cmath>
 
 #include "beam.h"
 #include "bitary.h"
@@ -49,21 +50,21 @@
 typedef map<skill_type, int8_t> skill_map;
 
 static const char* _title_line =
-    "Source | AvHitDam | MaxDam |  Acc | AvDam | AvTime | AvSpd | AvEffDam"; // 69 columns
+    "Source | AvHitDam | MaxDam |  Acc | AvDam | AvTime | AvSpd | AvEffDam | +-95%"; // 77 columns
 static const char* _tsv_title_line =
-    "Damage source\tAvHitDam\tMaxDam\tAccuracy\tAvDam\tAvTime\tAvSpeed\tAvEffDam";
+    "Damage source\tAvHitDam\tMaxDam\tAccuracy\tAvDam\tAvTime\tAvSpeed\tAvEffDam\tEffDam95CI";
 
 string fight_damage_stats::summary(const string prefix, bool tsv)
 {
     if (hits == 0 && !tsv)
         return make_stringf("%s%6s | No hits", prefix.c_str(), attacker.c_str());
-    return make_stringf(tsv ? "%s%s\t%.1f\t%d\t%d%%\t%.1f\t%d\t%.2f\t%.1f"
+    return make_stringf(tsv ? "%s%s\t%.1f\t%d\t%d%%\t%.1f\t%d\t%.2f\t%.1f\t%.1f"
                             : "%s%6s |    %5.1f |    %3d | %3d%% |"
-                              " %5.1f |   %3d  | %5.2f |    %5.1f",
+                              " %5.1f |   %3d  | %5.2f |    %5.1f | %5.1f",
                         prefix.c_str(), attacker.c_str(),
                         av_hit_dam, max_dam, accuracy,
                         av_dam, av_time, av_speed,
-                        av_eff_dam);
+                        av_eff_dam, ci_eff_dam);
 }
 
 string fight_data::header(bool tsv)
@@ -492,6 +493,7 @@ static fight_data _get_fight_data(monster &mon, int iter_limit, bool defend)
 void fight_damage_stats::damage(int amount)
 {
     cumulative_damage += amount;
+    cumulative_damage_sq += double(amount) * amount;
     if (amount > max_dam)
         max_dam = amount;
 }
@@ -504,6 +506,19 @@ void fight_damage_stats::calc_output_stats()
     av_time = double(time_taken) / iterations + 0.5; // round to nearest
     av_speed = double(iterations) * 100 / time_taken;
     av_eff_dam = av_dam * 100 / av_time;
+
+    // Half-width of a 95% confidence interval on av_eff_dam, from the
+    // per-round damage variance. Lets a run be judged against its own
+    // noise instead of being rerun with a bigger fsim_rounds.
+    if (iterations > 1 && av_time > 0)
+    {
+        const double var = (cumulative_damage_sq - av_dam * cumulative_damage)
+                           / (iterations - 1);
+        const double std_err = sqrt(max(var, 0.0) / iterations);
+        ci_eff_dam = 1.96 * std_err * 100 / av_time;
+    }
+    else
+        ci_eff_dam = 0.0;
 }
 
 fight_data wizard_quick_fsim_raw(bool defend)
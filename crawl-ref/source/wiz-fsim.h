@@ -11,10 +11,11 @@ using std::string;
 
 struct fight_damage_stats
 {
-    fight_damage_stats(string att) : cumulative_damage(0), time_taken(0), hits(0),
+    fight_damage_stats(string att) : cumulative_damage(0),
+            cumulative_damage_sq(0.0), time_taken(0), hits(0),
             iterations(1), attacker(att),
             av_hit_dam(0.0), max_dam(0), accuracy(0), av_dam(0.0), av_time(0),
-            av_speed(0.0), av_eff_dam(0.0)
+            av_speed(0.0), av_eff_dam(0.0), ci_eff_dam(0.0)
     {};
 
     void calc_output_stats();
@@ -24,6 +25,7 @@ struct fight_damage_stats
 
     // used while running an fsim
     unsigned int cumulative_damage;
+    double cumulative_damage_sq;
     int time_taken;
     int hits;
     int iterations;
@@ -38,6 +40,7 @@ struct fight_damage_stats
     int av_time;
     double av_speed;
     double av_eff_dam;
+    double ci_eff_dam;
 };
 
 struct fight_data
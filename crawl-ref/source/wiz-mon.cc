@@ -41,6 +41,7 @@
 #include "shout.h"
 #include "spl-miscast.h"
 #include "state.h"
+#include "status.h"
 #include "stringutil.h"
 #include "terrain.h"
 #include "view.h"
@@ -860,7 +861,7 @@ static void _miscast_screen_update()
 {
     viewwindow();
 
-    you.redraw_status_lights = true;
+    invalidate_status_cache();
     print_stats();
     update_screen();
 
@@ -43,6 +43,7 @@
 #include "wiz-mon.h"
 #include "wiz-you.h"
 #include "xom.h" // debug_xom_effects
+#include "zone-profile.h"
 
 static void _do_wizard_command(int wiz_command)
 {
@@ -98,7 +99,9 @@ static void _do_wizard_command(int wiz_command)
 
     case 'h': wizard_heal(false); break;
     case 'H': wizard_heal(true); break;
-    // case CONTROL('H'): break;
+#ifdef ZONE_PROFILING
+    case CONTROL('H'): wizard_dump_perf_zones(); break;
+#endif
 
     case 'i': wizard_identify_pack(); break;
     case 'I': wizard_unidentify_pack(); break;
@@ -496,6 +499,9 @@ int list_wizard_commands(bool do_redraw_screen)
                        "<w>p</w>      polymorph into a form\n"
                        "<w>V</w>      toggle xray vision\n"
                        "<w>E</w>      (un)freeze time\n"
+#ifdef ZONE_PROFILING
+                       "<w>Ctrl-H</w> dump zone profile\n"
+#endif
                        "\n"
                        "<yellow>Monster related commands</yellow>\n"
                        "<w>m</w>/<w>M</w>    create specified monster\n"
@@ -459,6 +459,17 @@ void xom_tick()
 
     if (x_chance_in_y(2 + you.faith(), 6))
     {
+        // When Xom's interest is above the boredom band, the only thing
+        // that can come of the rolls below is the action roll, and that
+        // succeeds with probability chance^2/100 <= 25/100 whatever the
+        // tension turns out to be. Roll the 25/100 envelope first (the
+        // action roll becomes chance^2/25 under it) so the tension scan
+        // of every monster in sight is skipped on the three quarters of
+        // ticks where nothing can happen anyway.
+        const bool maybe_interested = you.gift_timeout <= 1;
+        if (!maybe_interested && !x_chance_in_y(25, 100))
+            return;
+
         const int tension = get_tension(GOD_XOM);
         const int chance = (tension ==  0 ? 1 :
                             tension <=  5 ? 2 :
@@ -472,7 +483,7 @@ void xom_tick()
             xom_acts(abs(you.raw_piety - HALF_MAX_PIETY), maybe_bool::maybe, tension);
             return;
         }
-        else if (you.gift_timeout <= 1 && chance > 0
+        else if (maybe_interested && chance > 0
                  && x_chance_in_y(chance - 1, 80))
         {
             // During tension, Xom may briefly forget about being bored.
@@ -495,7 +506,7 @@ void xom_tick()
             }
         }
 
-        if (x_chance_in_y(chance*chance, 100))
+        if (x_chance_in_y(chance*chance, maybe_interested ? 100 : 25))
             xom_acts(abs(you.raw_piety - HALF_MAX_PIETY), maybe_bool::maybe, tension);
     }
 }
@@ -35,7 +35,7 @@ static zap_info _mon_hex_zap(zap_type ztype, beam_type beam,
         nullptr,
         nullptr,
         nullptr,
-        new tohit_calculator<0, 1, 1>,
+        tohit_calculator<0, 1, 1>,
         colour,
         true,
         beam,
@@ -53,8 +53,8 @@ static const zap_info zap_data[] =
     "noxious fumes",
     nullptr,
     nullptr,
-    new dicedef_calculator<0, 1, 0, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<0, 1, 0, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
     LIGHTGREEN,
     false,
     BEAM_MMISSILE,
@@ -68,8 +68,8 @@ static const zap_info zap_data[] =
     "blast of poison",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 3, 1, 25>,
-    new tohit_calculator<18, 1, 25>,
+    dicedef_calculator<3, 3, 1, 25>,
+    tohit_calculator<18, 1, 25>,
     LIGHTGREEN,
     false,
     BEAM_POISON,
@@ -83,8 +83,8 @@ static const zap_info zap_data[] =
     "bolt of devastation",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 24, 0, 1>,
-    new tohit_calculator<15, 1, 30>,
+    dicedef_calculator<3, 24, 0, 1>,
+    tohit_calculator<15, 1, 30>,
     MAGENTA,
     false,
     BEAM_DEVASTATION,
@@ -98,8 +98,8 @@ static const zap_info zap_data[] =
     "doom bolt",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 3, 1, 9>,
-    new tohit_calculator<15, 1, 30>,
+    dicedef_calculator<3, 3, 1, 9>,
+    tohit_calculator<15, 1, 30>,
     LIGHTRED,
     false,
     BEAM_MMISSILE,
@@ -114,8 +114,8 @@ static const zap_info zap_data[] =
     "bolt of flesh",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 3, 1, 10>,
-    new tohit_calculator<17, 1, 25>,
+    dicedef_calculator<3, 3, 1, 10>,
+    tohit_calculator<17, 1, 25>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -130,8 +130,8 @@ static const zap_info zap_data[] =
     "surge of chaos",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 5, 1, 16>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 5, 1, 16>,
+    tohit_calculator<AUTOMATIC_HIT>,
     ETC_RANDOM,
     false,
     BEAM_CHAOS,
@@ -146,8 +146,8 @@ static const zap_info zap_data[] =
     "spray of metal splinters",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 20, 1, 20>,
-    new tohit_calculator<19, 1, 30>,
+    dicedef_calculator<3, 20, 1, 20>,
+    tohit_calculator<19, 1, 30>,
     CYAN,
     false,
     BEAM_FRAG,
@@ -162,8 +162,8 @@ static const zap_info zap_data[] =
     "crystallising shot",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 6, 1, 10>,
-    new tohit_calculator<18, 1, 30>,
+    dicedef_calculator<3, 6, 1, 10>,
+    tohit_calculator<18, 1, 30>,
     LIGHTCYAN,
     false,
     BEAM_CRYSTALLISING,
@@ -178,8 +178,8 @@ static const zap_info zap_data[] =
     "spray of wooden splinters",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 15, 1, 20>,
-    new tohit_calculator<17, 1, 30>,
+    dicedef_calculator<3, 15, 1, 20>,
+    tohit_calculator<17, 1, 30>,
     BROWN,
     false,
     BEAM_FRAG,
@@ -194,8 +194,8 @@ static const zap_info zap_data[] =
     "volley of thorns",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 5, 1, 13>,
-    new tohit_calculator<20, 1, 15>,
+    dicedef_calculator<3, 5, 1, 13>,
+    tohit_calculator<20, 1, 15>,
     BROWN,
     false,
     BEAM_MMISSILE,
@@ -210,8 +210,8 @@ static const zap_info zap_data[] =
     "volley of spikes",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 13, 0, 1>,
-    new tohit_calculator<27>,
+    dicedef_calculator<2, 13, 0, 1>,
+    tohit_calculator<27>,
     LIGHTGREY,
     false,
     BEAM_MMISSILE,
@@ -225,8 +225,8 @@ static const zap_info zap_data[] =
     "toxic sludge",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 3, 1, 16>,
-    new tohit_calculator<20, 1, 15>,
+    dicedef_calculator<3, 3, 1, 16>,
+    tohit_calculator<20, 1, 15>,
     LIGHTGREEN,
     false,
     BEAM_POISON_ARROW,
@@ -240,8 +240,8 @@ static const zap_info zap_data[] =
     "damnation",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 15, 0, 10>,
-    new tohit_calculator<20>,
+    dicedef_calculator<3, 15, 0, 10>,
+    tohit_calculator<20>,
     LIGHTRED,
     false,
     BEAM_DAMNATION,
@@ -256,8 +256,8 @@ static const zap_info zap_data[] =
     "foul vapour",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 5, 1, 24>,
-    new tohit_calculator<17, 1, 20>,
+    dicedef_calculator<3, 5, 1, 24>,
+    tohit_calculator<17, 1, 20>,
     DARKGREY,
     false,
     BEAM_MIASMA,
@@ -271,8 +271,8 @@ static const zap_info zap_data[] =
     "blast of cleansing flame",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 0, 1, 12>,
-    new tohit_calculator<18, 1, 25>,
+    dicedef_calculator<3, 0, 1, 12>,
+    tohit_calculator<18, 1, 25>,
     ETC_HOLY,
     false,
     BEAM_HOLY,
@@ -286,8 +286,8 @@ static const zap_info zap_data[] =
     "blast of calcifying dust",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 6, 0, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 6, 0, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_PETRIFYING_CLOUD,
@@ -301,8 +301,8 @@ static const zap_info zap_data[] =
     "ghostly fireball",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 6, 1, 13>,
-    new tohit_calculator<40>,
+    dicedef_calculator<3, 6, 1, 13>,
+    tohit_calculator<40>,
     CYAN,
     false,
     BEAM_NEG,
@@ -317,8 +317,8 @@ static const zap_info zap_data[] =
     "icy flash freeze",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 10, 1, 17>,
-    new tohit_calculator<16, 1, 13>,
+    dicedef_calculator<3, 10, 1, 17>,
+    tohit_calculator<16, 1, 13>,
     WHITE,
     false,
     BEAM_ICE,
@@ -332,8 +332,8 @@ static const zap_info zap_data[] =
     "flash freeze",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 7, 1, 12>,
-    new tohit_calculator<5, 1, 3>,
+    dicedef_calculator<3, 7, 1, 12>,
+    tohit_calculator<5, 1, 3>,
     WHITE,
     false,
     BEAM_COLD,
@@ -345,10 +345,10 @@ static const zap_info zap_data[] =
 {
     ZAP_PERMAFROST_ERUPTION_COLD,
     "piercing cold",
-    new calcdice_calculator<4, 6, 3, 8>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<3, 7, 1, 20>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<4, 6, 3, 8>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 7, 1, 20>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_COLD,
@@ -360,10 +360,10 @@ static const zap_info zap_data[] =
 {
     ZAP_PERMAFROST_ERUPTION_EARTH,
     "mass of rock",
-    new calcdice_calculator<4, 6, 3, 8>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<3, 7, 1, 20>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<4, 6, 3, 8>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 7, 1, 20>,
+    tohit_calculator<AUTOMATIC_HIT>,
     LIGHTGREY,
     false,
     BEAM_MMISSILE,
@@ -377,8 +377,8 @@ static const zap_info zap_data[] =
     "glob of lava",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 10, 0, 1>,
-    new tohit_calculator<20>,
+    dicedef_calculator<3, 10, 0, 1>,
+    tohit_calculator<20>,
     RED,
     false,
     BEAM_LAVA,
@@ -393,8 +393,8 @@ static const zap_info zap_data[] =
     "seething chaos",
     nullptr,
     nullptr,
-    new dicedef_calculator<0, 1, 0, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<0, 1, 0, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
     ETC_RANDOM,
     false,
     BEAM_MISSILE,
@@ -408,8 +408,8 @@ static const zap_info zap_data[] =
     "blast of cold",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 0, 1, 6>,
-    new tohit_calculator<30>,
+    dicedef_calculator<3, 0, 1, 6>,
+    tohit_calculator<30>,
     WHITE,
     false,
     BEAM_COLD,
@@ -423,8 +423,8 @@ static const zap_info zap_data[] =
     "blast of flame",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 0, 1, 6>,
-    new tohit_calculator<30>,
+    dicedef_calculator<3, 0, 1, 6>,
+    tohit_calculator<30>,
     RED,
     false,
     BEAM_FIRE,
@@ -438,8 +438,8 @@ static const zap_info zap_data[] =
     "searing blast",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 0, 1, 9>,
-    new tohit_calculator<30>,
+    dicedef_calculator<3, 0, 1, 9>,
+    tohit_calculator<30>,
     RED,
     false,
     BEAM_FIRE,
@@ -453,8 +453,8 @@ static const zap_info zap_data[] =
     "bolt of electricity",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 3, 1, 12>,
-    new tohit_calculator<35>,
+    dicedef_calculator<3, 3, 1, 12>,
+    tohit_calculator<35>,
     LIGHTCYAN,
     false,
     BEAM_ELECTRICITY,
@@ -468,8 +468,8 @@ static const zap_info zap_data[] =
     "blazing flames",
     nullptr,
     nullptr,
-    new dicedef_calculator<0, 1, 0, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<0, 1, 0, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
     RED,
     false,
     BEAM_MMISSILE,
@@ -481,10 +481,10 @@ static const zap_info zap_data[] =
 {
     ZAP_THROW_FLAME,
     "puff of flame",
-    new dicedef_calculator<2, 4, 1, 10>,
-    new tohit_calculator<8, 1, 10>,
-    new dicedef_calculator<3, 5, 1, 40>,
-    new tohit_calculator<25, 1, 40>,
+    dicedef_calculator<2, 4, 1, 10>,
+    tohit_calculator<8, 1, 10>,
+    dicedef_calculator<3, 5, 1, 40>,
+    tohit_calculator<25, 1, 40>,
     RED,
     false,
     BEAM_FIRE,
@@ -497,10 +497,10 @@ static const zap_info zap_data[] =
 {
     ZAP_THROW_FROST,
     "puff of frost",
-    new dicedef_calculator<2, 4, 1, 10>,
-    new tohit_calculator<8, 1, 10>,
-    new dicedef_calculator<3, 5, 1, 40>,
-    new tohit_calculator<25, 1, 40>,
+    dicedef_calculator<2, 4, 1, 10>,
+    tohit_calculator<8, 1, 10>,
+    dicedef_calculator<3, 5, 1, 40>,
+    tohit_calculator<25, 1, 40>,
     WHITE,
     false,
     BEAM_COLD,
@@ -513,10 +513,10 @@ static const zap_info zap_data[] =
 {
     ZAP_BREATHE_ACID,
     "glob of acid",
-    new dicedef_calculator<5, 4, 1, 3>,
-    new tohit_calculator<7, 1, 6>,
-    new dicedef_calculator<3, 14, 0, 1>,
-    new tohit_calculator<20, 1, 4>,
+    dicedef_calculator<5, 4, 1, 3>,
+    tohit_calculator<7, 1, 6>,
+    dicedef_calculator<3, 14, 0, 1>,
+    tohit_calculator<20, 1, 4>,
     YELLOW,
     false,
     BEAM_ACID,
@@ -531,7 +531,7 @@ _mon_hex_zap(ZAP_SLOW, BEAM_SLOW),
     ZAP_MEPHITIC,
     "stinking cloud",
     nullptr,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     GREEN,
@@ -562,10 +562,10 @@ _mon_hex_zap(ZAP_SLOW, BEAM_SLOW),
 {
     ZAP_MAGIC_DART,
     "magic dart",
-    new dicedef_calculator<1, 3, 1, 5>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<3, 4, 1, 100>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<1, 3, 1, 5>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 4, 1, 100>,
+    tohit_calculator<AUTOMATIC_HIT>,
     LIGHTMAGENTA,
     false,
     BEAM_MMISSILE,
@@ -581,10 +581,10 @@ _mon_hex_zap(ZAP_VEX, BEAM_VEX),
 {
     ZAP_BOLT_OF_FIRE,
     "bolt of fire",
-    new calcdice_calculator<6, 18, 2, 3>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 8, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<6, 18, 2, 3>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 8, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     RED,
     false,
     BEAM_FIRE,
@@ -596,10 +596,10 @@ _mon_hex_zap(ZAP_VEX, BEAM_VEX),
 {
     ZAP_BOLT_OF_COLD,
     "bolt of cold",
-    new calcdice_calculator<6, 18, 2, 3>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 8, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<6, 18, 2, 3>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 8, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     WHITE,
     false,
     BEAM_COLD,
@@ -611,13 +611,13 @@ _mon_hex_zap(ZAP_VEX, BEAM_VEX),
 { // Used only by phial of floods
     ZAP_PRIMAL_WAVE,
     "torrent of water",
-    new calcdice_calculator<4, 10, 1, 5>,
-    new tohit_calculator<10, 1, 25>,
+    calcdice_calculator<4, 10, 1, 5>,
+    tohit_calculator<10, 1, 25>,
     // Water attack is weaker than the pure elemental damage attacks, but also
     // less resistible.
-    new dicedef_calculator<3, 6, 1, 10>,
+    dicedef_calculator<3, 6, 1, 10>,
     // Huge wave of water is hard to dodge.
-    new tohit_calculator<14, 1, 35>,
+    tohit_calculator<14, 1, 35>,
     LIGHTBLUE,
     false,
     BEAM_WATER,
@@ -692,10 +692,10 @@ _mon_hex_zap(ZAP_TUKIMAS_DANCE, BEAM_TUKIMAS_DANCE),
 {
     ZAP_FIREBALL,
     "fireball",
-    new calcdice_calculator<3, 10, 1, 2>,
-    new tohit_calculator<40>,
-    new dicedef_calculator<3, 7, 1, 10>,
-    new tohit_calculator<40>,
+    calcdice_calculator<3, 10, 1, 2>,
+    tohit_calculator<40>,
+    dicedef_calculator<3, 7, 1, 10>,
+    tohit_calculator<40>,
     RED,
     false,
     BEAM_FIRE,
@@ -709,8 +709,8 @@ _mon_hex_zap(ZAP_TUKIMAS_DANCE, BEAM_TUKIMAS_DANCE),
 {
     ZAP_BLASTMOTE,
     "concussive blast",
-    new calcdice_calculator<2, 20, 1, 3>,
-    new tohit_calculator<40>,
+    calcdice_calculator<2, 20, 1, 3>,
+    tohit_calculator<40>,
     nullptr,
     nullptr,
     RED,
@@ -725,8 +725,8 @@ _mon_hex_zap(ZAP_TUKIMAS_DANCE, BEAM_TUKIMAS_DANCE),
 {
     ZAP_FLAME_WAVE,
     "flame wave",
-    new calcdice_calculator<2, 9, 1, 3>,
-    new tohit_calculator<40>,
+    calcdice_calculator<2, 9, 1, 3>,
+    tohit_calculator<40>,
     nullptr,
     nullptr,
     RED,
@@ -740,8 +740,8 @@ _mon_hex_zap(ZAP_TUKIMAS_DANCE, BEAM_TUKIMAS_DANCE),
 {
     ZAP_IGNITION,
     "fireball",
-    new calcdice_calculator<3, 10, 1, 3>, // less than fireball
-    new tohit_calculator<40>,
+    calcdice_calculator<3, 10, 1, 3>, // less than fireball
+    tohit_calculator<40>,
     nullptr,
     nullptr,
     RED,
@@ -756,9 +756,9 @@ _mon_hex_zap(ZAP_TUKIMAS_DANCE, BEAM_TUKIMAS_DANCE),
     ZAP_TELEPORT_OTHER,
     "",
     nullptr,
-    new tohit_calculator<0, 3, 2>,
+    tohit_calculator<0, 3, 2>,
     nullptr,
-    new tohit_calculator<0, 1, 1>,
+    tohit_calculator<0, 1, 1>,
     BLACK,
     true,
     BEAM_TELEPORT,
@@ -770,10 +770,10 @@ _mon_hex_zap(ZAP_TUKIMAS_DANCE, BEAM_TUKIMAS_DANCE),
 {
     ZAP_LIGHTNING_BOLT,
     "bolt of lightning",
-    new calcdice_calculator<1, 11, 3, 5>,
-    new tohit_calculator<7, 1, 40>,
-    new dicedef_calculator<3, 10, 1, 17>,
-    new tohit_calculator<16, 1, 40>,
+    calcdice_calculator<1, 11, 3, 5>,
+    tohit_calculator<7, 1, 40>,
+    dicedef_calculator<3, 10, 1, 17>,
+    tohit_calculator<16, 1, 40>,
     LIGHTCYAN,
     false,
     BEAM_ELECTRICITY,
@@ -787,10 +787,10 @@ _mon_hex_zap(ZAP_POLYMORPH, BEAM_POLYMORPH),
 {
     ZAP_VENOM_BOLT,
     "bolt of poison",
-    new calcdice_calculator<4, 16, 3, 5>,
-    new tohit_calculator<8, 1, 20>,
-    new dicedef_calculator<3, 6, 1, 13>,
-    new tohit_calculator<19, 1, 20>,
+    calcdice_calculator<4, 16, 3, 5>,
+    tohit_calculator<8, 1, 20>,
+    dicedef_calculator<3, 6, 1, 13>,
+    tohit_calculator<19, 1, 20>,
     LIGHTGREEN,
     false,
     BEAM_POISON,
@@ -802,10 +802,10 @@ _mon_hex_zap(ZAP_POLYMORPH, BEAM_POLYMORPH),
 {
     ZAP_BOLT_OF_DRAINING,
     "bolt of negative energy",
-    new calcdice_calculator<4, 15, 3, 5>,
-    new tohit_calculator<8, 1, 20>,
-    new dicedef_calculator<3, 9, 1, 13>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<4, 15, 3, 5>,
+    tohit_calculator<8, 1, 20>,
+    dicedef_calculator<3, 9, 1, 13>,
+    tohit_calculator<17, 1, 25>,
     DARKGREY,
     false,
     BEAM_NEG,
@@ -818,10 +818,10 @@ _mon_hex_zap(ZAP_POLYMORPH, BEAM_POLYMORPH),
 {
     ZAP_KISS_OF_DEATH,
     "fragment of death",
-    new calcdice_calculator<2, 11, 3, 5>, // caps at 2d13... spooky
-    new tohit_calculator<AUTOMATIC_HIT>, // XXX: should we let this miss?
-    new calcdice_calculator<2, 13, 2, 7>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<2, 11, 3, 5>, // caps at 2d13... spooky
+    tohit_calculator<AUTOMATIC_HIT>, // XXX: should we let this miss?
+    calcdice_calculator<2, 13, 2, 7>,
+    tohit_calculator<AUTOMATIC_HIT>,
     DARKGREY,
     false,
     BEAM_NEG,
@@ -833,10 +833,10 @@ _mon_hex_zap(ZAP_POLYMORPH, BEAM_POLYMORPH),
 {
     ZAP_LEHUDIBS_CRYSTAL_SPEAR,      // was splinters
     "crystal spear",
-    new calcdice_calculator<10, 23, 1, 1>,
-    new tohit_calculator<10, 1, 15>,
-    new dicedef_calculator<3, 16, 1, 10>,
-    new tohit_calculator<22, 1, 20>,
+    calcdice_calculator<10, 23, 1, 1>,
+    tohit_calculator<10, 1, 15>,
+    dicedef_calculator<3, 16, 1, 10>,
+    tohit_calculator<22, 1, 20>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -853,8 +853,8 @@ _mon_hex_zap(ZAP_CHARMING, BEAM_CHARM),
     "",
     nullptr,
     nullptr,
-    new dicedef_calculator<1, 7, 1, 20>,
-    new tohit_calculator<0, 1, 1>,
+    dicedef_calculator<1, 7, 1, 20>,
+    tohit_calculator<0, 1, 1>,
     BLACK,
     true,
     BEAM_PAIN,
@@ -866,10 +866,10 @@ _mon_hex_zap(ZAP_CHARMING, BEAM_CHARM),
 {
     ZAP_STICKY_FLAME,
     "sticky flame",
-    new dicedef_calculator<2, 4, 1, 9>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<2, 2, 1, 14>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 4, 1, 9>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 2, 1, 14>,
+    tohit_calculator<AUTOMATIC_HIT>,
     RED,
     false,
     BEAM_FIRE,
@@ -884,8 +884,8 @@ _mon_hex_zap(ZAP_CHARMING, BEAM_CHARM),
     nullptr,
     nullptr,
     // 0 dice so 'does no damage' is suppresssed
-    new dicedef_calculator<0, 0, 0, 1>,
-    new tohit_calculator<18, 1, 12>,
+    dicedef_calculator<0, 0, 0, 1>,
+    tohit_calculator<18, 1, 12>,
     RED,
     false,
     BEAM_STICKY_FLAME,
@@ -897,10 +897,10 @@ _mon_hex_zap(ZAP_CHARMING, BEAM_CHARM),
 {
     ZAP_DISPEL_UNDEAD,
     "",
-    new calcdice_calculator<3, 20, 3, 4>,
-    new tohit_calculator<0, 3, 2>,
-    new dicedef_calculator<3, 3, 1, 10>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<3, 20, 3, 4>,
+    tohit_calculator<0, 3, 2>,
+    dicedef_calculator<3, 3, 1, 10>,
+    tohit_calculator<AUTOMATIC_HIT>,
     BLACK,
     true,
     BEAM_DISPEL_UNDEAD,
@@ -912,10 +912,10 @@ _mon_hex_zap(ZAP_CHARMING, BEAM_CHARM),
 {
     ZAP_DISPEL_UNDEAD_RANGE,
     "",
-    new calcdice_calculator<3, 20, 3, 4>,
-    new tohit_calculator<0, 3, 2>,
-    new dicedef_calculator<3, 6, 1, 10>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<3, 20, 3, 4>,
+    tohit_calculator<0, 3, 2>,
+    dicedef_calculator<3, 6, 1, 10>,
+    tohit_calculator<AUTOMATIC_HIT>,
     BLACK,
     true,
     BEAM_DISPEL_UNDEAD,
@@ -929,10 +929,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_STING,
     "sting",
-    new dicedef_calculator<1, 3, 1, 4>,
-    new tohit_calculator<8, 1, 5>,
-    new dicedef_calculator<2, 4, 1, 10>,
-    new tohit_calculator<12, 1, 5>,
+    dicedef_calculator<1, 3, 1, 4>,
+    tohit_calculator<8, 1, 5>,
+    dicedef_calculator<2, 4, 1, 10>,
+    tohit_calculator<12, 1, 5>,
     GREEN,
     false,
     BEAM_POISON_ARROW,
@@ -945,10 +945,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_HURL_DAMNATION,
     "damnation",
-    new calcdice_calculator<3, 8, 3, 5>,
-    new tohit_calculator<20, 1, 10>,
-    new dicedef_calculator<3, 20, 0, 10>,
-    new tohit_calculator<24>,
+    calcdice_calculator<3, 8, 3, 5>,
+    tohit_calculator<20, 1, 10>,
+    dicedef_calculator<3, 20, 0, 10>,
+    tohit_calculator<24>,
     LIGHTRED,
     false,
     BEAM_DAMNATION,
@@ -961,10 +961,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_IRON_SHOT,
     "iron shot",
-    new calcdice_calculator<9, 15, 3, 4>,
-    new tohit_calculator<7, 1, 15>,
-    new dicedef_calculator<3, 8, 1, 9>,
-    new tohit_calculator<20, 1, 25>,
+    calcdice_calculator<9, 15, 3, 4>,
+    tohit_calculator<7, 1, 15>,
+    dicedef_calculator<3, 8, 1, 9>,
+    tohit_calculator<20, 1, 25>,
     LIGHTCYAN,
     false,
     BEAM_MMISSILE,
@@ -977,10 +977,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_BOMBARD,
     "iron shot",
-    new calcdice_calculator<9, 13, 2, 3>,
-    new tohit_calculator<7, 1, 15>,
-    new dicedef_calculator<3, 8, 1, 9>,
-    new tohit_calculator<20, 1, 25>,
+    calcdice_calculator<9, 13, 2, 3>,
+    tohit_calculator<7, 1, 15>,
+    dicedef_calculator<3, 8, 1, 9>,
+    tohit_calculator<20, 1, 25>,
     LIGHTCYAN,
     false,
     BEAM_MMISSILE,
@@ -993,10 +993,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_STONE_ARROW,
     "stone arrow",
-    new dicedef_calculator<3, 7, 1, 8>,
-    new tohit_calculator<8, 1, 10>,
-    new dicedef_calculator<3, 5, 1, 10>,
-    new tohit_calculator<14, 1, 35>,
+    dicedef_calculator<3, 7, 1, 8>,
+    tohit_calculator<8, 1, 10>,
+    dicedef_calculator<3, 5, 1, 10>,
+    tohit_calculator<14, 1, 35>,
     LIGHTGREY,
     false,
     BEAM_MMISSILE,
@@ -1009,10 +1009,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_SHOCK,
     "zap",
-    new dicedef_calculator<1, 3, 1, 4>,
-    new tohit_calculator<8, 1, 7>,
-    new dicedef_calculator<1, 8, 1, 6>,
-    new tohit_calculator<17, 1, 20>,
+    dicedef_calculator<1, 3, 1, 4>,
+    tohit_calculator<8, 1, 7>,
+    dicedef_calculator<1, 8, 1, 6>,
+    tohit_calculator<17, 1, 20>,
     LIGHTCYAN,
     false,
     BEAM_ELECTRICITY,             // beams & reflects
@@ -1027,8 +1027,8 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
     "stunning burst",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 8, 1, 20>,
-    new tohit_calculator<15, 1, 10>,
+    dicedef_calculator<2, 8, 1, 20>,
+    tohit_calculator<15, 1, 10>,
     LIGHTCYAN,
     false,
     BEAM_STUN_BOLT,
@@ -1040,10 +1040,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_ORB_OF_ELECTRICITY,
     "orb of electricity",
-    new calcdice_calculator<0, 13, 4, 5>,
-    new tohit_calculator<40>,
-    new dicedef_calculator<3, 7, 1, 9>,
-    new tohit_calculator<40>,
+    calcdice_calculator<0, 13, 4, 5>,
+    tohit_calculator<40>,
+    dicedef_calculator<3, 7, 1, 9>,
+    tohit_calculator<40>,
     LIGHTBLUE,
     false,
     BEAM_ELECTRICITY,
@@ -1055,10 +1055,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_SPIT_POISON,
     "splash of poison",
-    new dicedef_calculator<1, 4, 1, 2>,
-    new tohit_calculator<5, 1, 6>,
-    new dicedef_calculator<2, 4, 1, 10>,
-    new tohit_calculator<16, 1, 20>,
+    dicedef_calculator<1, 4, 1, 2>,
+    tohit_calculator<5, 1, 6>,
+    dicedef_calculator<2, 4, 1, 10>,
+    tohit_calculator<16, 1, 20>,
     GREEN,
     false,
     BEAM_POISON,
@@ -1070,8 +1070,8 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_DEBUGGING_RAY,
     "debugging ray",
-    new dicedef_calculator<AUTOMATIC_HIT, 1, 0, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<AUTOMATIC_HIT, 1, 0, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     WHITE,
@@ -1085,8 +1085,8 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_BREATHE_FIRE,
     "fiery breath",
-    new dicedef_calculator<3, 4, 1, 3>,
-    new tohit_calculator<8, 1, 6>,
+    dicedef_calculator<3, 4, 1, 3>,
+    tohit_calculator<8, 1, 6>,
     nullptr,
     nullptr,
     RED,
@@ -1100,8 +1100,8 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_GLACIAL_BREATH,
     "glacial breath",
-    new dicedef_calculator<3, 6, 4, 3>,
-    new tohit_calculator<12, 1, 1>,
+    dicedef_calculator<3, 6, 4, 3>,
+    tohit_calculator<12, 1, 1>,
     nullptr,
     nullptr,
     WHITE,
@@ -1115,8 +1115,8 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_COMBUSTION_BREATH,
     "explosive embers",
-    new dicedef_calculator<0, 0, 0, 1>, // deals damage through explosions
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<0, 0, 0, 1>, // deals damage through explosions
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     RED,
@@ -1130,8 +1130,8 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_BREATHE_POISON,
     "poison gas",
-    new dicedef_calculator<3, 2, 1, 6>,
-    new tohit_calculator<6, 1, 6>,
+    dicedef_calculator<3, 2, 1, 6>,
+    tohit_calculator<6, 1, 6>,
     nullptr,
     nullptr,
     GREEN,
@@ -1147,8 +1147,8 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
     "splash of acid",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 14, 0, 1>,
-    new tohit_calculator<20, 1, 4>,
+    dicedef_calculator<3, 14, 0, 1>,
+    tohit_calculator<20, 1, 4>,
     YELLOW,
     false,
     BEAM_ACID,
@@ -1161,9 +1161,9 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
     ZAP_AGONY,
     "agony",
     nullptr,
-    new tohit_calculator<0, 5, 1>,
+    tohit_calculator<0, 5, 1>,
     nullptr,
-    new tohit_calculator<0, 1, 1>,
+    tohit_calculator<0, 1, 1>,
     BLACK,
     true,
     BEAM_AGONY,
@@ -1176,9 +1176,9 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
     ZAP_CURSE_OF_AGONY,
     "curse of agony",
     nullptr,
-    new tohit_calculator<0, 5, 2>,
+    tohit_calculator<0, 5, 2>,
     nullptr,
-    new tohit_calculator<0, 1, 1>,
+    tohit_calculator<0, 1, 1>,
     BLACK,
     true,
     BEAM_CURSE_OF_AGONY,
@@ -1190,10 +1190,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_VAMPIRIC_DRAINING,
     "",
-    new dicedef_calculator<2, 6, 1, 14>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<2, 6, 1, 14>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 6, 1, 14>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 6, 1, 14>,
+    tohit_calculator<AUTOMATIC_HIT>,
     BLACK,
     true,
     BEAM_VAMPIRIC_DRAINING,
@@ -1205,10 +1205,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_MINDBURST,
     "",
-    new calcdice_calculator<3, 15, 3, 4>,
-    new tohit_calculator<0, 5, 2>,
-    new calcdice_calculator<1, 12, 1, 4>,
-    new tohit_calculator<50, 0, 1>,
+    calcdice_calculator<3, 15, 3, 4>,
+    tohit_calculator<0, 5, 2>,
+    calcdice_calculator<1, 12, 1, 4>,
+    tohit_calculator<50, 0, 1>,
     BLACK,
     true,
     BEAM_MINDBURST,
@@ -1220,10 +1220,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_BREATHE_STEAM,
     "ball of steam",
-    new dicedef_calculator<3, 4, 2, 3>,
-    new tohit_calculator<10, 1, 10>,
-    new dicedef_calculator<3, 7, 1, 15>,
-    new tohit_calculator<20, 1, 20>,
+    dicedef_calculator<3, 4, 2, 3>,
+    tohit_calculator<10, 1, 10>,
+    dicedef_calculator<3, 7, 1, 15>,
+    tohit_calculator<20, 1, 20>,
     LIGHTGREY,
     false,
     BEAM_STEAM,
@@ -1235,10 +1235,10 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
 {
     ZAP_THROW_ICICLE,
     "shard of ice",
-    new calcdice_calculator<3, 10, 1, 2>,
-    new tohit_calculator<9, 1, 12>,
-    new dicedef_calculator<3, 8, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<3, 10, 1, 2>,
+    tohit_calculator<9, 1, 12>,
+    dicedef_calculator<3, 8, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     WHITE,
     false,
     BEAM_ICE,
@@ -1254,7 +1254,7 @@ _mon_hex_zap(ZAP_BANISHMENT, BEAM_BANISH),
     nullptr,
     nullptr,
     nullptr,
-    new tohit_calculator<0, 1, 1>,
+    tohit_calculator<0, 1, 1>,
     BLUE,
     true,
     BEAM_CORONA,
@@ -1268,10 +1268,10 @@ _mon_hex_zap(ZAP_HIBERNATION, BEAM_HIBERNATION),
 {
     ZAP_SANDBLAST,
     "blast of sand",
-    new dicedef_calculator<2, 4, 1, 3>,
-    new tohit_calculator<15, 1, 10>,
-    new dicedef_calculator<3, 7, 1, 18>,
-    new tohit_calculator<20, 1, 40>,
+    dicedef_calculator<2, 4, 1, 3>,
+    tohit_calculator<15, 1, 10>,
+    dicedef_calculator<3, 7, 1, 18>,
+    tohit_calculator<20, 1, 40>,
     BROWN,
     false,
     BEAM_FRAG,
@@ -1284,10 +1284,10 @@ _mon_hex_zap(ZAP_HIBERNATION, BEAM_HIBERNATION),
 {
     ZAP_BOLT_OF_MAGMA,
     "bolt of magma",
-    new calcdice_calculator<4, 16, 2, 3>,
-    new tohit_calculator<8, 1, 25>,
-    new dicedef_calculator<3, 8, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<4, 16, 2, 3>,
+    tohit_calculator<8, 1, 25>,
+    dicedef_calculator<3, 8, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     RED,
     false,
     BEAM_LAVA,
@@ -1300,8 +1300,8 @@ _mon_hex_zap(ZAP_HIBERNATION, BEAM_HIBERNATION),
 {
     ZAP_MOMENTUM_STRIKE,
     "concentrated momentum",
-    new calcdice_calculator<3, 24, 1, 6>,
-    new tohit_calculator<9, 1, 12>,
+    calcdice_calculator<3, 24, 1, 6>,
+    tohit_calculator<9, 1, 12>,
     nullptr,
     nullptr,
     CYAN,
@@ -1315,10 +1315,10 @@ _mon_hex_zap(ZAP_HIBERNATION, BEAM_HIBERNATION),
 {
     ZAP_POISON_ARROW,
     "poison arrow",
-    new calcdice_calculator<4, 15, 1, 1>,
-    new tohit_calculator<5, 1, 10>,
-    new dicedef_calculator<3, 7, 1, 12>,
-    new tohit_calculator<20, 1, 25>,
+    calcdice_calculator<4, 15, 1, 1>,
+    tohit_calculator<5, 1, 10>,
+    dicedef_calculator<3, 7, 1, 12>,
+    tohit_calculator<20, 1, 25>,
     LIGHTGREEN,
     false,
     BEAM_POISON_ARROW,             // extra damage
@@ -1336,7 +1336,7 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
     ZAP_IOOD,
     "",
     nullptr,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     WHITE,
@@ -1351,8 +1351,8 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_NOXIOUS_BREATH,
     "blast of choking fumes",
-    new dicedef_calculator<0, 1, 1, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<0, 1, 1, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     GREEN,
@@ -1367,7 +1367,7 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
     ZAP_INNER_FLAME,
     "",
     nullptr,
-    new tohit_calculator<0, 3, 1>,
+    tohit_calculator<0, 3, 1>,
     nullptr,
     nullptr,
     BLACK,
@@ -1381,10 +1381,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_FORCE_LANCE,
     "lance of force",
-    new dicedef_calculator<3, 6, 1, 6>,
-    new tohit_calculator<20, 1, 7>,
-    new dicedef_calculator<3, 6, 1, 15>,
-    new tohit_calculator<20, 1, 20>,
+    dicedef_calculator<3, 6, 1, 6>,
+    tohit_calculator<20, 1, 7>,
+    dicedef_calculator<3, 6, 1, 15>,
+    tohit_calculator<20, 1, 20>,
     CYAN,
     false,
     BEAM_MMISSILE,
@@ -1397,10 +1397,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_SEARING_RAY,
     "searing ray",
-    new calcdice_calculator<2, 9, 1, 7>,
-    new tohit_calculator<11, 1, 8>,
-    new calcdice_calculator<2, 7, 1, 4>,
-    new tohit_calculator<11, 1, 7>,
+    calcdice_calculator<2, 9, 1, 7>,
+    tohit_calculator<11, 1, 8>,
+    calcdice_calculator<2, 7, 1, 4>,
+    tohit_calculator<11, 1, 7>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -1413,10 +1413,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_REBOUNDING_BLAZE,
     "rebounding bolt of fire",
-    new calcdice_calculator<6, 18, 2, 3>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 11, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<6, 18, 2, 3>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 11, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     RED,
     false,
     BEAM_FIRE,
@@ -1428,10 +1428,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_REBOUNDING_CHILL,
     "rebounding bolt of cold",
-    new calcdice_calculator<6, 18, 2, 3>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 11, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<6, 18, 2, 3>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 11, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     WHITE,
     false,
     BEAM_COLD,
@@ -1444,10 +1444,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_QUICKSILVER_BOLT,
     "bolt of dispelling energy",
-    new calcdice_calculator<6, 15, 2, 3>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 7, 1, 14>,
-    new tohit_calculator<16, 1, 25>,
+    calcdice_calculator<6, 15, 2, 3>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 7, 1, 14>,
+    tohit_calculator<16, 1, 25>,
     ETC_RANDOM,
     false,
     BEAM_MMISSILE,
@@ -1459,10 +1459,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_CORROSIVE_BOLT,
     "bolt of acid",
-    new calcdice_calculator<4, 13, 3, 5>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 7, 1, 10>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<4, 13, 3, 5>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 7, 1, 10>,
+    tohit_calculator<17, 1, 25>,
     YELLOW,
     false,
     BEAM_ACID,
@@ -1474,10 +1474,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_BOLT_OF_LIGHT,
     "bolt of light",
-    new calcdice_calculator<4, 13, 3, 5>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 7, 1, 12>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<4, 13, 3, 5>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 7, 1, 12>,
+    tohit_calculator<17, 1, 25>,
     WHITE,
     false,
     BEAM_LIGHT,
@@ -1490,8 +1490,8 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_UNRAVELLING,
     "unravelling",
-    new dicedef_calculator<3, 3, 1, 6>,
-    new tohit_calculator<0, 1, 1>,
+    dicedef_calculator<3, 3, 1, 6>,
+    tohit_calculator<0, 1, 1>,
     nullptr,
     nullptr,
     ETC_MUTAGENIC,
@@ -1506,10 +1506,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_ICEBLAST,
     "iceblast",
-    new calcdice_calculator<3, 14, 3, 5>,
-    new tohit_calculator<40>,
-    new dicedef_calculator<3, 6, 1, 12>, // slightly weaker than magma/fireball
-    new tohit_calculator<40>,
+    calcdice_calculator<3, 14, 3, 5>,
+    tohit_calculator<40>,
+    dicedef_calculator<3, 6, 1, 12>, // slightly weaker than magma/fireball
+    tohit_calculator<40>,
     WHITE,
     false,
     BEAM_ICE,
@@ -1525,8 +1525,8 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
     "slug dart",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 3, 1, 25>,
-    new tohit_calculator<14, 1, 35>,
+    dicedef_calculator<2, 3, 1, 25>,
+    tohit_calculator<14, 1, 35>,
     CYAN, // match slug's own colour
     false,
     BEAM_MMISSILE,
@@ -1539,10 +1539,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_CHAIN_LIGHTNING,
     "bolt of lightning",
-    new calcdice_calculator<3, 0, 2, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<3, 27, 1, 12>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<3, 0, 2, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 27, 1, 12>,
+    tohit_calculator<AUTOMATIC_HIT>,
     LIGHTCYAN,
     false,
     BEAM_THUNDER,
@@ -1554,10 +1554,10 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
 {
     ZAP_BLINKBOLT,
     "living lightning",
-    new dicedef_calculator<1, 11, 3, 5>,
-    new tohit_calculator<16, 1, 4>,
-    new dicedef_calculator<2, 10, 1, 17>,
-    new tohit_calculator<16, 1, 40>,
+    dicedef_calculator<1, 11, 3, 5>,
+    tohit_calculator<16, 1, 4>,
+    dicedef_calculator<2, 10, 1, 17>,
+    tohit_calculator<16, 1, 40>,
     LIGHTCYAN,
     false,
     BEAM_ELECTRICITY,
@@ -1571,8 +1571,8 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
     "freezing gust",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 9, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    dicedef_calculator<2, 9, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     WHITE,
     false,
     BEAM_COLD,
@@ -1586,7 +1586,7 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
     "beckoning whirlwind",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 4, 1, 20>,
+    dicedef_calculator<2, 4, 1, 20>,
     nullptr,
     BLACK,
     false,
@@ -1601,8 +1601,8 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
     "harpoon shot",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 7, 1, 20>,
-    new tohit_calculator<17, 1, 25>,
+    dicedef_calculator<2, 7, 1, 20>,
+    tohit_calculator<17, 1, 25>,
     CYAN,
     false,
     BEAM_MMISSILE,
@@ -1617,8 +1617,8 @@ _mon_hex_zap(ZAP_SLEEP, BEAM_SLEEP),
     "whirling bolas",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 5, 1, 20>,
-    new tohit_calculator<20, 1, 20>,
+    dicedef_calculator<2, 5, 1, 20>,
+    tohit_calculator<20, 1, 20>,
     BROWN,
     false,
     BEAM_BOLAS,
@@ -1654,10 +1654,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_FIRE_STORM,
     "great blast of fire",
-    new calcdice_calculator<8, 5, 1, 1>,
-    new tohit_calculator<40>,
-    new calcdice_calculator<8, 5, 1, 2>,
-    new tohit_calculator<40>,
+    calcdice_calculator<8, 5, 1, 1>,
+    tohit_calculator<40>,
+    calcdice_calculator<8, 5, 1, 2>,
+    tohit_calculator<40>,
     RED,
     false,
     BEAM_LAVA, // partially unaffected by rF
@@ -1700,10 +1700,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_REFRIGERATE,
     "refrigeration",
-    new calcdice_calculator<4, 30, 4, 9>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new calcdice_calculator<4, 34, 9, 25>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<4, 30, 4, 9>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<4, 34, 9, 25>,
+    tohit_calculator<AUTOMATIC_HIT>,
     LIGHTCYAN,
     false,
     BEAM_COLD,
@@ -1717,8 +1717,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "drain life",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 6, 7, 10>,
-    new tohit_calculator<40>,
+    dicedef_calculator<2, 6, 7, 10>,
+    tohit_calculator<40>,
     DARKGREY,
     false,
     BEAM_NEG,
@@ -1730,10 +1730,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_SONIC_WAVE,
     "sonic wave",
-    new calcdice_calculator<2, 5, 1, 5>,
-    new tohit_calculator<40>,
-    new calcdice_calculator<2, 5, 1, 5>,
-    new tohit_calculator<40>,
+    calcdice_calculator<2, 5, 1, 5>,
+    tohit_calculator<40>,
+    calcdice_calculator<2, 5, 1, 5>,
+    tohit_calculator<40>,
     YELLOW,
     false,
     BEAM_MMISSILE,
@@ -1747,8 +1747,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "klown pie",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 20, 0, 1>,
-    new tohit_calculator<16, 1, 25>,
+    dicedef_calculator<3, 20, 0, 1>,
+    tohit_calculator<16, 1, 25>,
     BROWN,
     false,
     BEAM_MMISSILE,
@@ -1761,10 +1761,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_FOXFIRE,
     "foxfire",
-    new dicedef_calculator<1, 4, 1, 5>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<3, 3, 1, 12>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<1, 4, 1, 5>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 3, 1, 12>,
+    tohit_calculator<AUTOMATIC_HIT>,
     RED,
     false,
     BEAM_FIRE,
@@ -1776,8 +1776,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_TREMORSTONE,
     "burst of rock shards",
-    new dicedef_calculator<6, 6, 0, 1>,
-    new tohit_calculator<40>,
+    dicedef_calculator<6, 6, 0, 1>,
+    tohit_calculator<40>,
     nullptr,
     nullptr,
     BROWN,
@@ -1791,8 +1791,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_HAILSTORM,
     "hail",
-    new calcdice_calculator<3, 15, 1, 3>,
-    new tohit_calculator<9, 1, 10>,
+    calcdice_calculator<3, 15, 1, 3>,
+    tohit_calculator<9, 1, 10>,
     nullptr,
     nullptr,
     ETC_ICE,
@@ -1806,8 +1806,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_MYSTIC_BLAST,
     "mystic blast",
-    new calcdice_calculator<2, 6, 1, 3>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<2, 6, 1, 3>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     LIGHTMAGENTA,
@@ -1822,10 +1822,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_SWORD_BEAM,
     "bolt of energy",
-    new calcdice_calculator<1, 40, 0, 1>,
-    new tohit_calculator<5>,
-    new calcdice_calculator<1, 40, 0, 1>,
-    new tohit_calculator<5>,
+    calcdice_calculator<1, 40, 0, 1>,
+    tohit_calculator<5>,
+    calcdice_calculator<1, 40, 0, 1>,
+    tohit_calculator<5>,
     RED,
     false,
     BEAM_DESTRUCTION,
@@ -1853,9 +1853,9 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     ZAP_ENFEEBLE,
     "",
     nullptr,
-    new tohit_calculator<0, 4, 1>,
+    tohit_calculator<0, 4, 1>,
     nullptr,
-    new tohit_calculator<0, 2, 1>,
+    tohit_calculator<0, 2, 1>,
     BLACK,
     true,
     BEAM_ENFEEBLE,
@@ -1868,9 +1868,9 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     ZAP_SOUL_SPLINTER,
     "",
     nullptr,
-    new tohit_calculator<6, 1, 2>,
+    tohit_calculator<6, 1, 2>,
     nullptr,
-    new tohit_calculator<0, 4, 1>,
+    tohit_calculator<0, 4, 1>,
     BLACK,
     true,
     BEAM_SOUL_SPLINTER,
@@ -1882,10 +1882,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_PLASMA,
     "fiery plasma",
-    new dicedef_calculator<1, 10, 11, 20>,
-    new tohit_calculator<7, 1, 40>,
-    new dicedef_calculator<3, 10, 1, 17>,
-    new tohit_calculator<16, 1, 40>,
+    dicedef_calculator<1, 10, 11, 20>,
+    tohit_calculator<7, 1, 40>,
+    dicedef_calculator<3, 10, 1, 17>,
+    tohit_calculator<16, 1, 40>,
     RED,
     false,
     BEAM_FIRE,
@@ -1897,10 +1897,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_PLASMA_LIGHTNING, // please keep damage dice identical to ZAP_PLASMA
     "bolt of lightning",
-    new dicedef_calculator<1, 10, 11, 20>,
-    new tohit_calculator<7, 1, 40>,
-    new dicedef_calculator<3, 10, 1, 17>,
-    new tohit_calculator<16, 1, 40>,
+    dicedef_calculator<1, 10, 11, 20>,
+    tohit_calculator<7, 1, 40>,
+    dicedef_calculator<3, 10, 1, 17>,
+    tohit_calculator<16, 1, 40>,
     LIGHTCYAN,
     false,
     BEAM_ELECTRICITY,
@@ -1914,7 +1914,7 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "malign ofering",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 4, 1, 10>,
+    dicedef_calculator<2, 4, 1, 10>,
     nullptr,
     DARKGRAY,
     true,
@@ -1927,10 +1927,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_HURL_TORCHLIGHT,
     "umbral torchlight",
-    new dicedef_calculator<3, 7, 1, 5>,
-    new tohit_calculator<40>,
-    new dicedef_calculator<3, 3, 1, 10>,
-    new tohit_calculator<40>,
+    dicedef_calculator<3, 7, 1, 5>,
+    tohit_calculator<40>,
+    dicedef_calculator<3, 3, 1, 10>,
+    tohit_calculator<40>,
     CYAN,
     false,
     BEAM_UMBRAL_TORCHLIGHT,
@@ -1943,10 +1943,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_WARP_SPACE,
     "rupture",
-    new calcdice_calculator<3, 12, 3, 5>,
-    new tohit_calculator<40>,
-    new dicedef_calculator<3, 4, 1, 12>,
-    new tohit_calculator<40>,
+    calcdice_calculator<3, 12, 3, 5>,
+    tohit_calculator<40>,
+    dicedef_calculator<3, 4, 1, 12>,
+    tohit_calculator<40>,
     LIGHTMAGENTA,
     false,
     BEAM_WARPING,
@@ -1961,8 +1961,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "destabilizing rupture",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 7, 1, 12>,
-    new tohit_calculator<40>,
+    dicedef_calculator<3, 7, 1, 12>,
+    tohit_calculator<40>,
     LIGHTMAGENTA,
     false,
     BEAM_MMISSILE,
@@ -1975,10 +1975,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_CAUSTIC_BREATH,
     "acid spray",
-    new dicedef_calculator<3, 3, 1, 1>,
-    new tohit_calculator<30>,
-    new dicedef_calculator<3, 3, 1, 1>,
-    new tohit_calculator<30>,
+    dicedef_calculator<3, 3, 1, 1>,
+    tohit_calculator<30>,
+    dicedef_calculator<3, 3, 1, 1>,
+    tohit_calculator<30>,
     YELLOW,
     false,
     BEAM_ACID,
@@ -1990,8 +1990,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_NULLIFYING_BREATH,
     "nullifying energy",
-    new dicedef_calculator<3, 4, 1, 3>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 4, 1, 3>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     MAGENTA,
@@ -2005,8 +2005,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_MUD_BREATH,
     "ball of mud",
-    new dicedef_calculator<3, 3, 1, 1>,
-    new tohit_calculator<30>,
+    dicedef_calculator<3, 3, 1, 1>,
+    tohit_calculator<30>,
     nullptr,
     nullptr,
     BROWN,
@@ -2020,8 +2020,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_GALVANIC_BREATH,
     "arc of electricity",
-    new dicedef_calculator<3, 3, 9, 10>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 3, 9, 10>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     LIGHTCYAN,
@@ -2035,8 +2035,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_AUTODAZZLE,
     "blinding ray",
-    new dicedef_calculator<0, 1, 0, 1>,
-    new tohit_calculator<10, 1, 25>,
+    dicedef_calculator<0, 1, 0, 1>,
+    tohit_calculator<10, 1, 25>,
     nullptr,
     nullptr,
     WHITE,
@@ -2051,8 +2051,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_GRAVITAS,
     "crushing gravity",
-    new dicedef_calculator<3, 6, 1, 14>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 6, 1, 14>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     LIGHTMAGENTA,
@@ -2066,8 +2066,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_MAGNAVOLT,
     "arc of electricity",
-    new dicedef_calculator<4, 9, 1, 10>,
-    new tohit_calculator<11, 1, 20>,
+    dicedef_calculator<4, 9, 1, 10>,
+    tohit_calculator<11, 1, 20>,
     nullptr,
     nullptr,
     LIGHTCYAN,
@@ -2081,8 +2081,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_FULSOME_FUSILLADE,
     "volatile concoction",
-    new dicedef_calculator<3, 5, 1, 8>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 5, 1, 8>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     WHITE,
@@ -2097,9 +2097,9 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     ZAP_RIMEBLIGHT,
     "",
     nullptr,
-    new tohit_calculator<0, 1, 3>,
+    tohit_calculator<0, 1, 3>,
     nullptr,
-    new tohit_calculator<0, 1, 3>,
+    tohit_calculator<0, 1, 3>,
     BLUE,
     true,
     BEAM_RIMEBLIGHT,
@@ -2111,8 +2111,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_RIMEBLIGHT_SHARDS,
     "shards of blighted ice",
-    new dicedef_calculator<3, 6, 1, 8>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 6, 1, 8>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     ETC_ICE,
@@ -2128,8 +2128,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "shard of frigid ice",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 3, 1, 16>,
-    new tohit_calculator<13, 1, 35>,
+    dicedef_calculator<3, 3, 1, 16>,
+    tohit_calculator<13, 1, 35>,
     WHITE,
     false,
     BEAM_ICE,
@@ -2144,8 +2144,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "salvo of frigid ice",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 6, 1, 8>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 6, 1, 8>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_ICE,
@@ -2161,8 +2161,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "flashing steel",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 7, 1, 12>,
-    new tohit_calculator<20, 1, 25>,
+    dicedef_calculator<3, 7, 1, 12>,
+    tohit_calculator<20, 1, 25>,
     LIGHTCYAN,
     false,
     BEAM_MMISSILE,
@@ -2176,8 +2176,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "phantom echo",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 9, 1, 11>,
-    new tohit_calculator<20, 1, 30>,
+    dicedef_calculator<3, 9, 1, 11>,
+    tohit_calculator<20, 1, 30>,
     CYAN,
     false,
     BEAM_MMISSILE,
@@ -2192,8 +2192,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "shard of hardened shadow",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 7, 1, 9>,
-    new tohit_calculator<20, 1, 10>,
+    dicedef_calculator<3, 7, 1, 9>,
+    tohit_calculator<20, 1, 10>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2208,8 +2208,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "ray of shadow",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 6, 1, 13>,
-    new tohit_calculator<20, 1, 15>,
+    dicedef_calculator<3, 6, 1, 13>,
+    tohit_calculator<20, 1, 15>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2224,8 +2224,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "shadowball",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 4, 1, 14>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 4, 1, 14>,
+    tohit_calculator<AUTOMATIC_HIT>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2240,8 +2240,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "creeping shadow",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 4, 1, 14>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 4, 1, 14>,
+    tohit_calculator<AUTOMATIC_HIT>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2256,8 +2256,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "shadowy lightning",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 4, 1, 16>,
-    new tohit_calculator<15, 1, 20>,
+    dicedef_calculator<3, 4, 1, 16>,
+    tohit_calculator<15, 1, 20>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2271,8 +2271,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "wave of devouring shadow",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 3, 1, 18>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 3, 1, 18>,
+    tohit_calculator<AUTOMATIC_HIT>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2285,9 +2285,9 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     ZAP_SHADOW_TORPOR,
     "",
     nullptr,
-    new tohit_calculator<0, 1, 3>,
+    tohit_calculator<0, 1, 3>,
     nullptr,
-    new tohit_calculator<0, 1, 3>,
+    tohit_calculator<0, 1, 3>,
     BLUE,
     true,
     BEAM_SHADOW_TORPOR,
@@ -2301,8 +2301,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "shadow bullet",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 3, 1, 17>,
-    new tohit_calculator<15, 1, 15>,
+    dicedef_calculator<2, 3, 1, 17>,
+    tohit_calculator<15, 1, 15>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2315,10 +2315,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_GRAVE_CLAW,
     "jagged bones",
-    new dicedef_calculator<2, 7, 1, 7>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<2, 4, 1, 8>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 7, 1, 7>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 4, 1, 8>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -2330,8 +2330,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_UNLEASH_DESTRUCTION,
     "gout of destruction",
-    new dicedef_calculator<3, 5, 1, 2>,
-    new tohit_calculator<10, 1, 7>,
+    dicedef_calculator<3, 5, 1, 2>,
+    tohit_calculator<10, 1, 7>,
     nullptr,
     nullptr,
     WHITE,
@@ -2345,8 +2345,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_UNLEASH_DESTRUCTION_PIERCING,
     "gout of destruction",
-    new dicedef_calculator<3, 5, 1, 2>,
-    new tohit_calculator<10, 1, 7>,
+    dicedef_calculator<3, 5, 1, 2>,
+    tohit_calculator<10, 1, 7>,
     nullptr,
     nullptr,
     WHITE,
@@ -2360,8 +2360,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_BLOOD_ARROW,
     "blood arrow",
-    new dicedef_calculator<4, 3, 27, 100>,
-    new tohit_calculator<20, 1, 7>,
+    dicedef_calculator<4, 3, 27, 100>,
+    tohit_calculator<20, 1, 7>,
     nullptr,
     nullptr,
     LIGHTRED,
@@ -2376,10 +2376,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_SPIKE_LAUNCHER,
     "rocky spike",
-    new dicedef_calculator<2, 3, 1, 12>,
-    new tohit_calculator<12, 1, 10>,
-    new dicedef_calculator<2, 3, 1, 18>,
-    new tohit_calculator<12, 1, 16>,
+    dicedef_calculator<2, 3, 1, 12>,
+    tohit_calculator<12, 1, 10>,
+    dicedef_calculator<2, 3, 1, 18>,
+    tohit_calculator<12, 1, 16>,
     LIGHTGREY,
     false,
     BEAM_MMISSILE,
@@ -2391,8 +2391,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_KINETIC_GRAPNEL,
     "kinetic grapnel",
-    new dicedef_calculator<1, 4, 4, 25>,
-    new tohit_calculator<8, 1, 5>,
+    dicedef_calculator<1, 4, 4, 25>,
+    tohit_calculator<8, 1, 5>,
     nullptr,
     nullptr,
     CYAN,
@@ -2408,8 +2408,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "shred",
     nullptr,
     nullptr,
-    new dicedef_calculator<4, 4, 1, 22>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 4, 1, 22>,
+    tohit_calculator<AUTOMATIC_HIT>,
     CYAN,
     false,
     BEAM_MMISSILE,
@@ -2421,10 +2421,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_PARAGON_IMPACT,
     "shockwave",
-    new dicedef_calculator<4, 10, 1, 10>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<4, 10, 1, 10>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 10, 1, 10>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 10, 1, 10>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -2436,10 +2436,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_MONARCH_DETONATION,
     "detonation",
-    new dicedef_calculator<4, 5, 1, 8>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new calcdice_calculator<4, 7, 2, 5>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 5, 1, 8>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<4, 7, 2, 5>,
+    tohit_calculator<AUTOMATIC_HIT>,
     RED,
     false,
     BEAM_LAVA,
@@ -2453,8 +2453,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "bomblet",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 3, 1, 30>,
-    new tohit_calculator<14, 1, 35>,
+    dicedef_calculator<2, 3, 1, 30>,
+    tohit_calculator<14, 1, 35>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -2467,10 +2467,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_SPLINTERFROST_FRAGMENT,
     "salvo of icicles",
-    new calcdice_calculator<6, 24, 4, 5>,
-    new tohit_calculator<10, 1, 25>,
-    new dicedef_calculator<3, 8, 1, 11>,
-    new tohit_calculator<17, 1, 25>,
+    calcdice_calculator<6, 24, 4, 5>,
+    tohit_calculator<10, 1, 25>,
+    dicedef_calculator<3, 8, 1, 11>,
+    tohit_calculator<17, 1, 25>,
     WHITE,
     false,
     BEAM_ICE,
@@ -2483,10 +2483,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_PERCUSSIVE_TEMPERING,
     "blast",
-    new dicedef_calculator<4, 4, 1, 12>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<4, 4, 1, 16>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 4, 1, 12>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 4, 1, 16>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -2498,10 +2498,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_FORTRESS_BLAST,
     "fortress blast",
-    new dicedef_calculator<6, 4, 3, 17>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<6, 4, 1, 6>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<6, 4, 3, 17>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<6, 4, 1, 6>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -2516,8 +2516,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "seismic shockwave",
     nullptr,
     nullptr,
-    new dicedef_calculator<4, 3, 1, 23>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 3, 1, 23>,
+    tohit_calculator<AUTOMATIC_HIT>,
     YELLOW,
     false,
     BEAM_SEISMIC,
@@ -2531,8 +2531,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "condensed magic",
     nullptr,
     nullptr,
-    new dicedef_calculator<2, 6, 1, 12>,
-    new tohit_calculator<30>,
+    dicedef_calculator<2, 6, 1, 12>,
+    tohit_calculator<30>,
     MAGENTA,
     false,
     BEAM_MMISSILE,
@@ -2546,8 +2546,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "bolt of magma",
     nullptr,
     nullptr,
-    new dicedef_calculator<4, 4, 2, 21>,
-    new tohit_calculator<17, 1, 25>,
+    dicedef_calculator<4, 4, 2, 21>,
+    tohit_calculator<17, 1, 25>,
     RED,
     false,
     BEAM_LAVA,
@@ -2560,10 +2560,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_MERCURY_ARROW,
     "glob of mercury",
-    new calcdice_calculator<2, 11, 1, 4>,
-    new tohit_calculator<12, 1, 5>,
-    new dicedef_calculator<2, 4, 1, 10>,
-    new tohit_calculator<12, 1, 5>,
+    calcdice_calculator<2, 11, 1, 4>,
+    tohit_calculator<12, 1, 5>,
+    dicedef_calculator<2, 4, 1, 10>,
+    tohit_calculator<12, 1, 5>,
     GREEN,
     false,
     BEAM_MERCURY,
@@ -2576,10 +2576,10 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_FREEZE,
     "freeze",
-    new dicedef_calculator<1, 3, 3, 10>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<1, 3, 3, 10>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<1, 3, 3, 10>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<1, 3, 3, 10>,
+    tohit_calculator<AUTOMATIC_HIT>,
     WHITE,
     false,
     BEAM_COLD,
@@ -2593,8 +2593,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "swarm of vampire bats",
     nullptr,
     nullptr,
-    new dicedef_calculator<0, 1, 1, 1>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<0, 1, 1, 1>,
+    tohit_calculator<AUTOMATIC_HIT>,
     BLUE,
     false,
     BEAM_BAT_CLOUD,
@@ -2606,8 +2606,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_WATERY_GRAVE,
     "grasping water",
-    new calcdice_calculator<0, 1, 1, 1>,    // Overriden by Form::get_special_damage()
-    new tohit_calculator<AUTOMATIC_HIT>,
+    calcdice_calculator<0, 1, 1, 1>,    // Overriden by Form::get_special_damage()
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     LIGHTBLUE,
@@ -2622,7 +2622,7 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     ZAP_RUST_BREATH,
     "billowing rust",
     nullptr,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     YELLOW,
@@ -2638,8 +2638,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
     "ghostly fireball",
     nullptr,
     nullptr,
-    new dicedef_calculator<5, 6, 1, 13>,
-    new tohit_calculator<40>,
+    dicedef_calculator<5, 6, 1, 13>,
+    tohit_calculator<40>,
     DARKGREY,
     false,
     BEAM_NEG,
@@ -2653,8 +2653,8 @@ _mon_hex_zap(ZAP_VITRIFY, BEAM_VITRIFY),
 {
     ZAP_GOLDEN_BREATH,
     "buggy blast",
-    new dicedef_calculator<3, 2, 4, 3>,
-    new tohit_calculator<20, 1, 5>,
+    dicedef_calculator<3, 2, 4, 3>,
+    tohit_calculator<20, 1, 5>,
     nullptr,
     nullptr,
     RED,
@@ -2673,8 +2673,8 @@ _mon_hex_zap(ZAP_ILL_OMEN, BEAM_ILL_OMEN),
     "",
     nullptr,
     nullptr,
-    new dicedef_calculator<1, 3, 1, 18>,
-    new tohit_calculator<40>,
+    dicedef_calculator<1, 3, 1, 18>,
+    tohit_calculator<40>,
     DARKGREY,
     true,
     BEAM_WARP_BODY,
@@ -2686,8 +2686,8 @@ _mon_hex_zap(ZAP_ILL_OMEN, BEAM_ILL_OMEN),
 {
     ZAP_CONTAM_EXPLOSION,
     "magical storm",
-    new dicedef_calculator<3, 3, 2, 9>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 3, 2, 9>,
+    tohit_calculator<AUTOMATIC_HIT>,
     nullptr,
     nullptr,
     ETC_MUTAGENIC,
@@ -2704,8 +2704,8 @@ _mon_hex_zap(ZAP_ILL_OMEN, BEAM_ILL_OMEN),
     "ball of acid",
     nullptr,
     nullptr,
-    new dicedef_calculator<3, 4, 10, 105>,
-    new tohit_calculator<40>,
+    dicedef_calculator<3, 4, 10, 105>,
+    tohit_calculator<40>,
     YELLOW,
     false,
     BEAM_ACID,
@@ -2717,10 +2717,10 @@ _mon_hex_zap(ZAP_ILL_OMEN, BEAM_ILL_OMEN),
 {
     ZAP_SHOOTING_STAR,
     "shooting star",
-    new dicedef_calculator<4, 0, 1, 9>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<4, 2, 1, 14>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 0, 1, 9>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 2, 1, 14>,
+    tohit_calculator<AUTOMATIC_HIT>,
     CYAN,
     false,
     BEAM_MMISSILE,
@@ -2733,10 +2733,10 @@ _mon_hex_zap(ZAP_ILL_OMEN, BEAM_ILL_OMEN),
 {
     ZAP_VALOUR_BEAM,
     "beam of energy",
-    new dicedef_calculator<4, 0, 2, 3>,
-    new tohit_calculator<20>,
-    new dicedef_calculator<4, 0, 2, 3>,
-    new tohit_calculator<20>,
+    dicedef_calculator<4, 0, 2, 3>,
+    tohit_calculator<20>,
+    dicedef_calculator<4, 0, 2, 3>,
+    tohit_calculator<20>,
     WHITE,
     false,
     BEAM_MMISSILE,
@@ -2751,8 +2751,8 @@ _mon_hex_zap(ZAP_ILL_OMEN, BEAM_ILL_OMEN),
     "falling rubble",
     nullptr,
     nullptr,
-    new dicedef_calculator<4, 2, 1, 23>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<4, 2, 1, 23>,
+    tohit_calculator<AUTOMATIC_HIT>,
     YELLOW,
     false,
     BEAM_MMISSILE,
@@ -2764,10 +2764,10 @@ _mon_hex_zap(ZAP_ILL_OMEN, BEAM_ILL_OMEN),
 {
     ZAP_BURSTSPORE,
     "dizzying spores",
-    new dicedef_calculator<2, 6, 1, 4>,
-    new tohit_calculator<AUTOMATIC_HIT>,
-    new dicedef_calculator<3, 10, 1, 17>,
-    new tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<2, 6, 1, 4>,
+    tohit_calculator<AUTOMATIC_HIT>,
+    dicedef_calculator<3, 10, 1, 17>,
+    tohit_calculator<AUTOMATIC_HIT>,
     BROWN,
     false,
     BEAM_MMISSILE,
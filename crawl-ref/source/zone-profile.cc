@@ -0,0 +1,181 @@
+/**
+ * @file
+ * @brief Implementation of the scoped zone profiler.
+**/
+
+#include "AppHdr.h"
+
+#ifdef ZONE_PROFILING
+
+#include "zone-profile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <vector>
+
+#include "message.h"
+#include "notes.h"
+#include "stringutil.h"
+
+// A turn that takes longer than this gets its zone breakdown noted, and
+// thereby appended to the morgue.
+static const long long SLOW_TURN_US = 500 * 1000;
+
+// Power-of-two microsecond histogram: buckets[i] counts samples that took
+// [2^i, 2^(i+1)) us. 2^23 us is ~8.4s; anything slower lands in the last
+// bucket.
+static const int NUM_ZONE_BUCKETS = 24;
+
+struct zone_totals
+{
+    long long count;
+    long long total_us;
+    long long max_us;
+    long long buckets[NUM_ZONE_BUCKETS];
+
+    zone_totals() : count(0), total_us(0), max_us(0), buckets{} { }
+
+    void add_sample(long long us)
+    {
+        count++;
+        total_us += us;
+        max_us = max(max_us, us);
+
+        int bucket = 0;
+        while (bucket < NUM_ZONE_BUCKETS - 1 && us >= (2LL << bucket))
+            bucket++;
+        buckets[bucket]++;
+    }
+};
+
+// Keyed on the full slash-joined zone path. An ordered map keeps the
+// report output stable between dumps; the per-sample cost of the lookup
+// is fine for a facility that's compiled out of release builds.
+static map<string, zone_totals> _turn_stats;
+static map<string, zone_totals> _session_stats;
+
+static vector<const char *> _zone_stack;
+static long long _turn_start_us = 0;
+
+static long long _now_us()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(
+            steady_clock::now().time_since_epoch()).count();
+}
+
+static string _zone_path()
+{
+    string path;
+    for (const char *name : _zone_stack)
+    {
+        if (!path.empty())
+            path += "/";
+        path += name;
+    }
+    return path;
+}
+
+perf_zone::perf_zone(const char *name)
+{
+    _zone_stack.push_back(name);
+    start_us = _now_us();
+}
+
+perf_zone::~perf_zone()
+{
+    const long long us = _now_us() - start_us;
+    const string path = _zone_path();
+    _turn_stats[path].add_sample(us);
+    _session_stats[path].add_sample(us);
+    _zone_stack.pop_back();
+}
+
+static string _histogram_desc(const zone_totals &zt)
+{
+    string desc;
+    for (int i = 0; i < NUM_ZONE_BUCKETS; ++i)
+    {
+        if (!zt.buckets[i])
+            continue;
+        if (!desc.empty())
+            desc += " ";
+        desc += make_stringf("%lldus:%lld", 1LL << i, zt.buckets[i]);
+    }
+    return desc;
+}
+
+string perf_zone_report(bool this_turn)
+{
+    const map<string, zone_totals> &stats = this_turn ? _turn_stats
+                                                      : _session_stats;
+
+    // Heaviest zones first.
+    vector<pair<string, const zone_totals *>> rows;
+    for (const auto &entry : stats)
+        rows.emplace_back(entry.first, &entry.second);
+    sort(rows.begin(), rows.end(),
+         [](const pair<string, const zone_totals *> &a,
+            const pair<string, const zone_totals *> &b)
+         {
+             return a.second->total_us > b.second->total_us;
+         });
+
+    string out = make_stringf("%-40s %8s %10s %10s %10s\n",
+                              "zone", "calls", "total ms", "mean us",
+                              "max us");
+    for (const auto &row : rows)
+    {
+        const zone_totals &zt = *row.second;
+        out += make_stringf("%-40s %8lld %10lld %10lld %10lld\n",
+                            row.first.c_str(), zt.count,
+                            zt.total_us / 1000, zt.total_us / zt.count,
+                            zt.max_us);
+        out += "    " + _histogram_desc(zt) + "\n";
+    }
+    return out;
+}
+
+void perf_zone_turn_start()
+{
+    _turn_stats.clear();
+    _turn_start_us = _now_us();
+}
+
+void perf_zone_turn_end()
+{
+    if (!_turn_start_us)
+        return;
+
+    const long long us = _now_us() - _turn_start_us;
+    _turn_start_us = 0;
+    if (us < SLOW_TURN_US || _turn_stats.empty())
+        return;
+
+    // Noted, and therefore dumped into the morgue, so a report can tell
+    // us which subsystem ate the turn.
+    take_note(Note(NOTE_MESSAGE, 0, 0,
+                   make_stringf("Slow turn (%lld ms):\n%s",
+                                us / 1000,
+                                perf_zone_report(true).c_str())));
+    mprf(MSGCH_DIAGNOSTICS, "Slow turn: %lld ms (zone breakdown noted).",
+         us / 1000);
+}
+
+void wizard_dump_perf_zones()
+{
+    if (_session_stats.empty())
+    {
+        mpr("No zone samples recorded yet.");
+        return;
+    }
+
+    for (const string &line :
+         split_string("\n", perf_zone_report(false), false, false))
+    {
+        mprf(MSGCH_DIAGNOSTICS, "%s", line.c_str());
+    }
+}
+
+#endif // ZONE_PROFILING
@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @brief Lightweight scoped zone profiling, compiled out by default.
+ *
+ * Build with ZONE_PROFILING=YesPlease to enable. PERF_ZONE("name") times
+ * the enclosing scope; zones nest, and samples aggregate under their full
+ * "outer/inner" path, so time spent in a save triggered from world_reacts
+ * is attributed separately from one triggered from the main menu.
+ *
+ * Turn boundaries are marked from world_reacts(); a turn that overruns
+ * the slow-turn threshold gets its per-zone breakdown recorded as a note,
+ * and so ends up in the morgue. The whole-session aggregate can be dumped
+ * with the &Ctrl-H wizard command.
+**/
+
+#pragma once
+
+#ifdef ZONE_PROFILING
+
+#include <string>
+
+class perf_zone
+{
+public:
+    perf_zone(const char *name);
+    ~perf_zone();
+
+    perf_zone(const perf_zone&) = delete;
+    perf_zone& operator=(const perf_zone&) = delete;
+
+private:
+    long long start_us;
+};
+
+#define PERF_ZONE_CAT2(a, b) a##b
+#define PERF_ZONE_CAT(a, b) PERF_ZONE_CAT2(a, b)
+#define PERF_ZONE(name) perf_zone PERF_ZONE_CAT(_perf_zone_, __LINE__)(name)
+
+void perf_zone_turn_start();
+void perf_zone_turn_end();
+string perf_zone_report(bool this_turn);
+void wizard_dump_perf_zones();
+
+#else
+
+#define PERF_ZONE(name) ((void)0)
+
+static inline void perf_zone_turn_start() { }
+static inline void perf_zone_turn_end() { }
+
+#endif